@@ -108,11 +108,13 @@ LOCAL_SRC_FILES := \
         profiling/server/src/timelineDecoder/TimelineDirectoryCaptureCommandHandler.cpp \
         src/armnn/BackendHelper.cpp \
         src/armnn/BackendRegistry.cpp \
+        src/armnn/ChromeTraceWriter.cpp \
         src/armnn/Descriptors.cpp \
         src/armnn/Exceptions.cpp \
         src/armnn/Graph.cpp \
         src/armnn/InternalTypes.cpp \
         src/armnn/JsonPrinter.cpp \
+        src/armnn/LatencyHistogram.cpp \
         src/armnn/Layer.cpp \
         src/armnn/LayerSupport.cpp \
         src/armnn/LoadedNetwork.cpp \
@@ -129,9 +131,12 @@ LOCAL_SRC_FILES := \
         src/armnn/SubgraphView.cpp \
         src/armnn/SubgraphViewSelector.cpp \
         src/armnn/Tensor.cpp \
+        src/armnn/Threadpool.cpp \
         src/armnn/TypesUtils.cpp \
         src/armnn/Utils.cpp \
         src/armnn/WallClockTimer.cpp \
+        src/armnn/WorkingMemHandle.cpp \
+        src/armnnUtils/BlockQuantization.cpp \
         src/armnnUtils/DataLayoutIndexed.cpp \
         src/armnnUtils/DotSerializer.cpp \
         src/armnnUtils/FloatingPointConverter.cpp \
@@ -142,7 +147,9 @@ LOCAL_SRC_FILES := \
         src/armnnUtils/TensorUtils.cpp \
         src/armnnUtils/VerificationHelpers.cpp \
         src/armnnUtils/Filesystem.cpp \
+        src/armnnUtils/MemoryMappedFile.cpp \
         src/armnnUtils/Processes.cpp \
+        src/armnnUtils/Sha256.cpp \
         src/armnnUtils/Threads.cpp \
         src/armnnUtils/Transpose.cpp \
         src/armnn/layers/ActivationLayer.cpp \
@@ -0,0 +1,36 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include "Types.hpp"
+
+#include <memory>
+
+namespace armnn
+{
+
+namespace experimental
+{
+
+class IAsyncExecutionCallback;
+using IAsyncExecutionCallbackPtr = std::shared_ptr<IAsyncExecutionCallback>;
+
+/// Interface notified of the completion of an execution scheduled with IRuntime::EnqueueWorkloadAsync().
+class IAsyncExecutionCallback
+{
+public:
+    virtual ~IAsyncExecutionCallback() {};
+
+    /// Called from one of the threads of the runtime's thread pool once the execution has finished.
+    /// The output tensors are filled in before this is called. Implementations must not throw and should
+    /// return quickly as the thread is not available to other queued executions until they do.
+    /// @param status - The result of the execution.
+    /// @param timeTaken - The time at which the execution started and ended.
+    virtual void Notify(armnn::Status status, InferenceTimingPair timeTaken) = 0;
+};
+
+} // end experimental namespace
+
+} // end armnn namespace
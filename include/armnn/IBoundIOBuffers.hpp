@@ -0,0 +1,29 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+namespace armnn
+{
+
+using NetworkId = int;
+
+namespace experimental
+{
+
+/// Interface for a set of input and output buffers bound once to a loaded network with IRuntime::BindIOBuffers().
+/// The workloads copying the data in and out of the network are created, and the buffers validated, when binding,
+/// so repeated executions with IRuntime::EnqueueWorkload(IBoundIOBuffers&) skip that work.
+class IBoundIOBuffers
+{
+public:
+    virtual ~IBoundIOBuffers() {};
+
+    /// Returns the NetworkId of the network the buffers are bound to.
+    virtual NetworkId GetNetworkId() const = 0;
+};
+
+} // end experimental namespace
+
+} // end armnn namespace
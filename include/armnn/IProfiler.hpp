@@ -5,11 +5,28 @@
 
 #pragma once
 
+#include <cstdint>
 #include <iostream>
+#include <string>
+#include <vector>
 
 namespace armnn
 {
 
+/// Latency percentiles of the events with the same name, estimated to within 1% from a histogram of their wall
+/// clock times. The events of the inferences of a LoadedNetwork are named "EnqueueWorkload", and those of its
+/// workloads after the workload (e.g. "RefConvolution2dWorkload_Execute").
+struct ProfilingEventLatencies
+{
+    std::string m_Name;
+    uint64_t m_Count;
+    double m_P50Us;
+    double m_P90Us;
+    double m_P99Us;
+    double m_P999Us;
+    double m_MaxUs;
+};
+
 class IProfiler
 {
 public:
@@ -31,6 +48,28 @@ public:
     /// @param [out] outStream The stream where to write the profiling results to.
     virtual void Print(std::ostream& outStream) const = 0;
 
+    /// Limits the events kept for the reports to those of the last maxInferences inferences, stored in buffers
+    /// which are reused once they are full so that profiling can stay enabled indefinitely with bounded memory.
+    /// Only the wall clock times of the events are kept in this mode. The statistics per event name keep covering
+    /// all the events. Recorded events are discarded when the limit changes.
+    /// @param [in] maxInferences Number of inferences to keep, 0 to keep every event (the default).
+    virtual void SetMaxRecordedInferences(unsigned int maxInferences) = 0;
+
+    /// Streams the events to a file in the Chrome Trace Event format, as they end, for viewing in chrome://tracing
+    /// or the Perfetto UI. The events of each thread are shown in their own lane, nested as they were reported,
+    /// with the size of the working memory of the network as a counter track: the memory the memory managers plan
+    /// to hold while it is allocated, or the memory held by the working memory handles of an async network from
+    /// their creation to their destruction. The file is completed when tracing stops or the profiler is destroyed.
+    /// Events are only traced while profiling is enabled.
+    /// @param [in] fileName The file to create, or an empty string to stop tracing.
+    virtual void SetTraceFile(const std::string& fileName) = 0;
+
+    /// Gets the latency percentiles of every event timed by a WallClockTimer since the profiler was created, by
+    /// event name. Like the statistics per event name, they cover all the events whatever the number of recorded
+    /// inferences. Print() adds them to the measurements of the events.
+    /// @return The latencies of the events, sorted by name.
+    virtual std::vector<ProfilingEventLatencies> GetEventLatencies() const = 0;
+
 protected:
     ~IProfiler() {}
 };
@@ -5,13 +5,17 @@
 #pragma once
 
 #include "BackendOptions.hpp"
+#include "IAsyncExecutionCallback.hpp"
+#include "IBoundIOBuffers.hpp"
 #include "INetwork.hpp"
 #include "IProfiler.hpp"
+#include "IWorkingMemHandle.hpp"
 #include "Tensor.hpp"
 #include "Types.hpp"
 #include "TypesUtils.hpp"
 #include "profiling/ILocalPacketHandler.hpp"
 
+#include <future>
 #include <memory>
 
 namespace armnn
@@ -26,13 +30,18 @@ using IRuntimePtr = std::unique_ptr<IRuntime, void(*)(IRuntime* runtime)>;
 
 struct INetworkProperties
 {
-    INetworkProperties(bool importEnabled = false, bool exportEnabled = false)
+    INetworkProperties(bool importEnabled = false, bool exportEnabled = false, bool asyncEnabled = false)
         : m_ImportEnabled(importEnabled),
-          m_ExportEnabled(exportEnabled) {}
+          m_ExportEnabled(exportEnabled),
+          m_AsyncEnabled(asyncEnabled) {}
 
     const bool m_ImportEnabled;
     const bool m_ExportEnabled;
 
+    /// Loads the network for execution through IRuntime::Execute() with working memory handles
+    /// instead of IRuntime::EnqueueWorkload().
+    const bool m_AsyncEnabled;
+
     virtual ~INetworkProperties() {}
 };
 
@@ -45,6 +54,7 @@ public:
             : m_GpuAccTunedParameters(nullptr)
             , m_EnableGpuProfiling(false)
             , m_DynamicBackendsPath("")
+            , m_NumberOfThreads(0)
         {}
 
         /// If set, uses the GpuAcc tuned parameters from the given object when executing GPU workloads.
@@ -58,6 +68,11 @@ public:
         /// Only a single path is allowed for the override
         std::string m_DynamicBackendsPath;
 
+        /// The number of threads of the pool executing the networks scheduled with EnqueueWorkloadAsync().
+        /// The pool is only started on the first call to EnqueueWorkloadAsync(). A value of 0 selects the
+        /// number of hardware threads.
+        unsigned int m_NumberOfThreads;
+
         struct ExternalProfilingOptions
         {
             ExternalProfilingOptions()
@@ -112,6 +127,10 @@ public:
         ///   "TuningLevel" : int [0..3] (0=UseOnly(default) | 1=RapidTuning | 2=NormalTuning | 3=ExhaustiveTuning)
         ///   "TuningFile" : string [filenameString]
         ///   "KernelProfilingEnabled" : bool [true | false]
+        /// CpuRef:
+        ///   "NumberOfThreads" : int [1..] (number of threads executing each workload, default 1)
+        ///     The threads are shared by every runtime of the process: the last runtime created with this option
+        ///     sets the number of threads of all the runtimes, including those created before it.
         std::vector<BackendOptions> m_BackendOptions;
     };
 
@@ -149,9 +168,62 @@ public:
                                    const InputTensors& inputTensors,
                                    const OutputTensors& outputTensors) = 0;
 
+    /// This is an experimental function.
+    /// Binds input and output buffers to a network for repeated evaluation with EnqueueWorkload(IBoundIOBuffers&).
+    /// The memory of the tensors must stay valid, and must not be reallocated, for as long as the returned
+    /// object is in use. The returned object must not outlive the network.
+    /// Networks loaded with memory import/export or INetworkProperties::m_AsyncEnabled are not supported.
+    /// @return An object holding the bound buffers, throws InvalidArgumentException if they do not match the network.
+    virtual std::unique_ptr<experimental::IBoundIOBuffers> BindIOBuffers(NetworkId networkId,
+                                                                         const InputTensors& inputTensors,
+                                                                         const OutputTensors& outputTensors) = 0;
+
+    /// This is an experimental function.
+    /// Evaluates a network using the input and output buffers bound with BindIOBuffers().
+    virtual Status EnqueueWorkload(experimental::IBoundIOBuffers& boundIOBuffers) = 0;
+
+    /// This is an experimental function.
+    /// Evaluates a network using input in inputTensors and outputs filled into outputTensors.
+    /// The intermediate tensors are taken from the given working memory handle, so executions using different
+    /// handles of the same network can run concurrently from different threads.
+    /// Blocks until this and any other execution using the same working memory handle completes.
+    /// The network must have been loaded with INetworkProperties::m_AsyncEnabled set.
+    virtual Status Execute(experimental::IWorkingMemHandle& workingMemHandle,
+                           const InputTensors& inputTensors,
+                           const OutputTensors& outputTensors) = 0;
+
+    /// This is an experimental function.
+    /// Creates a new working memory handle for the given network. Create one handle per thread that should
+    /// execute the network concurrently. The handle must not outlive the network it was created for.
+    /// @param [in] networkId - Unique identifier of a network loaded with INetworkProperties::m_AsyncEnabled set.
+    /// @return A new working memory handle, or nullptr if the network does not support it.
+    virtual std::unique_ptr<experimental::IWorkingMemHandle> CreateWorkingMemHandle(NetworkId networkId) = 0;
+
+    /// This is an experimental function.
+    /// Schedules an evaluation of the network on the thread pool of the runtime and returns immediately.
+    /// The memory of the input and output tensors must stay valid until the execution has completed.
+    /// Networks loaded with INetworkProperties::m_AsyncEnabled set are executed concurrently on every thread
+    /// of the pool, other networks are executed one at a time as with EnqueueWorkload().
+    /// @param [in] priority - Queued executions of a higher priority are started first.
+    /// @return A future which becomes ready with the status of the execution once it has completed.
+    virtual std::future<Status> EnqueueWorkloadAsync(NetworkId networkId,
+                                                     const InputTensors& inputTensors,
+                                                     const OutputTensors& outputTensors,
+                                                     QosExecPriority priority = QosExecPriority::Medium) = 0;
+
+    /// This is an experimental function.
+    /// As above, but notifies the given callback from the thread pool once the execution has completed.
+    virtual void EnqueueWorkloadAsync(NetworkId networkId,
+                                      const InputTensors& inputTensors,
+                                      const OutputTensors& outputTensors,
+                                      QosExecPriority priority,
+                                      experimental::IAsyncExecutionCallbackPtr callback) = 0;
+
     /// Unloads a network from the IRuntime.
     /// At the moment this only removes the network from the m_Impl->m_Network.
     /// This might need more work in the future to be AndroidNN compliant.
+    /// Waits for the executions of the network scheduled with EnqueueWorkloadAsync() to complete, so it must not be
+    /// called from an execution callback while other executions of the network are still queued.
     /// @param [in] networkId - Unique identifier for the network to be unloaded. Generated in LoadNetwork().
     /// @return armnn::Status
     virtual Status UnloadNetwork(NetworkId networkId) = 0;
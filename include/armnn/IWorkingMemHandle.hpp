@@ -0,0 +1,42 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include <mutex>
+
+namespace armnn
+{
+
+using NetworkId = int;
+
+namespace experimental
+{
+
+/// Interface for the working memory of a single execution of a loaded network.
+/// Each handle owns its own set of intermediate tensors, while the constant tensors and the workloads
+/// are shared with every other handle created for the same network. Executions using different handles
+/// can therefore run concurrently. See IRuntime::CreateWorkingMemHandle() and IRuntime::Execute().
+class IWorkingMemHandle
+{
+public:
+    virtual ~IWorkingMemHandle() {};
+
+    /// Returns the NetworkId of the network this working memory handle belongs to.
+    virtual NetworkId GetNetworkId() = 0;
+
+    /// Allocate the backing memory required for execution. If this is not called, then allocation will be
+    /// deferred to execution time. The memory is released when the handle is destroyed.
+    virtual void Allocate() = 0;
+
+    /// IsAllocated returns true if the backing memory is currently allocated.
+    virtual bool IsAllocated() = 0;
+
+    /// Get a mutex which can be used for synchronizing access to the WorkingMemHandle object.
+    virtual std::mutex& GetMutex() = 0;
+};
+
+} // end experimental namespace
+
+} // end armnn namespace
@@ -5,6 +5,7 @@
 #pragma once
 
 #include <array>
+#include <chrono>
 #include <functional>
 #include <memory>
 #include <stdint.h>
@@ -174,6 +175,15 @@ enum class ShapeInferenceMethod
     InferAndValidate = 1
 };
 
+/// The priority of an execution scheduled with IRuntime::EnqueueWorkloadAsync().
+/// Queued executions of a higher priority are always started before queued executions of a lower priority.
+enum class QosExecPriority
+{
+    Low    = 0,
+    Medium = 1,
+    High   = 2
+};
+
 /// Each backend should implement an IBackend.
 class IBackend
 {
@@ -201,6 +211,11 @@ public:
 /// Type of identifiers for bindable layers (inputs, outputs).
 using LayerBindingId = int;
 
+using HighResolutionClock = std::chrono::high_resolution_clock::time_point;
+
+/// The start and end time of an execution.
+using InferenceTimingPair = std::pair<HighResolutionClock, HighResolutionClock>;
+
 class PermutationVector
 {
 public:
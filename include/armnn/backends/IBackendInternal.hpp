@@ -28,6 +28,7 @@ namespace armnn
 class IWorkloadFactory;
 class IMemoryManager;
 class ILayerSupport;
+class PreCompiledLayer;
 
 struct BackendVersion
 {
@@ -162,6 +163,19 @@ public:
     /// IWorkloadFactory::CreateTensor()/IWorkloadFactory::CreateSubtensor() methods must be implemented.
     virtual void RegisterTensorHandleFactories(class TensorHandleFactoryRegistry& /*registry*/) {}
 
+    /// (Optional) Returns true if every workload created by this backend implements IWorkload::ExecuteAsync()
+    /// using only the tensor handles passed in the WorkingMemDescriptor. Networks containing layers assigned to
+    /// a backend which returns false cannot be loaded with INetworkProperties::m_AsyncEnabled set.
+    virtual bool SupportsAsyncExecution() const { return false; }
+
+    /// (Optional) Returns the bytes holding the precompiled object of a PreCompiledLayer assigned to this backend, so
+    /// that optimized networks holding the layer can be serialized. Throws armnn::Exception by default.
+    virtual std::vector<uint8_t> SerializePreCompiledObject(const PreCompiledLayer& layer) const;
+
+    /// (Optional) Sets the precompiled object of a deserialized PreCompiledLayer from the bytes returned by
+    /// SerializePreCompiledObject(). Throws armnn::Exception if the bytes don't hold a valid object.
+    virtual void DeserializePreCompiledObject(PreCompiledLayer& layer, const std::vector<uint8_t>& data) const;
+
     /// Returns the version of the Backend API
     static constexpr BackendVersion GetApiVersion() { return BackendVersion(1, 0); }
 };
@@ -4,6 +4,7 @@
 //
 #pragma once
 
+#include <cstddef>
 #include <memory>
 
 namespace armnn
@@ -18,6 +19,10 @@ public:
     virtual void Acquire() = 0;
     virtual void Release() = 0;
 
+    /// Returns the number of bytes of the memory held between Acquire() and Release(), as planned by the last call
+    /// to Acquire(), or 0 if the memory manager does not report it.
+    virtual size_t GetPlannedPeakMemory() const { return 0; }
+
     virtual ~IMemoryManager() {}
 };
 
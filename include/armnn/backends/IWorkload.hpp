@@ -9,6 +9,13 @@
 namespace armnn
 {
 
+namespace experimental
+{
+
+struct WorkingMemDescriptor;
+
+} // end experimental namespace
+
 /// Workload interface to enqueue a layer computation.
 class IWorkload {
 public:
@@ -18,6 +25,10 @@ public:
 
     virtual void Execute() const = 0;
 
+    /// Executes the workload using the tensor handles in the given descriptor instead of the ones the workload
+    /// was created with. Used by LoadedNetwork to run one workload object against several working memories.
+    virtual void ExecuteAsync(experimental::WorkingMemDescriptor& workingMemDescriptor) = 0;
+
     virtual profiling::ProfilingGuid GetGuid() const = 0;
 
     virtual void RegisterDebugCallback(const DebugCallbackFunction & /*func*/) {}
@@ -0,0 +1,28 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include <armnn/backends/ITensorHandle.hpp>
+
+#include <vector>
+
+namespace armnn
+{
+
+namespace experimental
+{
+
+/// Contains the tensor handles a workload reads from and writes to for one execution.
+/// Passed to IWorkload::ExecuteAsync() in place of the handles stored in the workload's queue descriptor,
+/// so that a single workload object can be executed against several independent sets of working memory.
+struct WorkingMemDescriptor
+{
+    std::vector<ITensorHandle*> m_Inputs;
+    std::vector<ITensorHandle*> m_Outputs;
+};
+
+} // end experimental namespace
+
+} // end armnn namespace
@@ -37,6 +37,13 @@ public:
     /// Create an input network from a binary input stream
     virtual armnn::INetworkPtr CreateNetworkFromBinary(std::istream& binaryContent) = 0;
 
+    /// Create an input network from a binary file, which is mapped into memory rather than read into a buffer
+    virtual armnn::INetworkPtr CreateNetworkFromBinaryFile(const char* graphFile) = 0;
+
+    /// Create an input network from a binary file whose large constant tensors were written to a separate file, as
+    /// set with ISerializer::SetConstantDataStream. The file of the constants is only mapped once a layer needs it.
+    virtual armnn::INetworkPtr CreateNetworkFromBinaryFile(const char* graphFile, const char* constantDataFile) = 0;
+
     /// Retrieve binding info (layer id and tensor info) for the network input identified by
     /// the given layer name and layers id
     virtual BindingPointInfo GetNetworkInputBindingInfo(unsigned int layerId,
@@ -8,6 +8,8 @@
 #include "armnn/NetworkFwd.hpp"
 #include "armnn/Types.hpp"
 
+#include <ostream>
+
 namespace armnnSerializer
 {
 
@@ -25,11 +27,31 @@ public:
     /// @param [in] inNetwork The network to be serialized.
     virtual void Serialize(const armnn::INetwork& inNetwork) = 0;
 
+    /// Writes the data of the large constant tensors to a separate stream as the network is serialized, rather than
+    /// holding it in the SerializedGraph, which then refers to it by offset. The data is written from the current
+    /// position of the stream, after what it already holds, and the offsets and the alignment of the data of each
+    /// tensor to ConstantDataAlignment bytes are counted from the start of the stream, which is what the deserializer
+    /// maps. Throws an InvalidArgumentException if the position of the stream cannot be determined.
+    /// Must be called before Serialize, and the stream must outlive it.
+    /// @param [in] stream The stream the data of the constant tensors is written to, such as a file.
+    /// @param [in] minExternalBytes The size from which the data of a constant tensor is written to the stream.
+    virtual void SetConstantDataStream(std::ostream& stream, size_t minExternalBytes) = 0;
+
     /// Serializes the SerializedGraph to the stream.
     /// @param [stream] the stream to save to
     /// @return true if graph is Serialized to the Stream, false otherwise
     virtual bool SaveSerializedToStream(std::ostream& stream) = 0;
 
+    /// Compresses the Float32 weights of the convolution and fully connected layers of the network, quantizing them in
+    /// blocks of consecutive elements which each have their own scale. The weights are expanded back to Float32 when
+    /// the network is deserialized. Their biases and the other constant tensors are kept as they are.
+    /// Must be called before Serialize.
+    /// @param [in] numBits The number of bits of the quantized weights, 8 or 4, or 0 to keep the weights as they are.
+    /// @param [in] blockSize The number of consecutive elements sharing a scale.
+    virtual void SetWeightCompression(unsigned int numBits, unsigned int blockSize) = 0;
+
+    static constexpr size_t ConstantDataAlignment = 64;
+
 protected:
     virtual ~ISerializer() {}
 };
@@ -0,0 +1,49 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include "armnn/BackendId.hpp"
+#include "armnn/INetwork.hpp"
+
+#include <string>
+#include <vector>
+
+namespace armnnSerializer
+{
+
+/// Cache of optimized networks held in the files of a directory. A process loading a model it has already optimized
+/// for the same backends with the same options gets the optimized network back without parsing the model or running
+/// the optimizer.
+class OptimizedNetworkCache
+{
+public:
+    /// @param [in] directory The existing directory holding the cached networks.
+    explicit OptimizedNetworkCache(const std::string& directory);
+
+    /// Returns the key the optimized network of a model is cached under: the SHA-256 digest of the content of the
+    /// model, the backend preferences and options passed to armnn::Optimize and the version of ArmNN, followed by the
+    /// size of the model. The key is stored with the network and checked when it is loaded.
+    static std::string GetKey(const void* modelContent,
+                              size_t modelSize,
+                              const std::vector<armnn::BackendId>& backendPreferences,
+                              const armnn::OptimizerOptions& options);
+
+    /// Loads the optimized network cached under a key.
+    /// @param [in] modelOptions The backend options the network was optimized with.
+    /// @return The optimized network, or an empty pointer if no network can be read under the key.
+    armnn::IOptimizedNetworkPtr Load(const std::string& key, const armnn::ModelOptions& modelOptions = {}) const;
+
+    /// Stores an optimized network under a key, replacing any network cached under it.
+    /// @return false if the network couldn't be cached, such as when a backend can't serialize the objects of the
+    ///         layers it precompiled.
+    bool Store(const std::string& key, const armnn::IOptimizedNetwork& network) const;
+
+private:
+    std::string GetPath(const std::string& key) const;
+
+    std::string m_Directory;
+};
+
+} //namespace armnnSerializer
@@ -0,0 +1,138 @@
+//
+// Copyright © 2020 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "ChromeTraceWriter.hpp"
+
+#include <armnn/Exceptions.hpp>
+
+#include <iomanip>
+
+namespace armnn
+{
+
+namespace
+{
+
+// All the events are reported under a single process, whose threads are the lanes.
+constexpr uint32_t g_TraceProcessId = 1;
+
+// Writes the string as a JSON string literal.
+void WriteJsonString(std::ostream& stream, const std::string& str)
+{
+    stream << '"';
+    for (char c : str)
+    {
+        switch (c)
+        {
+            case '"':  stream << "\\\""; break;
+            case '\\': stream << "\\\\"; break;
+            case '\n': stream << "\\n";  break;
+            case '\r': stream << "\\r";  break;
+            case '\t': stream << "\\t";  break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20)
+                {
+                    stream << "\\u" << std::hex << std::setw(4) << std::setfill('0')
+                           << static_cast<unsigned int>(c) << std::dec << std::setfill(' ');
+                }
+                else
+                {
+                    stream << c;
+                }
+        }
+    }
+    stream << '"';
+}
+
+} // anonymous namespace
+
+ChromeTraceWriter::ChromeTraceWriter(const std::string& fileName)
+    : m_File(fileName, std::ios::out | std::ios::trunc)
+    , m_IsFirstRecord(true)
+    , m_NumInferences(0)
+{
+    if (!m_File.is_open())
+    {
+        throw RuntimeException("Cannot open the profiling trace file " + fileName);
+    }
+    m_File.precision(3);
+    m_File.setf(std::ios::fixed);
+
+    m_File << "[";
+    BeginRecord();
+    m_File << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" << g_TraceProcessId
+           << ",\"args\":{\"name\":\"ArmNN\"}}";
+}
+
+ChromeTraceWriter::~ChromeTraceWriter()
+{
+    m_File << "\n]\n";
+}
+
+void ChromeTraceWriter::BeginRecord()
+{
+    m_File << (m_IsFirstRecord ? "\n" : ",\n");
+    m_IsFirstRecord = false;
+}
+
+uint32_t ChromeTraceWriter::GetThreadLane()
+{
+    const std::thread::id threadId = std::this_thread::get_id();
+    auto it = m_ThreadLanes.find(threadId);
+    if (it != m_ThreadLanes.end())
+    {
+        return it->second;
+    }
+
+    const uint32_t lane = static_cast<uint32_t>(m_ThreadLanes.size()) + 1;
+    m_ThreadLanes.emplace(threadId, lane);
+    BeginRecord();
+    m_File << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":" << g_TraceProcessId << ",\"tid\":" << lane
+           << ",\"args\":{\"name\":\"Thread " << lane << "\"}}";
+    return lane;
+}
+
+void ChromeTraceWriter::WriteEvent(const std::string& name,
+                                   const std::string& category,
+                                   double startUs,
+                                   double durationUs,
+                                   bool isInference)
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    const uint32_t lane = GetThreadLane();
+
+    BeginRecord();
+    m_File << "{\"name\":";
+    WriteJsonString(m_File, name);
+    m_File << ",\"cat\":";
+    WriteJsonString(m_File, category);
+    m_File << ",\"ph\":\"X\",\"ts\":" << startUs << ",\"dur\":" << durationUs
+           << ",\"pid\":" << g_TraceProcessId << ",\"tid\":" << lane;
+    if (isInference)
+    {
+        m_File << ",\"args\":{\"inference\":" << m_NumInferences++ << "}";
+    }
+    m_File << "}";
+}
+
+void ChromeTraceWriter::WriteCounter(const std::string& name, const std::string& series, double timeUs, uint64_t value)
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+
+    BeginRecord();
+    m_File << "{\"name\":";
+    WriteJsonString(m_File, name);
+    m_File << ",\"ph\":\"C\",\"ts\":" << timeUs << ",\"pid\":" << g_TraceProcessId << ",\"args\":{";
+    WriteJsonString(m_File, series);
+    m_File << ":" << value << "}}";
+}
+
+void ChromeTraceWriter::Flush()
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    m_File.flush();
+}
+
+} // namespace armnn
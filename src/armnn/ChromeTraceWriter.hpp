@@ -0,0 +1,62 @@
+//
+// Copyright © 2020 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace armnn
+{
+
+/// Writes events to a file in the Chrome Trace Event format, which chrome://tracing and the Perfetto UI load.
+/// Events are written as they are reported rather than when the writer is destroyed, and the JSON array format is
+/// used so that a file which has not been closed yet still loads. The writer can be shared by the profilers of
+/// several threads, each thread reporting events getting its own lane.
+class ChromeTraceWriter
+{
+public:
+    /// Creates (or truncates) the file, throwing a RuntimeException if it cannot be opened.
+    explicit ChromeTraceWriter(const std::string& fileName);
+
+    /// Terminates the array of events and closes the file.
+    ~ChromeTraceWriter();
+
+    ChromeTraceWriter(const ChromeTraceWriter&) = delete;
+    ChromeTraceWriter& operator=(const ChromeTraceWriter&) = delete;
+
+    /// Writes a complete event of the calling thread. Events nest by their times, so that a child event must be
+    /// within its parent. Inferences are numbered in the order they are written, whichever thread reports them,
+    /// and their number is added to the arguments of the event.
+    void WriteEvent(const std::string& name,
+                    const std::string& category,
+                    double startUs,
+                    double durationUs,
+                    bool isInference = false);
+
+    /// Writes the value of the counter track with the given name at the given time.
+    void WriteCounter(const std::string& name, const std::string& series, double timeUs, uint64_t value);
+
+    /// Writes the buffered events to the file.
+    void Flush();
+
+private:
+    /// Returns the lane of the calling thread, naming the lane the first time a thread is seen.
+    uint32_t GetThreadLane();
+
+    void BeginRecord();
+
+    std::mutex m_Mutex;
+    std::ofstream m_File;
+    bool m_IsFirstRecord;
+    std::map<std::thread::id, uint32_t> m_ThreadLanes;
+    int64_t m_NumInferences;
+};
+
+} // namespace armnn
@@ -0,0 +1,110 @@
+//
+// Copyright © 2020 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "LatencyHistogram.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace armnn
+{
+
+namespace
+{
+
+// Each doubling of the durations is split into SubBucketCount buckets.
+constexpr uint64_t SubBucketCount = 128;
+
+// The bucket of a duration is given by the smallest shift bringing it below 2 * SubBucketCount, and the shifted
+// duration, so that the buckets of a doubling are all as wide.
+size_t GetBucketIndex(uint64_t durationNs)
+{
+    uint64_t shift = 0;
+    while ((durationNs >> shift) >= 2 * SubBucketCount)
+    {
+        ++shift;
+    }
+    return static_cast<size_t>(shift * SubBucketCount + (durationNs >> shift));
+}
+
+// Returns the middle of the durations counted by a bucket, in nanoseconds.
+double GetBucketValueNs(size_t bucketIndex)
+{
+    const uint64_t shift = bucketIndex < 2 * SubBucketCount ? 0 : bucketIndex / SubBucketCount - 1;
+    const uint64_t subBucket = bucketIndex - shift * SubBucketCount;
+    const uint64_t lowest = subBucket << shift;
+    const uint64_t width = uint64_t(1) << shift;
+    return static_cast<double>(lowest) + static_cast<double>(width - 1) / 2.0;
+}
+
+} // anonymous namespace
+
+LatencyHistogram::LatencyHistogram()
+    : m_Count(0)
+    , m_MinUs(0.0)
+    , m_MaxUs(0.0)
+{}
+
+void LatencyHistogram::Record(double durationUs)
+{
+    durationUs = std::max(durationUs, 0.0);
+    const uint64_t durationNs = static_cast<uint64_t>(std::llround(durationUs * 1000.0));
+    const size_t bucketIndex = GetBucketIndex(durationNs);
+    if (bucketIndex >= m_Buckets.size())
+    {
+        m_Buckets.resize(bucketIndex + 1, 0);
+    }
+    ++m_Buckets[bucketIndex];
+
+    m_MinUs = m_Count == 0 ? durationUs : std::min(m_MinUs, durationUs);
+    m_MaxUs = m_Count == 0 ? durationUs : std::max(m_MaxUs, durationUs);
+    ++m_Count;
+}
+
+void LatencyHistogram::Add(const LatencyHistogram& other)
+{
+    if (other.m_Count == 0)
+    {
+        return;
+    }
+    if (other.m_Buckets.size() > m_Buckets.size())
+    {
+        m_Buckets.resize(other.m_Buckets.size(), 0);
+    }
+    for (size_t bucketIndex = 0; bucketIndex < other.m_Buckets.size(); ++bucketIndex)
+    {
+        m_Buckets[bucketIndex] += other.m_Buckets[bucketIndex];
+    }
+
+    m_MinUs = m_Count == 0 ? other.m_MinUs : std::min(m_MinUs, other.m_MinUs);
+    m_MaxUs = m_Count == 0 ? other.m_MaxUs : std::max(m_MaxUs, other.m_MaxUs);
+    m_Count += other.m_Count;
+}
+
+double LatencyHistogram::GetPercentileUs(double percentile) const
+{
+    if (m_Count == 0)
+    {
+        return 0.0;
+    }
+
+    // The rank of the duration, counting from 1, is rounded up so that the 100th percentile is the longest duration
+    const double rank = std::ceil(std::min(std::max(percentile, 0.0), 100.0) / 100.0 * static_cast<double>(m_Count));
+    const uint64_t targetCount = std::max(static_cast<uint64_t>(rank), uint64_t(1));
+
+    uint64_t count = 0;
+    for (size_t bucketIndex = 0; bucketIndex < m_Buckets.size(); ++bucketIndex)
+    {
+        count += m_Buckets[bucketIndex];
+        if (count >= targetCount)
+        {
+            const double valueUs = GetBucketValueNs(bucketIndex) / 1000.0;
+            return std::min(std::max(valueUs, m_MinUs), m_MaxUs);
+        }
+    }
+    return m_MaxUs;
+}
+
+} // namespace armnn
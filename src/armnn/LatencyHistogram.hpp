@@ -0,0 +1,46 @@
+//
+// Copyright © 2020 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace armnn
+{
+
+/// Histogram of durations with logarithmically sized buckets, in the manner of HdrHistogram: durations are counted
+/// in nanoseconds, exactly below 256ns and within 1/128 (0.8%) of their value above, so that percentiles can be
+/// reported over any number of durations in a bounded amount of memory. Buckets are only allocated up to the
+/// longest duration recorded, which is about 2000 buckets for durations in the milliseconds.
+class LatencyHistogram
+{
+public:
+    LatencyHistogram();
+
+    /// Counts a duration, negative durations being counted as 0.
+    void Record(double durationUs);
+
+    /// Counts the durations counted by another histogram, as if they had been recorded by this one.
+    void Add(const LatencyHistogram& other);
+
+    /// Returns the duration below or at which the given percentage of the recorded durations are, in microseconds,
+    /// or 0 if nothing has been recorded. The duration is the middle of its bucket, within the recorded range.
+    double GetPercentileUs(double percentile) const;
+
+    uint64_t GetCount() const { return m_Count; }
+
+    double GetMinUs() const { return m_MinUs; }
+
+    double GetMaxUs() const { return m_MaxUs; }
+
+private:
+    std::vector<uint64_t> m_Buckets;
+    uint64_t m_Count;
+    double m_MinUs;
+    double m_MaxUs;
+};
+
+} // namespace armnn
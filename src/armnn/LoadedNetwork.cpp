@@ -14,11 +14,13 @@
 #include <armnn/BackendRegistry.hpp>
 #include <armnn/Logging.hpp>
 #include <armnn/utility/Assert.hpp>
+#include <armnn/utility/PolymorphicDowncast.hpp>
 
 #include <backendsCommon/CpuTensorHandle.hpp>
 #include <armnn/backends/IMemoryManager.hpp>
 #include <backendsCommon/MemCopyWorkload.hpp>
 #include <backendsCommon/MemSyncWorkload.hpp>
+#include <backendsCommon/WorkloadUtils.hpp>
 
 #include <LabelsAndEventClasses.hpp>
 
@@ -121,6 +123,7 @@ LoadedNetwork::LoadedNetwork(std::unique_ptr<OptimizedNetwork> net,
                              m_OptimizedNetwork(std::move(net)),
                              m_IsImportEnabled(networkProperties.m_ImportEnabled),
                              m_IsExportEnabled(networkProperties.m_ExportEnabled),
+                             m_IsAsyncEnabled(networkProperties.m_AsyncEnabled),
                              m_TensorHandleFactoryRegistry(),
                              m_ProfilingService(profilingService)
 {
@@ -266,6 +269,11 @@ LoadedNetwork::LoadedNetwork(std::unique_ptr<OptimizedNetwork> net,
         timelineUtils->Commit();
     }
 
+    if (m_IsAsyncEnabled)
+    {
+        ValidateAsyncExecution();
+    }
+
     // Set up memory.
     m_OptimizedNetwork->GetGraph().AllocateDynamicBuffers();
 
@@ -374,8 +382,6 @@ const IWorkloadFactory& LoadedNetwork::GetWorkloadFactory(const Layer& layer) co
     return *workloadFactory;
 }
 
-namespace {
-
 // Non-copyable class owning accelerator-specific tensor data.
 class TensorPin
 {
@@ -465,6 +471,39 @@ private:
     std::vector<TensorPin> m_OutputTensorPins;
 };
 
+namespace {
+
+// Input and output buffers bound to a network together with the workloads copying data to and from them.
+class BoundIOBuffers final : public experimental::IBoundIOBuffers
+{
+public:
+    BoundIOBuffers(NetworkId networkId,
+                   const LoadedNetwork* loadedNetwork,
+                   const InputTensors& inputTensors,
+                   const OutputTensors& outputTensors)
+        : m_NetworkId(networkId)
+        , m_LoadedNetwork(loadedNetwork)
+        , m_WorkloadData(inputTensors, outputTensors)
+    {
+    }
+
+    NetworkId GetNetworkId() const override { return m_NetworkId; }
+
+    const LoadedNetwork* GetLoadedNetwork() const { return m_LoadedNetwork; }
+
+    const WorkloadData& GetWorkloadData() const { return m_WorkloadData; }
+
+    LoadedNetwork::WorkloadQueue& GetInputQueue() { return m_InputQueue; }
+    LoadedNetwork::WorkloadQueue& GetOutputQueue() { return m_OutputQueue; }
+
+private:
+    NetworkId m_NetworkId;
+    const LoadedNetwork* m_LoadedNetwork;
+    WorkloadData m_WorkloadData;
+    LoadedNetwork::WorkloadQueue m_InputQueue;
+    LoadedNetwork::WorkloadQueue m_OutputQueue;
+};
+
 }
 
 Status LoadedNetwork::EnqueueWorkload(const InputTensors& inputTensors,
@@ -487,30 +526,85 @@ Status LoadedNetwork::EnqueueWorkload(const InputTensors& inputTensors,
         throw InvalidArgumentException("Number of inputs provided does not match network.");
     }
 
+    m_InputQueue.clear();
+    m_OutputQueue.clear();
+    PrepareInputsAndOutputs(workloadData, m_InputQueue, m_OutputQueue);
+
+    return ExecuteQueues(m_InputQueue, m_OutputQueue);
+}
+
+std::unique_ptr<experimental::IBoundIOBuffers> LoadedNetwork::BindIOBuffers(NetworkId networkId,
+                                                                            const InputTensors& inputTensors,
+                                                                            const OutputTensors& outputTensors)
+{
+    const Graph& graph = m_OptimizedNetwork->GetGraph();
+
+    if (graph.GetNumLayers() < 2)
+    {
+        throw InvalidArgumentException("BindIOBuffers: Less than two nodes in graph");
+    }
+
+    if (m_IsImportEnabled || m_IsExportEnabled || m_IsAsyncEnabled)
+    {
+        throw InvalidArgumentException(
+            "BindIOBuffers: Not supported for networks loaded with memory import/export or async execution");
+    }
+
+    if (graph.GetNumInputs() != inputTensors.size())
+    {
+        throw InvalidArgumentException("Number of inputs provided does not match network.");
+    }
+
+    auto boundIOBuffers = std::make_unique<BoundIOBuffers>(networkId, this, inputTensors, outputTensors);
+    PrepareInputsAndOutputs(boundIOBuffers->GetWorkloadData(),
+                            boundIOBuffers->GetInputQueue(),
+                            boundIOBuffers->GetOutputQueue());
+
+    return boundIOBuffers;
+}
+
+Status LoadedNetwork::EnqueueWorkload(experimental::IBoundIOBuffers& boundIOBuffers)
+{
+    BoundIOBuffers& buffers = *PolymorphicDowncast<BoundIOBuffers*>(&boundIOBuffers);
+    if (buffers.GetLoadedNetwork() != this)
+    {
+        throw InvalidArgumentException("EnqueueWorkload: The buffers are bound to a different network");
+    }
+
+    return ExecuteQueues(buffers.GetInputQueue(), buffers.GetOutputQueue());
+}
+
+void LoadedNetwork::PrepareInputsAndOutputs(const WorkloadData& workloadData,
+                                            WorkloadQueue& inputQueue,
+                                            WorkloadQueue& outputQueue)
+{
+    const Graph& graph = m_OptimizedNetwork->GetGraph();
+
     // For each input to the network, call EnqueueInput with the data passed by the user.
     {
         ARMNN_SCOPED_PROFILING_EVENT(Compute::Undefined, "PrepareInputs");
-        m_InputQueue.clear();
-        m_InputQueue.reserve(graph.GetNumInputs());
+        inputQueue.reserve(graph.GetNumInputs());
         for (const BindableLayer* inputLayer : graph.GetInputLayers())
         {
             const TensorPin& pin = workloadData.GetInputTensorPin(inputLayer->GetBindingId());
-            EnqueueInput(*inputLayer, pin.GetTensorHandle(), pin.GetTensorInfo());
+            EnqueueInput(*inputLayer, pin.GetTensorHandle(), pin.GetTensorInfo(), inputQueue);
         }
     }
 
     // For each output to the network, call EnqueueOutput with the data passed by the user.
     {
         ARMNN_SCOPED_PROFILING_EVENT(Compute::Undefined, "PrepareOutputs");
-        m_OutputQueue.clear();
-        m_OutputQueue.reserve(graph.GetNumOutputs());
+        outputQueue.reserve(graph.GetNumOutputs());
         for (const BindableLayer* outputLayer : graph.GetOutputLayers())
         {
             const TensorPin& pin = workloadData.GetOutputTensorPin(outputLayer->GetBindingId());
-            EnqueueOutput(*outputLayer, pin.GetTensorHandle(), pin.GetTensorInfo());
+            EnqueueOutput(*outputLayer, pin.GetTensorHandle(), pin.GetTensorInfo(), outputQueue);
         }
     }
+}
 
+Status LoadedNetwork::ExecuteQueues(WorkloadQueue& inputQueue, WorkloadQueue& outputQueue)
+{
     std::unique_ptr<TimelineUtilityMethods> timelineUtils =
                         TimelineUtilityMethods::GetTimelineUtils(m_ProfilingService);
     ProfilingGuid inferenceGuid = m_ProfilingService.GetNextGuid();
@@ -535,7 +629,7 @@ Status LoadedNetwork::EnqueueWorkload(const InputTensors& inputTensors,
         }
         ARMNN_SCOPED_PROFILING_EVENT(Compute::Undefined, "Execute");
         ARMNN_SCOPED_HEAP_PROFILING("Executing");
-        executionSucceeded = Execute(timelineUtils, inferenceGuid);
+        executionSucceeded = Execute(inputQueue, outputQueue, timelineUtils, inferenceGuid);
     }
 
     if (timelineUtils)
@@ -547,7 +641,10 @@ Status LoadedNetwork::EnqueueWorkload(const InputTensors& inputTensors,
     return executionSucceeded ? Status::Success : Status::Failure;
 }
 
-void LoadedNetwork::EnqueueInput(const BindableLayer& layer, ITensorHandle* tensorHandle, const TensorInfo& tensorInfo)
+void LoadedNetwork::EnqueueInput(const BindableLayer& layer,
+                                 ITensorHandle* tensorHandle,
+                                 const TensorInfo& tensorInfo,
+                                 WorkloadQueue& inputQueue)
 {
     if (layer.GetType() != LayerType::Input)
     {
@@ -608,11 +705,14 @@ void LoadedNetwork::EnqueueInput(const BindableLayer& layer, ITensorHandle* tens
             timelineUtils->Commit();
         }
 
-        m_InputQueue.push_back(move(inputWorkload));
+        inputQueue.push_back(move(inputWorkload));
     }
 }
 
-void LoadedNetwork::EnqueueOutput(const BindableLayer& layer, ITensorHandle* tensorHandle, const TensorInfo& tensorInfo)
+void LoadedNetwork::EnqueueOutput(const BindableLayer& layer,
+                                  ITensorHandle* tensorHandle,
+                                  const TensorInfo& tensorInfo,
+                                  WorkloadQueue& outputQueue)
 {
     if (layer.GetType() != LayerType::Output)
     {
@@ -667,7 +767,7 @@ void LoadedNetwork::EnqueueOutput(const BindableLayer& layer, ITensorHandle* ten
                     info.m_InputTensorInfos.push_back(inputTensorInfo);
                     auto syncWorkload = std::make_unique<SyncMemGenericWorkload>(syncDesc, info);
                     ARMNN_ASSERT_MSG(syncWorkload, "No sync workload created");
-                    m_OutputQueue.push_back(move(syncWorkload));
+                    outputQueue.push_back(move(syncWorkload));
                 }
                 else
                 {
@@ -695,7 +795,7 @@ void LoadedNetwork::EnqueueOutput(const BindableLayer& layer, ITensorHandle* ten
             timelineUtils->Commit();
         }
 
-        m_OutputQueue.push_back(move(outputWorkload));
+        outputQueue.push_back(move(outputWorkload));
     }
 }
 
@@ -720,6 +820,18 @@ void LoadedNetwork::AllocateWorkingMemory(std::lock_guard<std::mutex>& lock)
     }
     m_TensorHandleFactoryRegistry.AquireMemory();
     m_IsWorkingMemAllocated = true;
+
+    // The memory managers plan where the tensors go when the memory is acquired, sharing memory between them
+    size_t workingMemorySize = m_TensorHandleFactoryRegistry.GetPlannedPeakMemory();
+    for (auto&& workloadFactory : m_WorkloadFactories)
+    {
+        IBackendInternal::IMemoryManagerSharedPtr memoryManager = workloadFactory.second.second;
+        if (memoryManager)
+        {
+            workingMemorySize += memoryManager->GetPlannedPeakMemory();
+        }
+    }
+    m_Profiler->RecordCounter("Working Memory", "bytes", workingMemorySize);
 }
 
 void LoadedNetwork::FreeWorkingMemory()
@@ -740,9 +852,12 @@ void LoadedNetwork::FreeWorkingMemory()
     }
     m_TensorHandleFactoryRegistry.ReleaseMemory();
     m_IsWorkingMemAllocated = false;
+    m_Profiler->RecordCounter("Working Memory", "bytes", 0);
 }
 
-bool LoadedNetwork::Execute(std::unique_ptr<TimelineUtilityMethods>& timelineUtils,
+bool LoadedNetwork::Execute(WorkloadQueue& inputQueue,
+                            WorkloadQueue& outputQueue,
+                            std::unique_ptr<TimelineUtilityMethods>& timelineUtils,
                             profiling::ProfilingGuid inferenceGuid)
 {
     bool success = true;
@@ -776,9 +891,9 @@ bool LoadedNetwork::Execute(std::unique_ptr<TimelineUtilityMethods>& timelineUti
             }
         };
 
-        ExecuteQueue(m_InputQueue);
+        ExecuteQueue(inputQueue);
         ExecuteQueue(m_WorkloadQueue);
-        ExecuteQueue(m_OutputQueue);
+        ExecuteQueue(outputQueue);
     }
     catch (const RuntimeException& error)
     {
@@ -792,6 +907,320 @@ bool LoadedNetwork::Execute(std::unique_ptr<TimelineUtilityMethods>& timelineUti
     return success;
 }
 
+void LoadedNetwork::ValidateAsyncExecution() const
+{
+    if (m_IsImportEnabled || m_IsExportEnabled)
+    {
+        throw InvalidArgumentException("Memory import and export are not supported for async enabled networks");
+    }
+
+    for (auto&& backend : m_Backends)
+    {
+        if (!backend.second->SupportsAsyncExecution())
+        {
+            throw InvalidArgumentException(
+                fmt::format("Backend {} does not support async execution", backend.first.Get()));
+        }
+    }
+
+    // Each working memory handle gets its own plain tensors, so sub-tensors of a shared parent
+    // (as used by some backends to make Concat and Splitter zero-copy) cannot be reproduced.
+    for (auto&& layer : m_OptimizedNetwork->GetGraph())
+    {
+        for (auto&& slot : layer->GetOutputSlots())
+        {
+            ITensorHandle* tensorHandle = slot.GetOutputHandler().GetData();
+            if (tensorHandle && tensorHandle->GetParent())
+            {
+                throw InvalidArgumentException(
+                    fmt::format("Layer {} uses sub-tensors which are not supported for async execution",
+                                layer->GetNameStr()));
+            }
+        }
+    }
+}
+
+std::unique_ptr<ITensorHandle> LoadedNetwork::CreateWorkingTensorHandle(const OutputSlot& slot) const
+{
+    const TensorInfo& tensorInfo = slot.GetTensorInfo();
+    ITensorHandleFactory::FactoryId factoryId = slot.GetTensorHandleFactoryId();
+
+    if (factoryId == ITensorHandleFactory::LegacyFactoryId)
+    {
+        auto it = m_WorkloadFactories.find(slot.GetOwningLayer().GetBackendId());
+        ARMNN_ASSERT(it != m_WorkloadFactories.end());
+
+        ARMNN_NO_DEPRECATE_WARN_BEGIN
+        return it->second.first->CreateTensorHandle(tensorInfo);
+        ARMNN_NO_DEPRECATE_WARN_END
+    }
+
+    ITensorHandleFactory* handleFactory = m_TensorHandleFactoryRegistry.GetFactory(factoryId);
+    ARMNN_ASSERT(handleFactory);
+    return handleFactory->CreateTensorHandle(tensorInfo);
+}
+
+std::unique_ptr<experimental::IWorkingMemHandle> LoadedNetwork::CreateWorkingMemHandle(NetworkId networkId)
+{
+    Graph& order = m_OptimizedNetwork->GetGraph().TopologicalSort();
+
+    std::unordered_map<const OutputSlot*, ITensorHandle*> slotHandles;
+    std::vector<std::unique_ptr<ITensorHandle>> tensorHandles;
+    std::vector<experimental::WorkingMemDescriptor> workingMemDescriptors;
+    experimental::WorkingMemHandle::TensorHandleMap inputHandles;
+    experimental::WorkingMemHandle::TensorHandleMap outputHandles;
+    uint64_t workingMemorySize = 0;
+
+    workingMemDescriptors.reserve(m_WorkloadQueue.size());
+
+    // Layers are visited in the same order the workload queue was built in the constructor,
+    // so the descriptors line up with m_WorkloadQueue.
+    for (auto&& layer : order)
+    {
+        for (auto&& slot : layer->GetOutputSlots())
+        {
+            if (layer->GetType() == LayerType::Constant)
+            {
+                // Constant tensors are read-only and can be shared by all working memory handles.
+                slotHandles[&slot] = slot.GetOutputHandler().GetData();
+            }
+            else
+            {
+                tensorHandles.push_back(CreateWorkingTensorHandle(slot));
+                slotHandles[&slot] = tensorHandles.back().get();
+                workingMemorySize += slot.GetTensorInfo().GetNumBytes();
+            }
+        }
+
+        switch (layer->GetType())
+        {
+        case LayerType::Input:
+            {
+                auto inputLayer = PolymorphicDowncast<const BindableLayer*>(layer);
+                inputHandles[inputLayer->GetBindingId()] = slotHandles.at(&layer->GetOutputSlot(0));
+                break;
+            }
+        case LayerType::Output:
+            {
+                auto outputLayer = PolymorphicDowncast<const BindableLayer*>(layer);
+                outputHandles[outputLayer->GetBindingId()] =
+                    slotHandles.at(layer->GetInputSlot(0).GetConnectedOutputSlot());
+                break;
+            }
+        default:
+            {
+                experimental::WorkingMemDescriptor workingMemDescriptor;
+                for (auto&& inputSlot : layer->GetInputSlots())
+                {
+                    workingMemDescriptor.m_Inputs.push_back(slotHandles.at(inputSlot.GetConnectedOutputSlot()));
+                }
+                for (auto&& outputSlot : layer->GetOutputSlots())
+                {
+                    workingMemDescriptor.m_Outputs.push_back(slotHandles.at(&outputSlot));
+                }
+                workingMemDescriptors.push_back(std::move(workingMemDescriptor));
+                break;
+            }
+        }
+    }
+
+    // The working memory of the handles is reported from their creation to their destruction, which may happen
+    // after the network is unloaded
+    std::shared_ptr<Profiler> profiler = m_Profiler;
+    std::shared_ptr<std::atomic<uint64_t>> workingMemHandlesSize = m_WorkingMemHandlesSize;
+    profiler->RecordCounter("Working Memory", "bytes", *workingMemHandlesSize += workingMemorySize);
+    auto onDestruction = [profiler, workingMemHandlesSize, workingMemorySize]()
+    {
+        profiler->RecordCounter("Working Memory", "bytes", *workingMemHandlesSize -= workingMemorySize);
+    };
+
+    return std::make_unique<experimental::WorkingMemHandle>(networkId,
+                                                            std::move(workingMemDescriptors),
+                                                            std::move(inputHandles),
+                                                            std::move(outputHandles),
+                                                            std::move(tensorHandles),
+                                                            onDestruction);
+}
+
+void LoadedNetwork::EnqueueInput(const BindableLayer& layer,
+                                 const ConstTensor& inputTensor,
+                                 experimental::WorkingMemHandle& workingMemHandle)
+{
+    if (layer.GetType() != LayerType::Input)
+    {
+        throw InvalidArgumentException("EnqueueInput: given layer not an InputLayer");
+    }
+
+    if (inputTensor.GetMemoryArea() == nullptr)
+    {
+        throw InvalidArgumentException("EnqueueInput: input tensor memory must not be NULL");
+    }
+
+    ITensorHandle* outputTensorHandle = workingMemHandle.GetInputHandle(layer.GetBindingId());
+    ConstPassthroughCpuTensorHandle inputTensorHandle(inputTensor.GetInfo(), inputTensor.GetMemoryArea());
+
+    auto copyFunc = [](void* dst, const void* src, size_t size)
+    {
+        memcpy(dst, src, size);
+    };
+
+    CopyTensorContentsGeneric(&inputTensorHandle, outputTensorHandle, copyFunc);
+}
+
+void LoadedNetwork::EnqueueOutput(const BindableLayer& layer,
+                                  const Tensor& outputTensor,
+                                  experimental::WorkingMemHandle& workingMemHandle)
+{
+    if (layer.GetType() != LayerType::Output)
+    {
+        throw InvalidArgumentException("EnqueueOutput: given layer not an OutputLayer");
+    }
+
+    if (outputTensor.GetMemoryArea() == nullptr)
+    {
+        throw InvalidArgumentException("EnqueueOutput: output tensor memory must not be NULL");
+    }
+
+    const ITensorHandle* inputTensorHandle = workingMemHandle.GetOutputHandle(layer.GetBindingId());
+    PassthroughCpuTensorHandle outputTensorHandle(outputTensor.GetInfo(), outputTensor.GetMemoryArea());
+
+    auto copyFunc = [](void* dst, const void* src, size_t size)
+    {
+        memcpy(dst, src, size);
+    };
+
+    CopyTensorContentsGeneric(inputTensorHandle, &outputTensorHandle, copyFunc);
+}
+
+Status LoadedNetwork::Execute(const InputTensors& inputTensors,
+                              const OutputTensors& outputTensors,
+                              experimental::IWorkingMemHandle& iWorkingMemHandle)
+{
+    const Graph& graph = m_OptimizedNetwork->GetGraph();
+
+    // Walk graph to determine the order of execution.
+    if (graph.GetNumLayers() < 2)
+    {
+        ARMNN_LOG(warning) << "IRuntime::Execute()::Less than two nodes in graph";
+        return Status::Failure;
+    }
+
+    if (graph.GetNumInputs() != inputTensors.size())
+    {
+        throw InvalidArgumentException("Number of inputs provided does not match network.");
+    }
+
+    auto FindTensor = [](LayerBindingId id, const auto& tensors, char const* bindingPointDesc)
+    {
+        auto it = std::find_if(tensors.begin(), tensors.end(),
+                               [id](const auto& tensorPair) { return tensorPair.first == id; });
+        if (it == tensors.end())
+        {
+            throw InvalidArgumentException(fmt::format("No tensor supplied for {0} {1}", bindingPointDesc, id));
+        }
+        return it->second;
+    };
+
+    experimental::WorkingMemHandle& workingMemHandle =
+        *PolymorphicDowncast<experimental::WorkingMemHandle*>(&iWorkingMemHandle);
+    std::lock_guard<std::mutex> lockGuard(workingMemHandle.GetMutex());
+
+    if (!workingMemHandle.IsAllocated())
+    {
+        ARMNN_SCOPED_PROFILING_EVENT(Compute::Undefined, "Working Memory Allocation");
+        workingMemHandle.Allocate();
+    }
+
+    // For each input to the network, copy the data passed by the user into the working memory.
+    {
+        ARMNN_SCOPED_PROFILING_EVENT(Compute::Undefined, "PrepareInputs");
+        for (const BindableLayer* inputLayer : graph.GetInputLayers())
+        {
+            EnqueueInput(*inputLayer, FindTensor(inputLayer->GetBindingId(), inputTensors, "input"),
+                         workingMemHandle);
+        }
+    }
+
+    std::unique_ptr<TimelineUtilityMethods> timelineUtils =
+                        TimelineUtilityMethods::GetTimelineUtils(m_ProfilingService);
+    ProfilingGuid inferenceGuid = m_ProfilingService.GetNextGuid();
+    if (timelineUtils)
+    {
+        // Add inference timeline trace if profiling is enabled.
+        ProfilingGuid networkGuid = m_OptimizedNetwork->GetGuid();
+        timelineUtils->CreateTypedEntity(inferenceGuid, LabelsAndEventClasses::INFERENCE_GUID);
+        timelineUtils->CreateRelationship(ProfilingRelationshipType::RetentionLink,
+                                          networkGuid,
+                                          inferenceGuid,
+                                          LabelsAndEventClasses::EXECUTION_OF_GUID);
+        timelineUtils->RecordEvent(inferenceGuid, LabelsAndEventClasses::ARMNN_PROFILING_SOL_EVENT_CLASS);
+    }
+
+    bool executionSucceeded = true;
+
+    {
+        if (m_ProfilingService.IsProfilingEnabled())
+        {
+            m_ProfilingService.IncrementCounterValue(armnn::profiling::INFERENCES_RUN);
+        }
+        ARMNN_SCOPED_PROFILING_EVENT(Compute::Undefined, "Execute");
+        ARMNN_SCOPED_HEAP_PROFILING("Executing");
+
+        auto Fail = [&](const std::exception& error)
+        {
+            ARMNN_LOG(error) << "An error occurred attempting to execute a workload: " << error.what();
+            executionSucceeded = false;
+        };
+
+        try
+        {
+            ProfilingDynamicGuid workloadInferenceID(0);
+            for (unsigned int i = 0; i < m_WorkloadQueue.size(); ++i)
+            {
+                auto& workload = m_WorkloadQueue[i];
+                if (timelineUtils)
+                {
+                    workloadInferenceID = timelineUtils->RecordWorkloadInferenceAndStartOfLifeEvent(
+                        workload->GetGuid(), inferenceGuid);
+                }
+                workload->ExecuteAsync(workingMemHandle.GetWorkingMemDescriptorAt(i));
+                if (timelineUtils)
+                {
+                    timelineUtils->RecordEndOfLifeEvent(workloadInferenceID);
+                }
+            }
+        }
+        catch (const RuntimeException& error)
+        {
+            Fail(error);
+        }
+        catch (const std::runtime_error& error)
+        {
+            Fail(error);
+        }
+    }
+
+    // For each output of the network, copy the result out of the working memory.
+    if (executionSucceeded)
+    {
+        ARMNN_SCOPED_PROFILING_EVENT(Compute::Undefined, "PrepareOutputs");
+        for (const BindableLayer* outputLayer : graph.GetOutputLayers())
+        {
+            EnqueueOutput(*outputLayer, FindTensor(outputLayer->GetBindingId(), outputTensors, "output"),
+                          workingMemHandle);
+        }
+    }
+
+    if (timelineUtils)
+    {
+        // Add end of life of the inference timeline if profiling is enabled.
+        timelineUtils->RecordEvent(inferenceGuid, LabelsAndEventClasses::ARMNN_PROFILING_EOL_EVENT_CLASS);
+        timelineUtils->Commit();
+    }
+
+    return executionSucceeded ? Status::Success : Status::Failure;
+}
+
 void LoadedNetwork::RegisterDebugCallback(const DebugCallbackFunction& func)
 {
     for (auto&& workloadPtr: m_WorkloadQueue)
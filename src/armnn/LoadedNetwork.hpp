@@ -4,12 +4,14 @@
 //
 #pragma once
 
+#include <armnn/IBoundIOBuffers.hpp>
 #include <armnn/Tensor.hpp>
 #include <armnn/Types.hpp>
 
 #include "Network.hpp"
 #include "LayerFwd.hpp"
 #include "Profiling.hpp"
+#include "WorkingMemHandle.hpp"
 
 #include <armnn/backends/IBackendInternal.hpp>
 #include <backendsCommon/TensorHandleFactoryRegistry.hpp>
@@ -18,6 +20,7 @@
 #include <ProfilingService.hpp>
 #include <TimelineUtilityMethods.hpp>
 
+#include <atomic>
 #include <mutex>
 #include <unordered_map>
 
@@ -31,6 +34,8 @@ namespace cl
 namespace armnn
 {
 
+class WorkloadData;
+
 class LoadedNetwork
 {
 public:
@@ -42,6 +47,23 @@ public:
 
     Status EnqueueWorkload(const InputTensors& inputTensors, const OutputTensors& outputTensors);
 
+    /// Creates the workloads copying the data in and out of the given buffers once, for repeated execution.
+    std::unique_ptr<experimental::IBoundIOBuffers> BindIOBuffers(NetworkId networkId,
+                                                                 const InputTensors& inputTensors,
+                                                                 const OutputTensors& outputTensors);
+
+    /// Executes the network using buffers returned by BindIOBuffers().
+    Status EnqueueWorkload(experimental::IBoundIOBuffers& boundIOBuffers);
+
+    /// Single thread execution of the loaded network using the intermediate tensors of the given working memory.
+    /// Executions using different working memory handles may run concurrently.
+    Status Execute(const InputTensors& inputTensors,
+                   const OutputTensors& outputTensors,
+                   experimental::IWorkingMemHandle& workingMemHandle);
+
+    /// Creates a working memory handle holding a private copy of every non-constant tensor of the network.
+    std::unique_ptr<experimental::IWorkingMemHandle> CreateWorkingMemHandle(NetworkId networkId);
+
     static std::unique_ptr<LoadedNetwork> MakeLoadedNetwork(std::unique_ptr<OptimizedNetwork> net,
                                                             std::string & errorMessage,
                                                             const INetworkProperties& networkProperties,
@@ -60,6 +82,12 @@ public:
 
     profiling::ProfilingGuid GetNetworkGuid();
 
+    bool IsAsyncEnabled() const { return m_IsAsyncEnabled; }
+
+    /// Serialises the executions of a network which is not async enabled, as they share its workloads and working
+    /// memory. Held by the Runtime for the whole of an EnqueueWorkload().
+    std::mutex& GetExecutionMutex() { return m_ExecutionMutex; }
+
 private:
     void AllocateWorkingMemory(std::lock_guard<std::mutex>& lock);
 
@@ -67,13 +95,38 @@ private:
                   const INetworkProperties& networkProperties,
                   profiling::ProfilingService& profilingService);
 
-    void EnqueueInput(const BindableLayer& layer, ITensorHandle* tensorHandle, const TensorInfo& tensorInfo);
+    void EnqueueInput(const BindableLayer& layer,
+                      ITensorHandle* tensorHandle,
+                      const TensorInfo& tensorInfo,
+                      WorkloadQueue& inputQueue);
 
-    void EnqueueOutput(const BindableLayer& layer, ITensorHandle* tensorHandle, const TensorInfo& tensorInfo);
+    void EnqueueOutput(const BindableLayer& layer,
+                       ITensorHandle* tensorHandle,
+                       const TensorInfo& tensorInfo,
+                       WorkloadQueue& outputQueue);
 
-    bool Execute(std::unique_ptr<profiling::TimelineUtilityMethods>& timelineUtils,
-                 profiling::ProfilingGuid inferenceGuid);
+    void PrepareInputsAndOutputs(const WorkloadData& workloadData,
+                                 WorkloadQueue& inputQueue,
+                                 WorkloadQueue& outputQueue);
 
+    void EnqueueInput(const BindableLayer& layer,
+                      const ConstTensor& inputTensor,
+                      experimental::WorkingMemHandle& workingMemHandle);
+
+    void EnqueueOutput(const BindableLayer& layer,
+                       const Tensor& outputTensor,
+                       experimental::WorkingMemHandle& workingMemHandle);
+
+    std::unique_ptr<ITensorHandle> CreateWorkingTensorHandle(const OutputSlot& slot) const;
+
+    void ValidateAsyncExecution() const;
+
+    Status ExecuteQueues(WorkloadQueue& inputQueue, WorkloadQueue& outputQueue);
+
+    bool Execute(WorkloadQueue& inputQueue,
+                 WorkloadQueue& outputQueue,
+                 std::unique_ptr<profiling::TimelineUtilityMethods>& timelineUtils,
+                 profiling::ProfilingGuid inferenceGuid);
 
     const IWorkloadFactory& GetWorkloadFactory(const Layer& layer) const;
 
@@ -94,10 +147,15 @@ private:
     std::shared_ptr<Profiler> m_Profiler;
 
     mutable std::mutex m_WorkingMemMutex;
+    std::mutex m_ExecutionMutex;
 
     bool m_IsWorkingMemAllocated=false;
+
+    /// Bytes of working memory held by the WorkingMemHandles of the network, shared with the handles.
+    std::shared_ptr<std::atomic<uint64_t>> m_WorkingMemHandlesSize = std::make_shared<std::atomic<uint64_t>>(0);
     bool m_IsImportEnabled=false;
     bool m_IsExportEnabled=false;
+    bool m_IsAsyncEnabled=false;
 
     TensorHandleFactoryRegistry m_TensorHandleFactoryRegistry;
 
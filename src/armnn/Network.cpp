@@ -1042,6 +1042,12 @@ IOptimizedNetworkPtr Optimize(const INetwork& inNetwork,
     // Infer the tensor infos for all output slots. Throws an exception on failure
     optGraph.InferTensorInfos();
 
+    // Evaluate the layers computed from constants only once, rather than on every inference
+    Optimizer::Pass(optGraph, MakeOptimizations(FoldConstants()));
+
+    // Switch the layers between the NCHW/NHWC conversions to the other data layout where this copies fewer bytes
+    Optimizer::Pass(optGraph, MakeOptimizations(PropagateDataLayout()));
+
     // Perform optimisation passes
     Optimizer::Pass(optGraph, MakeOptimizations(SquashEqualPermuteSiblings(),
                                                 SquashEqualTransposeSiblings(),
@@ -32,6 +32,7 @@ public:
     ~Network();
 
     const Graph& GetGraph() const { return *m_Graph; }
+    Graph& GetGraph() { return *m_Graph; }
 
     Status PrintGraph() override;
 
@@ -292,6 +293,7 @@ public:
     profiling::ProfilingGuid GetGuid() const final { return m_Guid; };
 
     Graph& GetGraph() { return *m_Graph; }
+    const Graph& GetGraph() const { return *m_Graph; }
     ModelOptions& GetModelOptions() { return m_ModelOptions; }
 
 private:
@@ -4,39 +4,347 @@
 //
 #include "Optimizer.hpp"
 #include "Observable.hpp"
+#include "Profiling.hpp"
 #include "optimizations/All.hpp"
 
+#include <algorithm>
+#include <cstdlib>
+#include <limits>
+#include <set>
+#include <typeinfo>
+#include <unordered_map>
+
+#if defined(__GNUC__)
+#include <cxxabi.h>
+#endif
+
 namespace armnn
 {
 
+namespace
+{
+
+/// Instrument reporting the time spent running one optimization over a whole pass, accumulated while the pass
+/// alternates between the optimizations rather than measured between the start and the end of its event.
+class AccumulatedWallClockTimer : public Instrument
+{
+public:
+    explicit AccumulatedWallClockTimer(WallClockTimer::clock::duration duration)
+        : m_Duration(duration)
+    {}
+
+    void Start() override {}
+
+    void Stop() override {}
+
+    const char* GetName() const override
+    {
+        return "AccumulatedWallClockTimer";
+    }
+
+    std::vector<Measurement> GetMeasurements() const override
+    {
+        return { { WallClockTimer::WALL_CLOCK_TIME,
+                   std::chrono::duration<double, std::micro>(m_Duration).count(),
+                   Measurement::Unit::TIME_US } };
+    }
+
+private:
+    WallClockTimer::clock::duration m_Duration;
+};
+
+/// Returns the name an optimization is reported with to the profiler: its type, demangled where the compiler allows.
+std::string GetOptimizationName(const Optimization& optimization)
+{
+    std::string name = typeid(optimization).name();
+#if defined(__GNUC__)
+    int status = 0;
+    std::unique_ptr<char, void(*)(void*)> demangled(abi::__cxa_demangle(name.c_str(), nullptr, nullptr, &status),
+                                                    std::free);
+    if (status == 0)
+    {
+        name = demangled.get();
+    }
+#endif
+    const std::string prefixes[] = { "armnn::optimizations::", "armnn::" };
+    for (const std::string& prefix : prefixes)
+    {
+        for (size_t pos = name.find(prefix); pos != std::string::npos; pos = name.find(prefix, pos))
+        {
+            name.erase(pos, prefix.size());
+        }
+    }
+    return name;
+}
+
+/// Layers left to visit in a pass, ordered by keys following the topological order of the graph. The layers added
+/// by an optimization are given keys between those of the layers they are connected to, so the graph is only sorted
+/// again when there is no room left between them rather than whenever it changes.
+class LayerWorklist
+{
+public:
+    explicit LayerWorklist(Graph& graph)
+        : m_Graph(graph)
+        , m_AddedObserver(*this, GraphEvent::LayerAdded)
+        , m_ErasedObserver(*this, GraphEvent::LayerErased)
+    {
+        Renumber(std::vector<Layer*>(graph.begin(), graph.end()));
+    }
+
+    /// Removes the last layer to visit in topological order from the worklist and returns it, or nullptr if every
+    /// layer has been visited.
+    Layer* PopLast()
+    {
+        if (m_Pending.empty())
+        {
+            return nullptr;
+        }
+        auto last = std::prev(m_Pending.end());
+        Layer* layer = last->second;
+        m_Pending.erase(last);
+        return layer;
+    }
+
+    /// Gives keys to the layers added to the graph since the last call, and queues those placed before the layer
+    /// being visited, as a pass over the sorted graph would reach them after it.
+    void QueueAddedLayers(const Layer& visitedLayer)
+    {
+        if (m_Added.empty())
+        {
+            return;
+        }
+
+        bool ordered = true;
+        for (Layer* layer : m_Added)
+        {
+            m_Keys[layer] = GetKeyBetweenNeighbours(*layer);
+        }
+        for (Layer* layer : m_Added)
+        {
+            ordered = ordered && IsOrderedWithNeighbours(*layer);
+        }
+
+        if (ordered)
+        {
+            for (Layer* layer : m_Added)
+            {
+                if (m_Keys[layer] < m_Keys[&visitedLayer])
+                {
+                    m_Pending.emplace(m_Keys[layer], layer);
+                }
+            }
+        }
+        else
+        {
+            std::vector<Layer*> pending;
+            for (const auto& entry : m_Pending)
+            {
+                pending.push_back(entry.second);
+            }
+            for (Layer* layer : m_Added)
+            {
+                pending.push_back(layer);
+            }
+            Renumber(pending);
+
+            // Added layers are only kept if they come before the visited layer in the new order
+            for (Layer* layer : m_Added)
+            {
+                if (m_Keys[layer] > m_Keys[&visitedLayer])
+                {
+                    m_Pending.erase({ m_Keys[layer], layer });
+                }
+            }
+        }
+        m_Added.clear();
+    }
+
+private:
+    /// Forwards the changes to the graph to the worklist.
+    class Observer : public IGraphObservable
+    {
+    public:
+        Observer(LayerWorklist& worklist, GraphEvent event)
+            : m_Worklist(worklist)
+            , m_Event(event)
+        {
+            m_Worklist.m_Graph.AttachObservable(this, m_Event);
+        }
+
+        ~Observer()
+        {
+            m_Worklist.m_Graph.DetachObservable(this, m_Event);
+        }
+
+        void Update(Layer* graphLayer) override
+        {
+            if (m_Event == GraphEvent::LayerAdded)
+            {
+                m_Worklist.m_Added.push_back(graphLayer);
+            }
+            else
+            {
+                m_Worklist.Remove(graphLayer);
+            }
+        }
+
+    private:
+        LayerWorklist& m_Worklist;
+        GraphEvent m_Event;
+    };
+
+    /// Sorts the graph and gives the layers keys in the new order, with the given layers left to visit.
+    void Renumber(const std::vector<Layer*>& pending)
+    {
+        m_Keys.clear();
+        double key = 0.0;
+        for (Layer* layer : m_Graph.TopologicalSort())
+        {
+            m_Keys[layer] = key;
+            key += 1.0;
+        }
+
+        m_Pending.clear();
+        for (Layer* layer : pending)
+        {
+            m_Pending.emplace(m_Keys[layer], layer);
+        }
+    }
+
+    void Remove(Layer* layer)
+    {
+        auto key = m_Keys.find(layer);
+        if (key != m_Keys.end())
+        {
+            m_Pending.erase({ key->second, layer });
+            m_Keys.erase(key);
+        }
+        m_Added.erase(std::remove(m_Added.begin(), m_Added.end(), layer), m_Added.end());
+    }
+
+    /// Returns a key between the greatest key of the layers connected to the inputs of a layer and the smallest key
+    /// of the layers connected to its outputs, ignoring the layers without keys yet.
+    double GetKeyBetweenNeighbours(const Layer& layer) const
+    {
+        const double lowest = std::numeric_limits<double>::lowest();
+        const double highest = std::numeric_limits<double>::max();
+
+        double lower = lowest;
+        for (auto&& inputSlot : layer.GetInputSlots())
+        {
+            if (const OutputSlot* connectedSlot = inputSlot.GetConnectedOutputSlot())
+            {
+                lower = std::max(lower, GetKey(connectedSlot->GetOwningLayer(), lowest));
+            }
+        }
+
+        double upper = highest;
+        for (auto&& outputSlot : layer.GetOutputSlots())
+        {
+            for (const InputSlot* connection : outputSlot.GetConnections())
+            {
+                upper = std::min(upper, GetKey(connection->GetOwningLayer(), highest));
+            }
+        }
+
+        if (lower != lowest && upper != highest)
+        {
+            return lower + (upper - lower) / 2.0;
+        }
+        if (lower != lowest)
+        {
+            return lower + 1.0;
+        }
+        if (upper != highest)
+        {
+            return upper - 1.0;
+        }
+        return lowest;
+    }
+
+    bool IsOrderedWithNeighbours(const Layer& layer) const
+    {
+        const double key = m_Keys.at(&layer);
+        for (auto&& inputSlot : layer.GetInputSlots())
+        {
+            const OutputSlot* connectedSlot = inputSlot.GetConnectedOutputSlot();
+            if (connectedSlot && !(GetKey(connectedSlot->GetOwningLayer(), key - 1.0) < key))
+            {
+                return false;
+            }
+        }
+        for (auto&& outputSlot : layer.GetOutputSlots())
+        {
+            for (const InputSlot* connection : outputSlot.GetConnections())
+            {
+                if (!(key < GetKey(connection->GetOwningLayer(), key + 1.0)))
+                {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    double GetKey(const Layer& layer, double keyIfUnknown) const
+    {
+        auto key = m_Keys.find(&layer);
+        return key != m_Keys.end() ? key->second : keyIfUnknown;
+    }
+
+    Graph& m_Graph;
+    std::unordered_map<const Layer*, double> m_Keys;
+    std::set<std::pair<double, Layer*>> m_Pending;
+    std::vector<Layer*> m_Added;
+
+    Observer m_AddedObserver;
+    Observer m_ErasedObserver;
+};
+
+} // anonymous namespace
+
 Optimizer::Optimizer()
 {
 }
 
 void Optimizer::Pass(Graph& graph, const Optimizations& optimizations)
 {
+    ARMNN_SCOPED_PROFILING_EVENT(Compute::Undefined, "Optimizer::Pass");
+
     // Create observables to observe changes to the graph
     AddedLayerObservable addedLayerObservable(graph);
     ErasedLayerNamesObservable erasedLayerNamesObservable(graph);
 
-    bool graphNeedsSorting = false;
-    auto it = graph.TopologicalSort().end();
+    // The optimizations are only timed when the profiler reports it
+    Profiler* profiler = ProfilerManager::GetInstance().GetProfiler();
+    const bool timeOptimizations = profiler && profiler->IsProfilingEnabled();
+    std::vector<WallClockTimer::clock::duration> optimizationTimes(optimizations.size(),
+                                                                   WallClockTimer::clock::duration::zero());
 
-    // Calls TopologicalSort() for every iteration to re-order the list in case layers were added/removed.
-    while (it != graph.TopologicalSort().begin())
+    // Visits the layers from the last one in topological order, each of them once. The layers added by the
+    // optimizations are visited as well if they are placed before the layer being visited.
+    LayerWorklist worklist(graph);
+    while (Layer* layer = worklist.PopLast())
     {
-        --it;
-        for (auto&& optimization : optimizations)
+        for (size_t i = 0; i < optimizations.size(); ++i)
         {
-            ARMNN_ASSERT(*it);
-            optimization->Run(graph, **it);
+            if (timeOptimizations)
+            {
+                const auto start = WallClockTimer::clock::now();
+                optimizations[i]->Run(graph, *layer);
+                optimizationTimes[i] += WallClockTimer::clock::now() - start;
+            }
+            else
+            {
+                optimizations[i]->Run(graph, *layer);
+            }
+
+            worklist.QueueAddedLayers(*layer);
 
-            if ((*it)->IsOutputUnconnected())
+            const bool eraseLayer = layer->IsOutputUnconnected();
+            if (eraseLayer)
             {
-                auto next = std::next(graph.GetPosInGraph(**it));
-                graph.EraseLayer(it);
-                it = next;
-                graphNeedsSorting = true;
+                graph.EraseLayer(layer);
             }
 
             // Add the names of erased layers as related layers to the new added layers
@@ -51,13 +359,23 @@ void Optimizer::Pass(Graph& graph, const Optimizations& optimizations)
             erasedLayerNamesObservable.Clear();
             addedLayerObservable.Clear();
 
-            if (graphNeedsSorting)
+            if (eraseLayer)
             {
-                graphNeedsSorting = false;
                 break;
             }
         }
     }
+
+    // Leaves the graph sorted, as the layers are expected to be after a pass
+    graph.TopologicalSort();
+
+    for (size_t i = 0; timeOptimizations && i < optimizations.size(); ++i)
+    {
+        // The name changes from one optimization to the next, so it cannot be interned once by the macros
+        ScopedProfilingEvent event(Compute::Undefined,
+                                   GetOptimizationName(*optimizations[i]),
+                                   AccumulatedWallClockTimer(optimizationTimes[i]));
+    }
 }
 
 } // namespace armnn
@@ -5,6 +5,7 @@
 #include "Profiling.hpp"
 
 #include <armnn/BackendId.hpp>
+#include <armnn/Exceptions.hpp>
 #include <armnn/utility/Assert.hpp>
 #include <armnn/utility/IgnoreUnused.hpp>
 
@@ -19,7 +20,7 @@
 #include <iostream>
 #include <fstream>
 #include <map>
-#include <stack>
+#include <utility>
 
 namespace armnn
 {
@@ -80,31 +81,127 @@ std::vector<Measurement> FindKernelMeasurements(const Event* event)
     return measurements;
 }
 
+const WallClockTimer* FindWallClockTimer(const Event* event)
+{
+    for (const auto& instrument : event->GetInstruments())
+    {
+        if (const WallClockTimer* timer = dynamic_cast<const WallClockTimer*>(instrument.get()))
+        {
+            return timer;
+        }
+    }
+    return nullptr;
+}
+
+// Replays the wall clock times of an event recorded in ring buffer mode, under the names used by WallClockTimer.
+class RecordedWallClockTimer : public Instrument
+{
+public:
+    RecordedWallClockTimer(double durationUs, double startUs, double stopUs)
+        : m_DurationUs(durationUs)
+        , m_StartUs(startUs)
+        , m_StopUs(stopUs)
+    {}
+
+    void Start() override {}
+
+    void Stop() override {}
+
+    const char* GetName() const override
+    {
+        return "WallClockTimer";
+    }
+
+    std::vector<Measurement> GetMeasurements() const override
+    {
+        return { { WallClockTimer::WALL_CLOCK_TIME,       m_DurationUs, Measurement::Unit::TIME_US },
+                 { WallClockTimer::WALL_CLOCK_TIME_START, m_StartUs,    Measurement::Unit::TIME_US },
+                 { WallClockTimer::WALL_CLOCK_TIME_STOP,  m_StopUs,     Measurement::Unit::TIME_US } };
+    }
+
+private:
+    double m_DurationUs;
+    double m_StartUs;
+    double m_StopUs;
+};
+
 std::map<std::string, Profiler::ProfilingEventStats> Profiler::CalculateProfilingEventStats() const
 {
     std::map<std::string, ProfilingEventStats> nameToStatsMap;
 
-    for (const auto& event : m_EventSequence)
+    // The statistics are kept up to date by EndEvent(), so they cover the events dropped in ring buffer mode too
+    auto AddEventStats = [&nameToStatsMap](const std::vector<ProfilingEventStats>& eventStats)
     {
-        Measurement measurement = FindMeasurement(WallClockTimer::WALL_CLOCK_TIME, event.get());
+        for (ProfilingEventId nameId = 0; nameId < eventStats.size(); ++nameId)
+        {
+            const ProfilingEventStats& stats = eventStats[nameId];
+            if (stats.m_Count == 0)
+            {
+                continue;
+            }
+            auto it = nameToStatsMap.emplace(ProfilingEventNames::GetName(nameId), stats);
+            if (!it.second)
+            {
+                ProfilingEventStats& totalStats = it.first->second;
+                totalStats.m_TotalMs += stats.m_TotalMs;
+                totalStats.m_MinMs = std::min(totalStats.m_MinMs, stats.m_MinMs);
+                totalStats.m_MaxMs = std::max(totalStats.m_MaxMs, stats.m_MaxMs);
+                totalStats.m_Count += stats.m_Count;
+            }
+        }
+    };
+
+    AddEventStats(m_EventStats);
+    std::lock_guard<std::mutex> lock(m_ThreadProfilersMutex);
+    for (const auto& threadProfiler : m_ThreadProfilers)
+    {
+        AddEventStats(threadProfiler.second->m_EventStats);
+    }
 
-        double durationMs = measurement.m_Value;
-        auto it = nameToStatsMap.find(event->GetName());
-        if (it != nameToStatsMap.end())
+    return nameToStatsMap;
+}
+
+std::vector<LatencyHistogram> Profiler::GetReportedHistograms() const
+{
+    std::vector<LatencyHistogram> histograms = m_EventHistograms;
+    std::lock_guard<std::mutex> lock(m_ThreadProfilersMutex);
+    for (const auto& threadProfiler : m_ThreadProfilers)
+    {
+        const std::vector<LatencyHistogram>& threadHistograms = threadProfiler.second->m_EventHistograms;
+        if (threadHistograms.size() > histograms.size())
         {
-            ProfilingEventStats& stats = it->second;
-            stats.m_TotalMs += durationMs;
-            stats.m_MinMs = std::min(stats.m_MinMs, durationMs);
-            stats.m_MaxMs = std::max(stats.m_MaxMs, durationMs);
-            ++stats.m_Count;
+            histograms.resize(threadHistograms.size());
         }
-        else
+        for (ProfilingEventId nameId = 0; nameId < threadHistograms.size(); ++nameId)
         {
-            nameToStatsMap.emplace(event->GetName(), ProfilingEventStats{ durationMs, durationMs, durationMs, 1 });
+            histograms[nameId].Add(threadHistograms[nameId]);
         }
     }
+    return histograms;
+}
 
-    return nameToStatsMap;
+std::vector<ProfilingEventLatencies> Profiler::GetEventLatencies() const
+{
+    std::vector<ProfilingEventLatencies> latencies;
+    const std::vector<LatencyHistogram> histograms = GetReportedHistograms();
+    for (ProfilingEventId nameId = 0; nameId < histograms.size(); ++nameId)
+    {
+        const LatencyHistogram& histogram = histograms[nameId];
+        if (histogram.GetCount() > 0)
+        {
+            latencies.push_back(ProfilingEventLatencies{ ProfilingEventNames::GetName(nameId),
+                                                         histogram.GetCount(),
+                                                         histogram.GetPercentileUs(50.0),
+                                                         histogram.GetPercentileUs(90.0),
+                                                         histogram.GetPercentileUs(99.0),
+                                                         histogram.GetPercentileUs(99.9),
+                                                         histogram.GetMaxUs() });
+        }
+    }
+
+    std::sort(latencies.begin(), latencies.end(),
+              [](const ProfilingEventLatencies& a, const ProfilingEventLatencies& b) { return a.m_Name < b.m_Name; });
+    return latencies;
 }
 
 const Event* GetEventPtr(const Event* ptr) { return ptr;}
@@ -164,6 +261,10 @@ void Profiler::AnalyzeEventSequenceAndWriteResults(ItertType first, ItertType la
 
 Profiler::Profiler()
     : m_ProfilingEnabled(false)
+    , m_NextRecordedInference(0)
+    , m_NumRecordedInferences(0)
+    , m_MaxRecordedInferences(0)
+    , m_OwnerThreadId(std::this_thread::get_id())
 {
     m_EventSequence.reserve(g_ProfilingEventCountHint);
 
@@ -195,22 +296,181 @@ bool Profiler::IsProfilingEnabled()
 void Profiler::EnableProfiling(bool enableProfiling)
 {
     m_ProfilingEnabled = enableProfiling;
+
+    std::lock_guard<std::mutex> lock(m_ThreadProfilersMutex);
+    for (auto& threadProfiler : m_ThreadProfilers)
+    {
+        threadProfiler.second->EnableProfiling(enableProfiling);
+    }
+}
+
+Profiler* Profiler::GetThreadProfiler()
+{
+    const std::thread::id threadId = std::this_thread::get_id();
+    if (threadId == m_OwnerThreadId)
+    {
+        return this;
+    }
+
+    std::lock_guard<std::mutex> lock(m_ThreadProfilersMutex);
+    std::unique_ptr<Profiler>& threadProfiler = m_ThreadProfilers[threadId];
+    if (!threadProfiler)
+    {
+        threadProfiler = std::make_unique<Profiler>();
+        threadProfiler->SetMaxRecordedInferences(m_MaxRecordedInferences);
+        threadProfiler->EnableProfiling(m_ProfilingEnabled);
+        threadProfiler->m_TraceWriter = m_TraceWriter;
+    }
+    return threadProfiler.get();
+}
+
+void Profiler::SetMaxRecordedInferences(unsigned int maxInferences)
+{
+    if (!m_Parents.empty())
+    {
+        throw RuntimeException("The number of recorded inferences cannot change while profiling events are in "
+                               "progress");
+    }
+
+    m_EventSequence.clear();
+    m_EventPool.clear();
+    m_RecordedInferences.clear();
+    m_RecordedInferences.resize(maxInferences);
+    for (auto& recordedInference : m_RecordedInferences)
+    {
+        recordedInference.reserve(g_ProfilingEventCountHint);
+    }
+    m_NextRecordedInference = 0;
+    m_NumRecordedInferences = 0;
+    m_MaxRecordedInferences = maxInferences;
+
+    std::lock_guard<std::mutex> lock(m_ThreadProfilersMutex);
+    for (auto& threadProfiler : m_ThreadProfilers)
+    {
+        threadProfiler.second->SetMaxRecordedInferences(maxInferences);
+    }
+}
+
+void Profiler::SetTraceFile(const std::string& fileName)
+{
+    // Completes the current file first, in case the same file is traced again
+    std::lock_guard<std::mutex> lock(m_ThreadProfilersMutex);
+    m_TraceWriter.reset();
+    for (auto& threadProfiler : m_ThreadProfilers)
+    {
+        threadProfiler.second->m_TraceWriter.reset();
+    }
+    if (fileName.empty())
+    {
+        return;
+    }
+
+    // The events of every thread are written to the same file, each thread in its own lane
+    m_TraceWriter = std::make_shared<ChromeTraceWriter>(fileName);
+    for (auto& threadProfiler : m_ThreadProfilers)
+    {
+        threadProfiler.second->m_TraceWriter = m_TraceWriter;
+    }
+}
+
+void Profiler::RecordCounter(const std::string& name, const std::string& series, uint64_t value)
+{
+    if (m_ProfilingEnabled && m_TraceWriter)
+    {
+        const double timeUs = std::chrono::duration<double, std::micro>(
+            WallClockTimer::clock::now().time_since_epoch()).count();
+        m_TraceWriter->WriteCounter(name, series, timeUs, value);
+    }
+}
+
+uint32_t Profiler::GetBackendIndex(const BackendId& backendId)
+{
+    auto it = std::find(m_BackendIds.begin(), m_BackendIds.end(), backendId);
+    if (it == m_BackendIds.end())
+    {
+        m_BackendIds.push_back(backendId);
+        return static_cast<uint32_t>(m_BackendIds.size() - 1);
+    }
+    return static_cast<uint32_t>(it - m_BackendIds.begin());
 }
 
 Event* Profiler::BeginEvent(const BackendId& backendId,
-                            const std::string& label,
+                            ProfilingEventId nameId,
                             std::vector<InstrumentPtr>&& instruments)
 {
-    Event* parent = m_Parents.empty() ? nullptr : m_Parents.top();
-    m_EventSequence.push_back(std::make_unique<Event>(label, this, parent, backendId, std::move(instruments)));
-    Event* event = m_EventSequence.back().get();
+    return BeginEvent(backendId, nameId, &instruments);
+}
+
+Event* Profiler::BeginWallClockEvent(const BackendId& backendId, ProfilingEventId nameId)
+{
+    return BeginEvent(backendId, nameId, nullptr);
+}
+
+Event* Profiler::BeginEvent(const BackendId& backendId,
+                            ProfilingEventId nameId,
+                            std::vector<InstrumentPtr>* instruments)
+{
+    Event* parent = m_Parents.empty() ? nullptr : m_Parents.back().m_Event;
+    uint32_t recordIndex = NoParent;
+    Event* event = nullptr;
+
+    auto MakeInstruments = [&]()
+    {
+        if (instruments)
+        {
+            return std::move(*instruments);
+        }
+        std::vector<InstrumentPtr> wallClockTimer;
+        wallClockTimer.push_back(std::make_unique<WallClockTimer>());
+        return wallClockTimer;
+    };
+
+    if (m_RecordedInferences.empty())
+    {
+        m_EventSequence.push_back(std::make_unique<Event>(nameId, this, parent, backendId, MakeInstruments()));
+        event = m_EventSequence.back().get();
+    }
+    else
+    {
+        // A top level event starts a new inference, which takes the place of the oldest one once the ring is full
+        if (m_Parents.empty())
+        {
+            m_RecordedInferences[m_NextRecordedInference].clear();
+            m_NextRecordedInference = (m_NextRecordedInference + 1) % m_RecordedInferences.size();
+            m_NumRecordedInferences = std::min(m_NumRecordedInferences + 1, m_RecordedInferences.size());
+        }
+        std::vector<RecordedEvent>& records = m_RecordedInferences[
+            (m_NextRecordedInference + m_RecordedInferences.size() - 1) % m_RecordedInferences.size()];
+        recordIndex = static_cast<uint32_t>(records.size());
+        records.push_back(RecordedEvent{ nameId, GetBackendIndex(backendId),
+                                         m_Parents.empty() ? NoParent : m_Parents.back().m_RecordIndex,
+                                         0.0, 0.0, 0.0, false });
+
+        // Events nest, so the event in progress at each level can be reused by the next one at the same level,
+        // together with its timer when both are only timed by a WallClockTimer
+        const size_t level = m_Parents.size();
+        if (level == m_EventPool.size())
+        {
+            m_EventPool.push_back(std::make_unique<Event>(nameId, this, parent, backendId, MakeInstruments()));
+        }
+        else if (!instruments && m_EventPool[level]->GetInstruments().size() == 1 &&
+                 FindWallClockTimer(m_EventPool[level].get()) != nullptr)
+        {
+            m_EventPool[level]->Reset(nameId, parent, backendId);
+        }
+        else
+        {
+            m_EventPool[level]->Reset(nameId, parent, backendId, MakeInstruments());
+        }
+        event = m_EventPool[level].get();
+    }
     event->Start();
 
 #if ARMNN_STREAMLINE_ENABLED
-    ANNOTATE_CHANNEL_COLOR(uint32_t(m_Parents.size()), GetEventColor(backendId), label.c_str());
+    ANNOTATE_CHANNEL_COLOR(uint32_t(m_Parents.size()), GetEventColor(backendId), event->GetName().c_str());
 #endif
 
-    m_Parents.push(event);
+    m_Parents.push_back(ActiveEvent{ event, recordIndex });
     return event;
 }
 
@@ -219,18 +479,119 @@ void Profiler::EndEvent(Event* event)
     event->Stop();
 
     ARMNN_ASSERT(!m_Parents.empty());
-    ARMNN_ASSERT(event == m_Parents.top());
-    m_Parents.pop();
+    ARMNN_ASSERT(event == m_Parents.back().m_Event);
+    const ActiveEvent activeEvent = m_Parents.back();
+    m_Parents.pop_back();
 
-    Event* parent = m_Parents.empty() ? nullptr : m_Parents.top();
+    Event* parent = m_Parents.empty() ? nullptr : m_Parents.back().m_Event;
     IgnoreUnused(parent);
     ARMNN_ASSERT(event->GetParentEvent() == parent);
 
+    const WallClockTimer* timer = FindWallClockTimer(event);
+    const double startUs    = timer ? timer->GetStartTimeUs() : 0.0;
+    const double stopUs     = timer ? timer->GetStopTimeUs() : 0.0;
+    const double durationUs = stopUs - startUs;
+
+    const ProfilingEventId nameId = event->GetNameId();
+    if (nameId >= m_EventStats.size())
+    {
+        m_EventStats.resize(nameId + 1, ProfilingEventStats{ 0.0, 0.0, 0.0, 0 });
+    }
+    ProfilingEventStats& stats = m_EventStats[nameId];
+    stats.m_MinMs = stats.m_Count == 0 ? durationUs : std::min(stats.m_MinMs, durationUs);
+    stats.m_MaxMs = stats.m_Count == 0 ? durationUs : std::max(stats.m_MaxMs, durationUs);
+    stats.m_TotalMs += durationUs;
+    ++stats.m_Count;
+
+    if (timer)
+    {
+        if (nameId >= m_EventHistograms.size())
+        {
+            m_EventHistograms.resize(nameId + 1);
+        }
+        m_EventHistograms[nameId].Record(durationUs);
+    }
+
+    if (activeEvent.m_RecordIndex != NoParent)
+    {
+        RecordedEvent& record = m_RecordedInferences[
+            (m_NextRecordedInference + m_RecordedInferences.size() - 1) % m_RecordedInferences.size()]
+            [activeEvent.m_RecordIndex];
+        record.m_DurationUs = durationUs;
+        record.m_StartUs = startUs;
+        record.m_StopUs = stopUs;
+        record.m_HasWallClockTimer = timer != nullptr;
+    }
+
+    // Events without a WallClockTimer cannot be placed on the timeline
+    if (m_TraceWriter && timer)
+    {
+        const bool isTopLevel = m_Parents.empty();
+        m_TraceWriter->WriteEvent(event->GetName(),
+                                  event->GetBackendId().Get(),
+                                  startUs,
+                                  durationUs,
+                                  isTopLevel);
+        if (isTopLevel)
+        {
+            m_TraceWriter->Flush();
+        }
+    }
+
 #if ARMNN_STREAMLINE_ENABLED
     ANNOTATE_CHANNEL_END(uint32_t(m_Parents.size()));
 #endif
 }
 
+void Profiler::GetEventSequence(std::vector<const Event*>& outEvents, std::vector<EventPtr>& recordedEvents) const
+{
+    if (m_RecordedInferences.empty())
+    {
+        for (const EventPtr& event : m_EventSequence)
+        {
+            outEvents.push_back(event.get());
+        }
+        return;
+    }
+
+    // Rebuilds the recorded inferences from the oldest to the newest, parents before their children
+    const size_t numSlots = m_RecordedInferences.size();
+    const size_t firstSlot = (m_NextRecordedInference + numSlots - m_NumRecordedInferences) % numSlots;
+    for (size_t i = 0; i < m_NumRecordedInferences; ++i)
+    {
+        const size_t firstEvent = recordedEvents.size();
+        for (const RecordedEvent& record : m_RecordedInferences[(firstSlot + i) % numSlots])
+        {
+            Event* parent = record.m_ParentIndex == NoParent ? nullptr
+                                                             : recordedEvents[firstEvent + record.m_ParentIndex].get();
+            std::vector<InstrumentPtr> instruments;
+            if (record.m_HasWallClockTimer)
+            {
+                instruments.push_back(
+                    std::make_unique<RecordedWallClockTimer>(record.m_DurationUs, record.m_StartUs, record.m_StopUs));
+            }
+            recordedEvents.push_back(std::make_unique<Event>(record.m_NameId,
+                                                             const_cast<Profiler*>(this),
+                                                             parent,
+                                                             m_BackendIds[record.m_BackendIndex],
+                                                             std::move(instruments)));
+            outEvents.push_back(recordedEvents.back().get());
+        }
+    }
+}
+
+std::vector<const Event*> Profiler::GetReportedEvents(std::vector<EventPtr>& recordedEvents) const
+{
+    std::vector<const Event*> events;
+    GetEventSequence(events, recordedEvents);
+    std::lock_guard<std::mutex> lock(m_ThreadProfilersMutex);
+    for (const auto& threadProfiler : m_ThreadProfilers)
+    {
+        threadProfiler.second->GetEventSequence(events, recordedEvents);
+    }
+    return events;
+}
+
 int CalcLevel(const Event* eventPtr)
 {
     int level=0;
@@ -242,12 +603,13 @@ int CalcLevel(const Event* eventPtr)
     return level;
 }
 
-void Profiler::PopulateInferences(std::vector<const Event*>& outInferences, int& outBaseLevel) const
+void Profiler::PopulateInferences(const std::vector<const Event*>& events,
+                                  std::vector<const Event*>& outInferences,
+                                  int& outBaseLevel) const
 {
-    outInferences.reserve(m_EventSequence.size());
-    for (const auto& event : m_EventSequence)
+    outInferences.reserve(events.size());
+    for (const Event* eventPtrRaw : events)
     {
-        const Event* eventPtrRaw = event.get();
         if (eventPtrRaw->GetName() == "EnqueueWorkload")
         {
             outBaseLevel = (outBaseLevel == -1) ? CalcLevel(eventPtrRaw) : outBaseLevel;
@@ -256,11 +618,11 @@ void Profiler::PopulateInferences(std::vector<const Event*>& outInferences, int&
     }
 }
 
-void Profiler::PopulateDescendants(std::map<const Event*, std::vector<const Event*>>& outDescendantsMap) const
+void Profiler::PopulateDescendants(const std::vector<const Event*>& events,
+                                   std::map<const Event*, std::vector<const Event*>>& outDescendantsMap) const
 {
-    for (const auto& event : m_EventSequence)
+    for (const Event* eventPtrRaw : events)
     {
-        const Event* eventPtrRaw = event.get();
         const Event* parent = eventPtrRaw->GetParentEvent();
 
         if (!parent)
@@ -327,6 +689,38 @@ void ExtractJsonObjects(unsigned int inferenceIndex,
     }
 }
 
+void AddLatencyJsonObjects(const std::string& eventName,
+                           JsonChildObject& eventObject,
+                           const std::map<std::string, ProfilingEventLatencies>& nameToLatenciesMap)
+{
+    for (auto& childObject : eventObject.m_Children)
+    {
+        if (childObject.GetType() == JsonObjectType::Event)
+        {
+            AddLatencyJsonObjects(childObject.m_Label, childObject, nameToLatenciesMap);
+        }
+    }
+
+    // The percentiles are those of all the events with the same name
+    auto it = nameToLatenciesMap.find(eventName);
+    if (it == nameToLatenciesMap.end())
+    {
+        return;
+    }
+    const std::pair<const char*, double> percentiles[] = { { "p50",   it->second.m_P50Us },
+                                                           { "p90",   it->second.m_P90Us },
+                                                           { "p99",   it->second.m_P99Us },
+                                                           { "p99.9", it->second.m_P999Us } };
+    for (const auto& percentile : percentiles)
+    {
+        JsonChildObject percentileObject{percentile.first};
+        percentileObject.SetUnit(Measurement::Unit::TIME_US);
+        percentileObject.SetType(JsonObjectType::Measurement);
+        percentileObject.AddMeasurement(percentile.second);
+        eventObject.AddChild(percentileObject);
+    }
+}
+
 void Profiler::Print(std::ostream& outStream) const
 {
     // Makes sure timestamps are output with 6 decimals, and save old settings.
@@ -336,14 +730,17 @@ void Profiler::Print(std::ostream& outStream) const
     outStream.setf(std::ios::fixed);
     JsonPrinter printer(outStream);
 
+    std::vector<EventPtr> recordedEvents;
+    const std::vector<const Event*> events = GetReportedEvents(recordedEvents);
+
     // First find all the "inference" Events and print out duration measurements.
     int baseLevel = -1;
     std::vector<const Event*> inferences;
-    PopulateInferences(inferences, baseLevel);
+    PopulateInferences(events, inferences, baseLevel);
 
     // Second map out descendants hierarchy
     std::map<const Event*, std::vector<const Event*>> descendantsMap;
-    PopulateDescendants(descendantsMap);
+    PopulateDescendants(events, descendantsMap);
 
     JsonChildObject inferenceObject{"inference_measurements"};
     JsonChildObject layerObject{"layer_measurements"};
@@ -356,6 +753,17 @@ void Profiler::Print(std::ostream& outStream) const
         ExtractJsonObjects(inferenceIndex, inference, inferenceObject, descendantsMap);
     }
 
+    // Add the latency percentiles of the events, starting with those of the inferences
+    std::map<std::string, ProfilingEventLatencies> nameToLatenciesMap;
+    for (const ProfilingEventLatencies& latencies : GetEventLatencies())
+    {
+        nameToLatenciesMap.emplace(latencies.m_Name, latencies);
+    }
+    if (!inferences.empty())
+    {
+        AddLatencyJsonObjects(inferences[0]->GetName(), inferenceObject, nameToLatenciesMap);
+    }
+
     printer.PrintHeader();
     printer.PrintArmNNHeader();
 
@@ -380,7 +788,14 @@ void Profiler::Print(std::ostream& outStream) const
 void Profiler::AnalyzeEventsAndWriteResults(std::ostream& outStream) const
 {
     // Stack should be empty now.
-    const bool saneMarkerSequence = m_Parents.empty();
+    bool saneMarkerSequence = m_Parents.empty();
+    {
+        std::lock_guard<std::mutex> lock(m_ThreadProfilersMutex);
+        for (const auto& threadProfiler : m_ThreadProfilers)
+        {
+            saneMarkerSequence = saneMarkerSequence && threadProfiler.second->m_Parents.empty();
+        }
+    }
 
     // Abort if the sequence of markers was found to have incorrect information:
     // The stats cannot be trusted.
@@ -393,9 +808,12 @@ void Profiler::AnalyzeEventsAndWriteResults(std::ostream& outStream) const
         return;
     }
 
+    std::vector<EventPtr> recordedEvents;
+    const std::vector<const Event*> events = GetReportedEvents(recordedEvents);
+
     // Analyzes the full sequence of events.
-    AnalyzeEventSequenceAndWriteResults(m_EventSequence.cbegin(),
-                                        m_EventSequence.cend(),
+    AnalyzeEventSequenceAndWriteResults(events.cbegin(),
+                                        events.cend(),
                                         outStream);
 
     // Aggregates events by tag if requested (spams the output stream if done for all tags).
@@ -409,11 +827,11 @@ void Profiler::AnalyzeEventsAndWriteResults(std::ostream& outStream) const
 
         int baseLevel = -1;
         std::vector<const Event*> inferences;
-        PopulateInferences(inferences, baseLevel);
+        PopulateInferences(events, inferences, baseLevel);
 
         // Second map out descendants hierarchy
         std::map<const Event*, std::vector<const Event*>> descendantsMap;
-        PopulateDescendants(descendantsMap);
+        PopulateDescendants(events, descendantsMap);
 
         std::function<void (const Event*, std::vector<const Event*>&)>
             FindDescendantEvents = [&](const Event* eventPtr,
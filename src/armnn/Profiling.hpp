@@ -4,6 +4,8 @@
 //
 #pragma once
 
+#include "ChromeTraceWriter.hpp"
+#include "LatencyHistogram.hpp"
 #include "ProfilingEvent.hpp"
 
 #include <armnn/utility/IgnoreUnused.hpp>
@@ -11,12 +13,15 @@
 
 #include "WallClockTimer.hpp"
 
+#include <atomic>
 #include <chrono>
 #include <iosfwd>
 #include <ctime>
+#include <limits>
 #include <vector>
-#include <stack>
 #include <map>
+#include <mutex>
+#include <thread>
 
 namespace armnn
 {
@@ -24,6 +29,11 @@ namespace armnn
 // Simple single-threaded profiler.
 // Tracks events reported by BeginEvent()/EndEvent() and outputs detailed information and stats when
 // Profiler::AnalyzeEventsAndWriteResults() is called.
+// Threads running executions concurrently each report their events to their own profiler, given by
+// GetThreadProfiler(), whose events are reported together with those of this profiler.
+// By default every event is kept until the profiler is destroyed. After SetMaxRecordedInferences(), only compact
+// copies of the events of the last inferences are kept, in a ring of buffers which stop growing once every
+// inference has been seen, and the events in progress are reused by nesting level.
 class Profiler final : public IProfiler
 {
 public:
@@ -31,9 +41,12 @@ public:
     ~Profiler();
     using InstrumentPtr = std::unique_ptr<Instrument>;
 
-    // Marks the beginning of a user-defined event.
-    // No attempt will be made to copy the name string: it must be known at compile time.
-    Event* BeginEvent(const BackendId& backendId, const std::string& name, std::vector<InstrumentPtr>&& instruments);
+    // Marks the beginning of a user-defined event, whose name has been interned in ProfilingEventNames.
+    Event* BeginEvent(const BackendId& backendId, ProfilingEventId nameId, std::vector<InstrumentPtr>&& instruments);
+
+    // Marks the beginning of a user-defined event timed by a WallClockTimer. In ring buffer mode, the event and its
+    // timer are reused, so that nothing is allocated once the buffers are warm.
+    Event* BeginWallClockEvent(const BackendId& backendId, ProfilingEventId nameId);
 
     // Marks the end of a user-defined event.
     void EndEvent(Event* event);
@@ -54,9 +67,27 @@ public:
     // Print stats for events in JSON Format to the given output stream.
     void Print(std::ostream& outStream) const override;
 
+    // Keeps only the events of the last maxInferences top level events (the inferences of a LoadedNetwork),
+    // or every event if maxInferences is 0.
+    void SetMaxRecordedInferences(unsigned int maxInferences) override;
+
+    // Streams the events to a Chrome trace file as they end, or stops if fileName is empty.
+    void SetTraceFile(const std::string& fileName) override;
+
+    // Gets the latency percentiles of the events timed by a WallClockTimer, by event name.
+    std::vector<ProfilingEventLatencies> GetEventLatencies() const override;
+
+    // Reports the value of a counter track to the trace file, if profiling is enabled and a trace file is set.
+    void RecordCounter(const std::string& name, const std::string& series, uint64_t value);
+
     // Gets the color to render an event with, based on which device it denotes.
     uint32_t GetEventColor(const BackendId& backendId) const;
 
+    // Gets the profiler the calling thread reports its events to: this profiler for the thread which created it,
+    // or a profiler of the thread created on first use with the settings of this profiler, which traces its events
+    // to the same file. The settings must change and the reports be made while no events are in progress.
+    Profiler* GetThreadProfiler();
+
 private:
     using EventPtr = std::unique_ptr<Event>;
     struct Marker
@@ -72,20 +103,82 @@ private:
         uint32_t m_Count;
     };
 
+    // Compact copy of an event kept in ring buffer mode, with the times of its WallClockTimer, if any.
+    struct RecordedEvent
+    {
+        ProfilingEventId m_NameId;
+        uint32_t m_BackendIndex;
+        uint32_t m_ParentIndex; ///< Index of the parent in the same inference, NoParent for the top level event.
+        double m_DurationUs;
+        double m_StartUs;
+        double m_StopUs;
+        bool m_HasWallClockTimer;
+    };
+
+    // Event in progress, with its record in ring buffer mode.
+    struct ActiveEvent
+    {
+        Event* m_Event;
+        uint32_t m_RecordIndex;
+    };
+
+    static constexpr uint32_t NoParent = std::numeric_limits<uint32_t>::max();
+
     template<typename EventIterType>
     void AnalyzeEventSequenceAndWriteResults(EventIterType first, EventIterType last, std::ostream& outStream) const;
 
     std::map<std::string, ProfilingEventStats> CalculateProfilingEventStats() const;
-    void PopulateInferences(std::vector<const Event*>& outInferences, int& outBaseLevel) const;
-    void PopulateDescendants(std::map<const Event*, std::vector<const Event*>>& outDescendantsMap) const;
+    void PopulateInferences(const std::vector<const Event*>& events,
+                            std::vector<const Event*>& outInferences,
+                            int& outBaseLevel) const;
+    void PopulateDescendants(const std::vector<const Event*>& events,
+                             std::map<const Event*, std::vector<const Event*>>& outDescendantsMap) const;
+
+    // Appends the events to report to outEvents: those of m_EventSequence, or the recorded events rebuilt into
+    // recordedEvents in ring buffer mode.
+    void GetEventSequence(std::vector<const Event*>& outEvents, std::vector<EventPtr>& recordedEvents) const;
+
+    // Returns the events to report of this profiler followed by those of the thread profilers.
+    std::vector<const Event*> GetReportedEvents(std::vector<EventPtr>& recordedEvents) const;
 
-    std::stack<Event*> m_Parents;
+    // Returns the histograms of wall clock times per event name id of this profiler and the thread profilers.
+    std::vector<LatencyHistogram> GetReportedHistograms() const;
+
+    Event* BeginEvent(const BackendId& backendId,
+                      ProfilingEventId nameId,
+                      std::vector<InstrumentPtr>* instruments);
+
+    uint32_t GetBackendIndex(const BackendId& backendId);
+
+    std::vector<ActiveEvent> m_Parents;
     std::vector<EventPtr> m_EventSequence;
-    bool m_ProfilingEnabled;
+    std::atomic<bool> m_ProfilingEnabled;
+
+    // Ring buffer mode: events reused by nesting level and the records of the last inferences.
+    std::vector<EventPtr> m_EventPool;
+    std::vector<std::vector<RecordedEvent>> m_RecordedInferences;
+    size_t m_NextRecordedInference;
+    size_t m_NumRecordedInferences;
+    unsigned int m_MaxRecordedInferences;
+
+    // Interned backends, and the statistics and histograms of wall clock times per event name id kept up to date
+    // by EndEvent().
+    std::vector<BackendId> m_BackendIds;
+    std::vector<ProfilingEventStats> m_EventStats;
+    std::vector<LatencyHistogram> m_EventHistograms;
+
+    // Chrome trace file the events are streamed to, shared with the thread profilers.
+    std::shared_ptr<ChromeTraceWriter> m_TraceWriter;
+
+    // Profilers of the other threads reporting events, see GetThreadProfiler().
+    const std::thread::id m_OwnerThreadId;
+    mutable std::mutex m_ThreadProfilersMutex;
+    std::map<std::thread::id, std::unique_ptr<Profiler>> m_ThreadProfilers;
 
 private:
     // Friend functions for unit testing, see ProfilerTests.cpp.
     friend size_t GetProfilerEventSequenceSize(armnn::Profiler* profiler);
+    friend size_t GetProfilerRecordedEventCount(armnn::Profiler* profiler);
 };
 
 // Singleton profiler manager.
@@ -109,11 +202,24 @@ private:
 };
 
 // Helper to easily add event markers to the codebase.
+// Without instruments, the event is timed by a WallClockTimer owned by the profiler.
 class ScopedProfilingEvent
 {
 public:
     using InstrumentPtr = std::unique_ptr<Instrument>;
 
+    template<typename... Args>
+    ScopedProfilingEvent(const BackendId& backendId, ProfilingEventId nameId, Args&&... args)
+        : m_Event(nullptr)
+        , m_Profiler(ProfilerManager::GetInstance().GetProfiler())
+    {
+        if (m_Profiler && m_Profiler->IsProfilingEnabled())
+        {
+            m_Event = Begin(backendId, nameId, std::forward<Args>(args)...);
+        }
+    }
+
+    // For names which change from one pass to the next, interned on every construction.
     template<typename... Args>
     ScopedProfilingEvent(const BackendId& backendId, const std::string& name, Args&&... args)
         : m_Event(nullptr)
@@ -121,10 +227,7 @@ public:
     {
         if (m_Profiler && m_Profiler->IsProfilingEnabled())
         {
-            std::vector<InstrumentPtr> instruments(0);
-            instruments.reserve(sizeof...(args)); //One allocation
-            ConstructNextInVector(instruments, std::forward<Args>(args)...);
-            m_Event = m_Profiler->BeginEvent(backendId, name, std::move(instruments));
+            m_Event = Begin(backendId, ProfilingEventNames::Intern(name), std::forward<Args>(args)...);
         }
     }
 
@@ -137,6 +240,19 @@ public:
     }
 
 private:
+    Event* Begin(const BackendId& backendId, ProfilingEventId nameId)
+    {
+        return m_Profiler->BeginWallClockEvent(backendId, nameId);
+    }
+
+    template<typename Arg, typename... Args>
+    Event* Begin(const BackendId& backendId, ProfilingEventId nameId, Arg&& arg, Args&&... args)
+    {
+        std::vector<InstrumentPtr> instruments(0);
+        instruments.reserve(1 + sizeof...(args)); //One allocation
+        ConstructNextInVector(instruments, std::forward<Arg>(arg), std::forward<Args>(args)...);
+        return m_Profiler->BeginEvent(backendId, nameId, std::move(instruments));
+    }
 
     void ConstructNextInVector(std::vector<InstrumentPtr>& instruments)
     {
@@ -156,14 +272,17 @@ private:
 
 } // namespace armnn
 
-#define ARMNN_SCOPED_PROFILING_EVENT_WITH_INSTRUMENTS_UNIQUE_LOC_INNER(lineNumber, backendId, /*name,*/ ...) \
-    armnn::ScopedProfilingEvent e_ ## lineNumber(backendId, /*name,*/ __VA_ARGS__);
+#define ARMNN_SCOPED_PROFILING_EVENT_WITH_INSTRUMENTS_UNIQUE_LOC_INNER(lineNumber, backendId, name, ...) \
+    static const armnn::ProfilingEventId id_ ## lineNumber = armnn::ProfilingEventNames::Intern(name); \
+    armnn::ScopedProfilingEvent e_ ## lineNumber(backendId, id_ ## lineNumber, __VA_ARGS__);
 
 #define ARMNN_SCOPED_PROFILING_EVENT_WITH_INSTRUMENTS_UNIQUE_LOC(lineNumber, backendId, /*name,*/ ...) \
     ARMNN_SCOPED_PROFILING_EVENT_WITH_INSTRUMENTS_UNIQUE_LOC_INNER(lineNumber, backendId, /*name,*/ __VA_ARGS__)
 
 // The event name must be known at compile time i.e. if you are going to use this version of the macro
-// in code the first argument you supply after the backendId must be the name.
+// in code the first argument you supply after the backendId must be the name. The name is interned once per call
+// site (per template instantiation), so it must be the same on every pass: construct a ScopedProfilingEvent with
+// the name instead for names which change.
 // NOTE: need to pass the line number as an argument from here so by the time it gets to the UNIQUE_LOC_INNER
 //       above it has expanded to a string and will concat (##) correctly with the 'e_' prefix to yield a
 //       legal and unique variable name (so long as you don't use the macro twice on the same line).
@@ -172,5 +291,13 @@ private:
 #define ARMNN_SCOPED_PROFILING_EVENT_WITH_INSTRUMENTS(backendId, /*name,*/ ...) \
     ARMNN_SCOPED_PROFILING_EVENT_WITH_INSTRUMENTS_UNIQUE_LOC(__LINE__,backendId, /*name,*/ __VA_ARGS__)
 
+#define ARMNN_SCOPED_PROFILING_EVENT_UNIQUE_LOC_INNER(lineNumber, backendId, name) \
+    static const armnn::ProfilingEventId id_ ## lineNumber = armnn::ProfilingEventNames::Intern(name); \
+    armnn::ScopedProfilingEvent e_ ## lineNumber(backendId, id_ ## lineNumber);
+
+#define ARMNN_SCOPED_PROFILING_EVENT_UNIQUE_LOC(lineNumber, backendId, name) \
+    ARMNN_SCOPED_PROFILING_EVENT_UNIQUE_LOC_INNER(lineNumber, backendId, name)
+
+// Same as ARMNN_SCOPED_PROFILING_EVENT_WITH_INSTRUMENTS with a WallClockTimer only, which the profiler provides.
 #define ARMNN_SCOPED_PROFILING_EVENT(backendId, name) \
-    ARMNN_SCOPED_PROFILING_EVENT_WITH_INSTRUMENTS(backendId, name, armnn::WallClockTimer())
+    ARMNN_SCOPED_PROFILING_EVENT_UNIQUE_LOC(__LINE__, backendId, name)
@@ -6,14 +6,66 @@
 #include "Profiling.hpp"
 #include "ProfilingEvent.hpp"
 
+#include <deque>
+#include <mutex>
+#include <unordered_map>
+
 namespace armnn
 {
+
+namespace
+{
+
+struct EventNameTable
+{
+    std::mutex m_Mutex;
+    std::deque<std::string> m_Names; // A deque so that references to the names stay valid as it grows
+    std::unordered_map<std::string, ProfilingEventId> m_Ids;
+};
+
+EventNameTable& GetEventNameTable()
+{
+    static EventNameTable table;
+    return table;
+}
+
+} // anonymous namespace
+
+ProfilingEventId ProfilingEventNames::Intern(const std::string& name)
+{
+    EventNameTable& table = GetEventNameTable();
+    std::lock_guard<std::mutex> lock(table.m_Mutex);
+    auto it = table.m_Ids.find(name);
+    if (it == table.m_Ids.end())
+    {
+        it = table.m_Ids.emplace(name, static_cast<ProfilingEventId>(table.m_Names.size())).first;
+        table.m_Names.push_back(name);
+    }
+    return it->second;
+}
+
+const std::string& ProfilingEventNames::GetName(ProfilingEventId id)
+{
+    EventNameTable& table = GetEventNameTable();
+    std::lock_guard<std::mutex> lock(table.m_Mutex);
+    return table.m_Names.at(id);
+}
+
 Event::Event(const std::string& eventName,
              Profiler* profiler,
              Event* parent,
              const BackendId backendId,
              std::vector<InstrumentPtr>&& instruments)
-    : m_EventName(eventName)
+    : Event(ProfilingEventNames::Intern(eventName), profiler, parent, backendId, std::move(instruments))
+{
+}
+
+Event::Event(ProfilingEventId eventNameId,
+             Profiler* profiler,
+             Event* parent,
+             const BackendId backendId,
+             std::vector<InstrumentPtr>&& instruments)
+    : m_EventNameId(eventNameId)
     , m_Profiler(profiler)
     , m_Parent(parent)
     , m_BackendId(backendId)
@@ -22,7 +74,7 @@ Event::Event(const std::string& eventName,
 }
 
 Event::Event(Event&& other) noexcept
-    : m_EventName(std::move(other.m_EventName))
+    : m_EventNameId(other.m_EventNameId)
     , m_Profiler(other.m_Profiler)
     , m_Parent(other.m_Parent)
     , m_BackendId(other.m_BackendId)
@@ -66,7 +118,12 @@ const std::vector<Measurement> Event::GetMeasurements() const
 
 const std::string& Event::GetName() const
 {
-    return m_EventName;
+    return ProfilingEventNames::GetName(m_EventNameId);
+}
+
+ProfilingEventId Event::GetNameId() const
+{
+    return m_EventNameId;
 }
 
 const Profiler* Event::GetProfiler() const
@@ -84,6 +141,27 @@ BackendId Event::GetBackendId() const
     return m_BackendId;
 }
 
+const Event::Instruments& Event::GetInstruments() const
+{
+    return m_Instruments;
+}
+
+void Event::Reset(ProfilingEventId eventNameId,
+                  Event* parent,
+                  const BackendId& backendId,
+                  std::vector<InstrumentPtr>&& instruments)
+{
+    Reset(eventNameId, parent, backendId);
+    m_Instruments = std::move(instruments);
+}
+
+void Event::Reset(ProfilingEventId eventNameId, Event* parent, const BackendId& backendId)
+{
+    m_EventNameId = eventNameId;
+    m_Parent = parent;
+    m_BackendId = backendId;
+}
+
 Event& Event::operator=(Event&& other) noexcept
 {
     if (this == &other)
@@ -91,10 +169,11 @@ Event& Event::operator=(Event&& other) noexcept
         return *this;
     }
 
-    m_EventName = other.m_EventName;
+    m_EventNameId = other.m_EventNameId;
     m_Profiler = other.m_Profiler;
     m_Parent = other.m_Parent;
     m_BackendId = other.m_BackendId;
+    m_Instruments = std::move(other.m_Instruments);
     other.m_Profiler = nullptr;
     other.m_Parent = nullptr;
     return *this;
@@ -6,6 +6,7 @@
 #pragma once
 
 #include <stack>
+#include <string>
 #include <vector>
 #include <chrono>
 #include <memory>
@@ -18,6 +19,22 @@ namespace armnn
 /// Forward declaration
 class Profiler;
 
+/// Identifies an event name interned in ProfilingEventNames
+using ProfilingEventId = uint32_t;
+
+/// Process wide table of the event names, so that events only carry the id of their name. The profiling macros
+/// intern their name once per call site, the names are only looked up again when the results are printed.
+/// Thread safe.
+class ProfilingEventNames
+{
+public:
+    /// Returns the id of the given name, adding it to the table if needed
+    static ProfilingEventId Intern(const std::string& name);
+
+    /// Returns the name with the given id, which stays valid until the end of the process
+    static const std::string& GetName(ProfilingEventId id);
+};
+
 /// Event class records measurements reported by BeginEvent()/EndEvent() and returns measurements when
 /// Event::GetMeasurements() is called.
 class Event
@@ -32,6 +49,12 @@ public:
           const BackendId backendId,
           std::vector<InstrumentPtr>&& instrument);
 
+    Event(ProfilingEventId eventNameId,
+          Profiler* profiler,
+          Event* parent,
+          const BackendId backendId,
+          std::vector<InstrumentPtr>&& instrument);
+
     Event(const Event& other) = delete;
 
     /// Move Constructor
@@ -54,6 +77,10 @@ public:
     /// \return Name of the event
     const std::string& GetName() const;
 
+    /// Get the id of the name of the event
+    /// \return Id of the name of the event in ProfilingEventNames
+    ProfilingEventId GetNameId() const;
+
     /// Get the pointer of the profiler associated with this event
     /// \return Pointer of the profiler associated with this event
     const Profiler* GetProfiler() const;
@@ -66,6 +93,19 @@ public:
     /// \return Backend id of the event
     BackendId GetBackendId() const;
 
+    /// Get the instruments of the event
+    /// \return Instruments of the event
+    const Instruments& GetInstruments() const;
+
+    /// Reuse the event for another one, keeping the storage of its backend id
+    void Reset(ProfilingEventId eventNameId,
+               Event* parent,
+               const BackendId& backendId,
+               std::vector<InstrumentPtr>&& instruments);
+
+    /// Reuse the event and its instruments for another one
+    void Reset(ProfilingEventId eventNameId, Event* parent, const BackendId& backendId);
+
     /// Assignment operator
     Event& operator=(const Event& other) = delete;
 
@@ -73,8 +113,8 @@ public:
     Event& operator=(Event&& other) noexcept;
 
 private:
-    /// Name of the event
-    std::string m_EventName;
+    /// Id of the name of the event
+    ProfilingEventId m_EventNameId;
 
     /// Stored associated profiler
     Profiler* m_Profiler;
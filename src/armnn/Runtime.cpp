@@ -24,6 +24,26 @@ using namespace std;
 namespace armnn
 {
 
+namespace
+{
+
+/// Fulfils a promise with the status of an execution scheduled with EnqueueWorkloadAsync()
+class PromiseExecutionCallback final : public experimental::IAsyncExecutionCallback
+{
+public:
+    std::future<Status> GetFuture() { return m_Promise.get_future(); }
+
+    void Notify(Status status, InferenceTimingPair) override
+    {
+        m_Promise.set_value(status);
+    }
+
+private:
+    std::promise<Status> m_Promise;
+};
+
+} // anonymous namespace
+
 IRuntime* IRuntime::CreateRaw(const CreationOptions& options)
 {
     return new Runtime(options);
@@ -121,7 +141,13 @@ Status Runtime::UnloadNetwork(NetworkId networkId)
     std::unique_ptr<profiling::TimelineUtilityMethods> timelineUtils =
             profiling::TimelineUtilityMethods::GetTimelineUtils(m_ProfilingService);
     {
-        std::lock_guard<std::mutex> lockGuard(m_Mutex);
+        std::unique_lock<std::mutex> lock(m_Mutex);
+
+        // The executions queued on the thread pool use the network and its working memory until they complete
+        m_ExecutionsDone.wait(lock, [this, networkId]()
+            {
+                return m_ThreadpoolExecutionCounts.find(networkId) == m_ThreadpoolExecutionCounts.end();
+            });
 
         // If timeline recording is on mark the Network end of life
         if (timelineUtils)
@@ -134,6 +160,8 @@ Status Runtime::UnloadNetwork(NetworkId networkId)
                                            profiling::LabelsAndEventClasses::ARMNN_PROFILING_EOL_EVENT_CLASS);
             }
         }
+        m_ThreadpoolWorkingMemHandles.erase(networkId);
+
         if (m_LoadedNetworks.erase(networkId) == 0)
         {
             ARMNN_LOG(warning) << "WARNING: Runtime::UnloadNetwork(): " << networkId << " not found!";
@@ -184,7 +212,8 @@ void Runtime::ReportStructure() // armnn::profiling::IProfilingService& profilin
 
 Runtime::Runtime(const CreationOptions& options)
     : m_NetworkIdCounter(0),
-      m_ProfilingService(*this)
+      m_ProfilingService(*this),
+      m_NumberOfThreads(options.m_NumberOfThreads)
 {
     const auto start_time = armnn::GetTimeNow();
     ARMNN_LOG(info) << "ArmNN v" << ARMNN_VERSION << "\n";
@@ -254,6 +283,11 @@ Runtime::Runtime(const CreationOptions& options)
 Runtime::~Runtime()
 {
     const auto start_time = armnn::GetTimeNow();
+
+    // Complete any execution still queued on the thread pool before the networks are unloaded
+    m_Threadpool.reset();
+    m_ThreadpoolWorkingMemHandles.clear();
+
     std::vector<int> networkIDs;
     try
     {
@@ -323,10 +357,50 @@ Status Runtime::EnqueueWorkload(NetworkId networkId,
                                 const OutputTensors& outputTensors)
 {
     LoadedNetwork* loadedNetwork = GetLoadedNetworkPtr(networkId);
+    std::lock_guard<std::mutex> executionLock(loadedNetwork->GetExecutionMutex());
     ProfilerManager::GetInstance().RegisterProfiler(loadedNetwork->GetProfiler().get());
 
     ARMNN_SCOPED_PROFILING_EVENT(Compute::Undefined, "EnqueueWorkload");
 
+    FreeWorkingMemoryOfPreviousNetwork(networkId);
+
+    if (loadedNetwork->IsAsyncEnabled())
+    {
+        ARMNN_LOG(error) << "Network " << networkId << " is async enabled, use IRuntime::Execute() instead.";
+        return Status::Failure;
+    }
+
+    return loadedNetwork->EnqueueWorkload(inputTensors, outputTensors);
+}
+
+std::unique_ptr<experimental::IBoundIOBuffers> Runtime::BindIOBuffers(NetworkId networkId,
+                                                                       const InputTensors& inputTensors,
+                                                                       const OutputTensors& outputTensors)
+{
+    LoadedNetwork* loadedNetwork = GetLoadedNetworkPtr(networkId);
+    ProfilerManager::GetInstance().RegisterProfiler(loadedNetwork->GetProfiler().get());
+
+    ARMNN_SCOPED_PROFILING_EVENT(Compute::Undefined, "BindIOBuffers");
+
+    return loadedNetwork->BindIOBuffers(networkId, inputTensors, outputTensors);
+}
+
+Status Runtime::EnqueueWorkload(experimental::IBoundIOBuffers& boundIOBuffers)
+{
+    NetworkId networkId = boundIOBuffers.GetNetworkId();
+    LoadedNetwork* loadedNetwork = GetLoadedNetworkPtr(networkId);
+    std::lock_guard<std::mutex> executionLock(loadedNetwork->GetExecutionMutex());
+    ProfilerManager::GetInstance().RegisterProfiler(loadedNetwork->GetProfiler().get());
+
+    ARMNN_SCOPED_PROFILING_EVENT(Compute::Undefined, "EnqueueWorkload");
+
+    FreeWorkingMemoryOfPreviousNetwork(networkId);
+
+    return loadedNetwork->EnqueueWorkload(boundIOBuffers);
+}
+
+void Runtime::FreeWorkingMemoryOfPreviousNetwork(NetworkId networkId)
+{
     static thread_local NetworkId lastId = networkId;
     if (lastId != networkId)
     {
@@ -336,8 +410,152 @@ Status Runtime::EnqueueWorkload(NetworkId networkId,
             });
     }
     lastId=networkId;
+}
 
-    return loadedNetwork->EnqueueWorkload(inputTensors, outputTensors);
+Status Runtime::Execute(experimental::IWorkingMemHandle& workingMemHandle,
+                        const InputTensors& inputTensors,
+                        const OutputTensors& outputTensors)
+{
+    NetworkId networkId = workingMemHandle.GetNetworkId();
+    LoadedNetwork* loadedNetwork = GetLoadedNetworkPtr(networkId);
+
+    if (!loadedNetwork->IsAsyncEnabled())
+    {
+        ARMNN_LOG(error) << "Attempting to execute network " << networkId << " which is not async enabled.";
+        return Status::Failure;
+    }
+
+    // Executions run concurrently, so each thread reports its events to its own profiler
+    ProfilerManager::GetInstance().RegisterProfiler(loadedNetwork->GetProfiler()->GetThreadProfiler());
+
+    ARMNN_SCOPED_PROFILING_EVENT(Compute::Undefined, "Execute");
+
+    return loadedNetwork->Execute(inputTensors, outputTensors, workingMemHandle);
+}
+
+std::unique_ptr<experimental::IWorkingMemHandle> Runtime::CreateWorkingMemHandle(NetworkId networkId)
+{
+    LoadedNetwork* loadedNetwork = GetLoadedNetworkPtr(networkId);
+
+    if (!loadedNetwork->IsAsyncEnabled())
+    {
+        ARMNN_LOG(error) << "Network " << networkId << " is not async enabled.";
+        return nullptr;
+    }
+
+    return loadedNetwork->CreateWorkingMemHandle(networkId);
+}
+
+std::future<Status> Runtime::EnqueueWorkloadAsync(NetworkId networkId,
+                                                  const InputTensors& inputTensors,
+                                                  const OutputTensors& outputTensors,
+                                                  QosExecPriority priority)
+{
+    auto callback = std::make_shared<PromiseExecutionCallback>();
+    std::future<Status> future = callback->GetFuture();
+    EnqueueWorkloadAsync(networkId, inputTensors, outputTensors, priority, callback);
+    return future;
+}
+
+void Runtime::EnqueueWorkloadAsync(NetworkId networkId,
+                                   const InputTensors& inputTensors,
+                                   const OutputTensors& outputTensors,
+                                   QosExecPriority priority,
+                                   experimental::IAsyncExecutionCallbackPtr callback)
+{
+    if (!callback)
+    {
+        throw InvalidArgumentException("EnqueueWorkloadAsync: the execution callback must not be null");
+    }
+
+    experimental::Threadpool& threadpool = GetThreadpool();
+    {
+        std::lock_guard<std::mutex> lockGuard(m_Mutex);
+        ++m_ThreadpoolExecutionCounts[networkId];
+    }
+
+    try
+    {
+        threadpool.Schedule([this, networkId, inputTensors, outputTensors, callback](unsigned int threadIndex)
+            {
+                HighResolutionClock startTime = std::chrono::high_resolution_clock::now();
+                Status status = ExecuteOnThreadpool(networkId, inputTensors, outputTensors, threadIndex);
+                HighResolutionClock endTime = std::chrono::high_resolution_clock::now();
+
+                // The network may be unloaded from the callback, once it is no longer used by this execution
+                EndThreadpoolExecution(networkId);
+                callback->Notify(status, std::make_pair(startTime, endTime));
+            },
+            priority);
+    }
+    catch (...)
+    {
+        EndThreadpoolExecution(networkId);
+        throw;
+    }
+}
+
+void Runtime::EndThreadpoolExecution(NetworkId networkId)
+{
+    {
+        std::lock_guard<std::mutex> lockGuard(m_Mutex);
+        auto it = m_ThreadpoolExecutionCounts.find(networkId);
+        if (--it->second == 0)
+        {
+            m_ThreadpoolExecutionCounts.erase(it);
+        }
+    }
+    m_ExecutionsDone.notify_all();
+}
+
+experimental::Threadpool& Runtime::GetThreadpool()
+{
+    std::lock_guard<std::mutex> lockGuard(m_Mutex);
+    if (!m_Threadpool)
+    {
+        m_Threadpool = std::make_unique<experimental::Threadpool>(m_NumberOfThreads);
+    }
+    return *m_Threadpool;
+}
+
+Status Runtime::ExecuteOnThreadpool(NetworkId networkId,
+                                    const InputTensors& inputTensors,
+                                    const OutputTensors& outputTensors,
+                                    unsigned int threadIndex)
+{
+    try
+    {
+        LoadedNetwork* loadedNetwork = GetLoadedNetworkPtr(networkId);
+        if (!loadedNetwork->IsAsyncEnabled())
+        {
+            // EnqueueWorkload() runs the executions of the network one at a time
+            return EnqueueWorkload(networkId, inputTensors, outputTensors);
+        }
+
+        experimental::IWorkingMemHandle* workingMemHandle = nullptr;
+        {
+            std::lock_guard<std::mutex> lockGuard(m_Mutex);
+            auto& workingMemHandles = m_ThreadpoolWorkingMemHandles[networkId];
+            if (workingMemHandles.size() <= threadIndex)
+            {
+                workingMemHandles.resize(threadIndex + 1);
+            }
+            // Each handle is only ever used by the thread it belongs to
+            if (!workingMemHandles[threadIndex])
+            {
+                workingMemHandles[threadIndex] = loadedNetwork->CreateWorkingMemHandle(networkId);
+            }
+            workingMemHandle = workingMemHandles[threadIndex].get();
+        }
+
+        return Execute(*workingMemHandle, inputTensors, outputTensors);
+    }
+    catch (const std::exception& e)
+    {
+        ARMNN_LOG(error) << "An error occurred executing network " << networkId
+                         << " on the thread pool: " << e.what();
+        return Status::Failure;
+    }
 }
 
 void Runtime::RegisterDebugCallback(NetworkId networkId, const DebugCallbackFunction& func)
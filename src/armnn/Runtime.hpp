@@ -6,6 +6,7 @@
 
 #include "LoadedNetwork.hpp"
 #include "DeviceSpec.hpp"
+#include "Threadpool.hpp"
 
 #include <armnn/INetwork.hpp>
 #include <armnn/IRuntime.hpp>
@@ -19,6 +20,7 @@
 #include <IProfilingService.hpp>
 #include <IReportStructure.hpp>
 
+#include <condition_variable>
 #include <mutex>
 #include <unordered_map>
 
@@ -61,6 +63,46 @@ public:
         const InputTensors& inputTensors,
         const OutputTensors& outputTensors) override;
 
+    /// This is an experimental function.
+    /// Binds input and output buffers to a network, creating the workloads copying the data in and out once.
+    virtual std::unique_ptr<experimental::IBoundIOBuffers> BindIOBuffers(NetworkId networkId,
+                                                                         const InputTensors& inputTensors,
+                                                                         const OutputTensors& outputTensors) override;
+
+    /// This is an experimental function.
+    /// Evaluates a network using the input and output buffers bound with BindIOBuffers().
+    virtual Status EnqueueWorkload(experimental::IBoundIOBuffers& boundIOBuffers) override;
+
+    /// This is an experimental function.
+    /// Evaluates a network using input in inputTensors and outputs filled into outputTensors.
+    /// This function performs a thread safe execution of the network. Returns once execution is complete.
+    /// Will block until this and any other thread using the same workingMem object completes.
+    virtual Status Execute(experimental::IWorkingMemHandle& workingMemHandle,
+                           const InputTensors& inputTensors,
+                           const OutputTensors& outputTensors) override;
+
+    /// This is an experimental function.
+    /// Creates a new working memory handle for the given network, used as the intermediate tensor
+    /// storage of a call to Execute().
+    virtual std::unique_ptr<experimental::IWorkingMemHandle> CreateWorkingMemHandle(NetworkId networkId) override;
+
+    /// This is an experimental function.
+    /// Schedules an evaluation of the network on the thread pool of the runtime and returns immediately.
+    /// The returned future becomes ready once the execution has completed.
+    virtual std::future<Status> EnqueueWorkloadAsync(NetworkId networkId,
+                                                     const InputTensors& inputTensors,
+                                                     const OutputTensors& outputTensors,
+                                                     QosExecPriority priority = QosExecPriority::Medium) override;
+
+    /// This is an experimental function.
+    /// Schedules an evaluation of the network on the thread pool of the runtime and returns immediately.
+    /// The callback is notified once the execution has completed.
+    virtual void EnqueueWorkloadAsync(NetworkId networkId,
+                                      const InputTensors& inputTensors,
+                                      const OutputTensors& outputTensors,
+                                      QosExecPriority priority,
+                                      experimental::IAsyncExecutionCallbackPtr callback) override;
+
     /// Unloads a network from the Runtime.
     /// At the moment this only removes the network from the m_Impl->m_Network.
     /// This might need more work in the future to be AndroidNN compliant.
@@ -98,6 +140,21 @@ private:
 
     LoadedNetwork* GetLoadedNetworkPtr(NetworkId networkId) const;
 
+    /// Frees the working memory of the network last evaluated by the calling thread if it is not networkId.
+    void FreeWorkingMemoryOfPreviousNetwork(NetworkId networkId);
+
+    /// Returns the thread pool executing EnqueueWorkloadAsync(), starting it on first use.
+    experimental::Threadpool& GetThreadpool();
+
+    /// Counts an execution of the network scheduled with EnqueueWorkloadAsync() as complete, waking UnloadNetwork().
+    void EndThreadpoolExecution(NetworkId networkId);
+
+    /// Executes a network scheduled with EnqueueWorkloadAsync() on the given thread of the pool.
+    Status ExecuteOnThreadpool(NetworkId networkId,
+                               const InputTensors& inputTensors,
+                               const OutputTensors& outputTensors,
+                               unsigned int threadIndex);
+
     template<typename Func>
     void LoadedNetworkFuncSafe(NetworkId networkId, Func f)
     {
@@ -128,6 +185,21 @@ private:
 
     /// Profiling Service Instance
     profiling::ProfilingService m_ProfilingService;
+
+    /// Number of threads of the pool, from CreationOptions::m_NumberOfThreads
+    unsigned int m_NumberOfThreads;
+
+    /// Working memory of each thread of the pool for every async enabled network, indexed by thread index
+    std::unordered_map<NetworkId, std::vector<std::unique_ptr<experimental::IWorkingMemHandle>>>
+        m_ThreadpoolWorkingMemHandles;
+
+    /// Started on first use, joined by ~Runtime() before the networks are unloaded
+    std::unique_ptr<experimental::Threadpool> m_Threadpool;
+
+    /// Number of executions of each network queued or running on the thread pool, guarded by m_Mutex.
+    /// UnloadNetwork() waits on m_ExecutionsDone for the count of the network to drop to zero.
+    std::unordered_map<NetworkId, unsigned int> m_ThreadpoolExecutionCounts;
+    std::condition_variable m_ExecutionsDone;
 };
 
 } // namespace armnn
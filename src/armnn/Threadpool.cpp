@@ -0,0 +1,86 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "Threadpool.hpp"
+
+#include <algorithm>
+
+namespace armnn
+{
+
+namespace experimental
+{
+
+Threadpool::Threadpool(unsigned int numThreads)
+{
+    if (numThreads == 0)
+    {
+        numThreads = std::max(std::thread::hardware_concurrency(), 1u);
+    }
+
+    m_Threads.reserve(numThreads);
+    for (unsigned int threadIndex = 0; threadIndex < numThreads; ++threadIndex)
+    {
+        m_Threads.emplace_back(&Threadpool::ProcessJobs, this, threadIndex);
+    }
+}
+
+Threadpool::~Threadpool()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_JobMutex);
+        m_Terminate = true;
+    }
+    m_JobCondition.notify_all();
+
+    for (auto& thread : m_Threads)
+    {
+        thread.join();
+    }
+}
+
+void Threadpool::Schedule(Job job, QosExecPriority priority)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_JobMutex);
+        m_JobQueues[static_cast<size_t>(priority)].push(std::move(job));
+    }
+    m_JobCondition.notify_one();
+}
+
+void Threadpool::ProcessJobs(unsigned int threadIndex)
+{
+    while (true)
+    {
+        Job job;
+        {
+            std::unique_lock<std::mutex> lock(m_JobMutex);
+            auto hasJob = [this]()
+            {
+                return std::any_of(m_JobQueues.begin(), m_JobQueues.end(),
+                                   [](const std::queue<Job>& queue) { return !queue.empty(); });
+            };
+            m_JobCondition.wait(lock, [&]() { return m_Terminate || hasJob(); });
+
+            if (!hasJob())
+            {
+                // Terminating and every scheduled job has been taken
+                return;
+            }
+
+            // Take the oldest job of the highest priority
+            auto queue = std::find_if(m_JobQueues.rbegin(), m_JobQueues.rend(),
+                                      [](const std::queue<Job>& q) { return !q.empty(); });
+            job = std::move(queue->front());
+            queue->pop();
+        }
+
+        job(threadIndex);
+    }
+}
+
+} // namespace experimental
+
+} // namespace armnn
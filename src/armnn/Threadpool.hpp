@@ -0,0 +1,60 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include <armnn/Types.hpp>
+
+#include <array>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+namespace armnn
+{
+
+namespace experimental
+{
+
+/// Fixed size pool of threads executing jobs in order of priority.
+/// Jobs of the same priority are started in the order they were scheduled.
+class Threadpool
+{
+public:
+    /// A job receives the index, in the range [0, GetNumberOfThreads()), of the thread executing it.
+    using Job = std::function<void(unsigned int threadIndex)>;
+
+    /// Starts numThreads threads, a value of 0 selects the number of hardware threads.
+    explicit Threadpool(unsigned int numThreads);
+
+    /// Blocks until all scheduled jobs have been executed and the threads have been joined.
+    ~Threadpool();
+
+    Threadpool(const Threadpool&) = delete;
+    Threadpool& operator=(const Threadpool&) = delete;
+
+    /// Queues a job for execution on one of the threads of the pool. Returns immediately.
+    void Schedule(Job job, QosExecPriority priority = QosExecPriority::Medium);
+
+    unsigned int GetNumberOfThreads() const { return static_cast<unsigned int>(m_Threads.size()); }
+
+private:
+    void ProcessJobs(unsigned int threadIndex);
+
+    std::vector<std::thread> m_Threads;
+
+    /// One queue per QosExecPriority, indexed by its value.
+    std::array<std::queue<Job>, 3> m_JobQueues;
+
+    std::mutex m_JobMutex;
+    std::condition_variable m_JobCondition;
+    bool m_Terminate = false;
+};
+
+} // namespace experimental
+
+} // namespace armnn
@@ -30,12 +30,20 @@ void WallClockTimer::Stop()
 std::vector<Measurement> WallClockTimer::GetMeasurements() const
 {
     const auto delta       = std::chrono::duration<double, std::micro>(m_Stop - m_Start);
-    const auto startTimeMs = std::chrono::duration<double, std::micro>(m_Start.time_since_epoch());
-    const auto stopTimeMs  = std::chrono::duration<double, std::micro>(m_Stop.time_since_epoch());
 
-    return { { WALL_CLOCK_TIME,       delta.count(),       Measurement::Unit::TIME_US },
-             { WALL_CLOCK_TIME_START, startTimeMs.count(), Measurement::Unit::TIME_US },
-             { WALL_CLOCK_TIME_STOP,  stopTimeMs.count(),  Measurement::Unit::TIME_US } };
+    return { { WALL_CLOCK_TIME,       delta.count(),    Measurement::Unit::TIME_US },
+             { WALL_CLOCK_TIME_START, GetStartTimeUs(), Measurement::Unit::TIME_US },
+             { WALL_CLOCK_TIME_STOP,  GetStopTimeUs(),  Measurement::Unit::TIME_US } };
+}
+
+double WallClockTimer::GetStartTimeUs() const
+{
+    return std::chrono::duration<double, std::micro>(m_Start.time_since_epoch()).count();
+}
+
+double WallClockTimer::GetStopTimeUs() const
+{
+    return std::chrono::duration<double, std::micro>(m_Stop.time_since_epoch()).count();
 }
 
 } //namespace armnn
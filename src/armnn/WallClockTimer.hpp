@@ -54,6 +54,10 @@ public:
     // Get the recorded measurements
     std::vector<Measurement> GetMeasurements() const override;
 
+    // Get the start and stop times in microseconds, without building the measurements
+    double GetStartTimeUs() const;
+    double GetStopTimeUs() const;
+
 #if USE_CLOCK_MONOTONIC_RAW
     using clock = MonotonicClockRaw;
 #else
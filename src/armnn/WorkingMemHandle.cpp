@@ -0,0 +1,77 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "WorkingMemHandle.hpp"
+
+#include <armnn/Exceptions.hpp>
+
+#include <fmt/format.h>
+
+namespace armnn
+{
+
+namespace experimental
+{
+
+WorkingMemHandle::WorkingMemHandle(NetworkId networkId,
+                                   std::vector<WorkingMemDescriptor> workingMemDescriptors,
+                                   TensorHandleMap inputHandles,
+                                   TensorHandleMap outputHandles,
+                                   std::vector<std::unique_ptr<ITensorHandle>> tensorHandles,
+                                   std::function<void()> onDestruction)
+    : m_NetworkId(networkId)
+    , m_WorkingMemDescriptors(std::move(workingMemDescriptors))
+    , m_InputHandles(std::move(inputHandles))
+    , m_OutputHandles(std::move(outputHandles))
+    , m_TensorHandles(std::move(tensorHandles))
+    , m_OnDestruction(std::move(onDestruction))
+    , m_IsAllocated(false)
+{}
+
+WorkingMemHandle::~WorkingMemHandle()
+{
+    if (m_OnDestruction)
+    {
+        m_OnDestruction();
+    }
+}
+
+void WorkingMemHandle::Allocate()
+{
+    if (m_IsAllocated)
+    {
+        return;
+    }
+
+    for (auto& tensorHandle : m_TensorHandles)
+    {
+        tensorHandle->Allocate();
+    }
+    m_IsAllocated = true;
+}
+
+ITensorHandle* WorkingMemHandle::GetInputHandle(LayerBindingId bindingId) const
+{
+    auto it = m_InputHandles.find(bindingId);
+    if (it == m_InputHandles.end())
+    {
+        throw InvalidArgumentException(fmt::format("No input layer is associated with id {}", bindingId));
+    }
+    return it->second;
+}
+
+ITensorHandle* WorkingMemHandle::GetOutputHandle(LayerBindingId bindingId) const
+{
+    auto it = m_OutputHandles.find(bindingId);
+    if (it == m_OutputHandles.end())
+    {
+        throw InvalidArgumentException(fmt::format("No output layer is associated with id {}", bindingId));
+    }
+    return it->second;
+}
+
+} // end experimental namespace
+
+} // end armnn namespace
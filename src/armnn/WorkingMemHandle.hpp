@@ -0,0 +1,89 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include <armnn/IWorkingMemHandle.hpp>
+#include <armnn/Tensor.hpp>
+
+#include <armnn/backends/ITensorHandle.hpp>
+#include <armnn/backends/WorkingMemDescriptor.hpp>
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace armnn
+{
+
+namespace experimental
+{
+
+class WorkingMemHandle final : public IWorkingMemHandle
+{
+public:
+    using TensorHandleMap = std::unordered_map<LayerBindingId, ITensorHandle*>;
+
+    /// @param networkId - Id of the network the working memory was created for.
+    /// @param workingMemDescriptors - One descriptor per workload, in the order of the network's workload queue.
+    /// @param inputHandles - The output tensors of the network's input layers, keyed by binding id.
+    /// @param outputHandles - The tensors connected to the network's output layers, keyed by binding id.
+    /// @param tensorHandles - The tensors owned by this working memory. Constant tensors are shared
+    ///                        with the network and therefore not part of this list.
+    /// @param onDestruction - Called when the working memory is destroyed, if not empty.
+    WorkingMemHandle(NetworkId networkId,
+                     std::vector<WorkingMemDescriptor> workingMemDescriptors,
+                     TensorHandleMap inputHandles,
+                     TensorHandleMap outputHandles,
+                     std::vector<std::unique_ptr<ITensorHandle>> tensorHandles,
+                     std::function<void()> onDestruction = nullptr);
+
+    ~WorkingMemHandle();
+
+    NetworkId GetNetworkId() override
+    {
+        return m_NetworkId;
+    }
+
+    /// Allocate the backing memory required for execution. If this is not called, then allocation will be
+    /// deferred to execution time.
+    void Allocate() override;
+
+    bool IsAllocated() override
+    {
+        return m_IsAllocated;
+    }
+
+    std::mutex& GetMutex() override
+    {
+        return m_Mutex;
+    }
+
+    /// Get the WorkingMemDescriptor of the workload at the given position in the network's workload queue.
+    WorkingMemDescriptor& GetWorkingMemDescriptorAt(unsigned int id)
+    {
+        return m_WorkingMemDescriptors[id];
+    }
+
+    ITensorHandle* GetInputHandle(LayerBindingId bindingId) const;
+    ITensorHandle* GetOutputHandle(LayerBindingId bindingId) const;
+
+private:
+    NetworkId m_NetworkId;
+    std::vector<WorkingMemDescriptor> m_WorkingMemDescriptors;
+    TensorHandleMap m_InputHandles;
+    TensorHandleMap m_OutputHandles;
+    std::vector<std::unique_ptr<ITensorHandle>> m_TensorHandles;
+    std::function<void()> m_OnDestruction;
+
+    bool m_IsAllocated;
+    std::mutex m_Mutex;
+};
+
+} // end experimental namespace
+
+} // end armnn namespace
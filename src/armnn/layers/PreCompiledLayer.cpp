@@ -49,6 +49,11 @@ void PreCompiledLayer::SetPreCompiledObject(PreCompiledObjectPtr preCompiledObje
     m_PreCompiledObject = std::move(preCompiledObject);
 }
 
+const void* PreCompiledLayer::GetPreCompiledObject() const
+{
+    return m_PreCompiledObject.get();
+}
+
 void PreCompiledLayer::Accept(ILayerVisitor& visitor) const
 {
     IgnoreUnused(visitor);
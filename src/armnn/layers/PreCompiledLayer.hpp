@@ -33,6 +33,8 @@ public:
 
     void SetPreCompiledObject(PreCompiledObjectPtr preCompiledObject);
 
+    const void* GetPreCompiledObject() const;
+
     void Accept(ILayerVisitor& visitor) const override;
 
 private:
@@ -0,0 +1,242 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include "Optimization.hpp"
+
+#include <armnn/BackendRegistry.hpp>
+#include <armnn/Logging.hpp>
+#include <armnn/backends/IBackendInternal.hpp>
+
+#include <backendsCommon/CpuTensorHandle.hpp>
+#include <backendsCommon/WorkloadFactory.hpp>
+
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace armnn
+{
+namespace optimizations
+{
+
+/// Replaces a layer whose inputs are all computed from ConstantLayers with ConstantLayers holding its outputs,
+/// evaluated once at optimisation time by running the CpuRef workloads of the layers it depends on. A chain of such
+/// layers is folded from its last layer, the Optimizer then removes the layers before it, which are left unconnected.
+/// Nothing is folded if the CpuRef backend is not registered or does not support one of the layers.
+class FoldConstantsImpl
+{
+public:
+    void Run(Graph& graph, Layer& layer) const
+    {
+        if (layer.GetType() == LayerType::Constant || layer.IsOutputUnconnected() ||
+            !BackendRegistryInstance().IsBackendRegistered(Compute::CpuRef) || !IsComputedFromConstants(layer))
+        {
+            return;
+        }
+
+        IBackendInternalUniquePtr backend = BackendRegistryInstance().GetFactory(Compute::CpuRef)();
+        IBackendInternal::IWorkloadFactoryPtr workloadFactory = backend->CreateWorkloadFactory();
+
+        std::vector<Layer*> evaluatedLayers;
+        try
+        {
+            Evaluate(layer, *workloadFactory, evaluatedLayers);
+            ReplaceWithConstants(graph, layer);
+        }
+        catch (const Exception& e)
+        {
+            ARMNN_LOG(warning) << "Failed to fold the constant layer " << layer.GetName() << ": " << e.what();
+        }
+
+        // The tensor handles of the optimised graph are only created when it is loaded
+        for (Layer* evaluatedLayer : evaluatedLayers)
+        {
+            for (unsigned int i = 0; i < evaluatedLayer->GetNumOutputSlots(); ++i)
+            {
+                evaluatedLayer->GetOutputHandler(i).SetData(nullptr);
+            }
+        }
+    }
+
+protected:
+    FoldConstantsImpl() = default;
+    ~FoldConstantsImpl() = default;
+
+private:
+    /// Returns whether a layer can be decided without looking at its inputs, in which case isComputedFromConstants
+    /// is set.
+    static bool IsDecidedByType(const Layer& layer, bool& isComputedFromConstants)
+    {
+        switch (layer.GetType())
+        {
+            case LayerType::Constant:
+                isComputedFromConstants = true;
+                return true;
+            case LayerType::Input:
+            case LayerType::Output:
+            case LayerType::Debug:
+            case LayerType::MemCopy:
+            case LayerType::MemImport:
+            case LayerType::PreCompiled:
+            case LayerType::StandIn:
+                isComputedFromConstants = false;
+                return true;
+            default:
+                isComputedFromConstants = false;
+                return layer.GetNumInputSlots() == 0;
+        }
+    }
+
+    /// Returns whether a layer is a ConstantLayer or computes its outputs from ConstantLayers only, with workloads
+    /// the CpuRef backend supports. The layers it depends on are visited depth first with an explicit stack, and the
+    /// result for each layer is kept for the rest of the pass, so that every layer is only decided once. Folding
+    /// does not change the result for the layers already decided, and only adds ConstantLayers, which are decided
+    /// by their type.
+    bool IsComputedFromConstants(const Layer& layer) const
+    {
+        // Layers being decided, with the index of the next input to look at
+        std::vector<std::pair<const Layer*, unsigned int>> stack;
+        stack.emplace_back(&layer, 0);
+        while (!stack.empty())
+        {
+            const Layer& current = *stack.back().first;
+            bool isComputedFromConstants = false;
+            if (IsDecidedByType(current, isComputedFromConstants) ||
+                m_IsComputedFromConstants.count(&current) != 0)
+            {
+                stack.pop_back();
+                continue;
+            }
+
+            bool hasUndecidedInput = false;
+            bool allInputsFromConstants = true;
+            for (unsigned int& i = stack.back().second; i < current.GetNumInputSlots(); ++i)
+            {
+                const OutputSlot* connectedSlot = current.GetInputSlot(i).GetConnectedOutputSlot();
+                if (connectedSlot == nullptr)
+                {
+                    allInputsFromConstants = false;
+                    break;
+                }
+
+                const Layer& producer = connectedSlot->GetOwningLayer();
+                bool isProducerFromConstants = false;
+                if (!IsDecidedByType(producer, isProducerFromConstants))
+                {
+                    auto it = m_IsComputedFromConstants.find(&producer);
+                    if (it == m_IsComputedFromConstants.end())
+                    {
+                        hasUndecidedInput = true;
+                        break;
+                    }
+                    isProducerFromConstants = it->second;
+                }
+                if (!isProducerFromConstants)
+                {
+                    allInputsFromConstants = false;
+                    break;
+                }
+            }
+
+            if (hasUndecidedInput)
+            {
+                // Decides the producer first, this layer is then resumed from the same input
+                const unsigned int i = stack.back().second;
+                stack.emplace_back(&current.GetInputSlot(i).GetConnectedOutputSlot()->GetOwningLayer(), 0);
+                continue;
+            }
+
+            std::string reasonIfUnsupported;
+            m_IsComputedFromConstants[&current] = allInputsFromConstants &&
+                IWorkloadFactory::IsLayerSupported(Compute::CpuRef, current, EmptyOptional(), reasonIfUnsupported);
+            stack.pop_back();
+        }
+
+        bool isComputedFromConstants = false;
+        if (IsDecidedByType(layer, isComputedFromConstants))
+        {
+            return isComputedFromConstants;
+        }
+        return m_IsComputedFromConstants.at(&layer);
+    }
+
+    /// Computes the outputs of a layer, after those of the layers it depends on, into tensor handles set on its
+    /// output handlers. evaluatedLayers holds the layers whose outputs are computed, in the order they are computed.
+    /// The layers are visited depth first with an explicit stack, as in IsComputedFromConstants(), so that each
+    /// layer is evaluated once, after its producers, however long the chain.
+    static void Evaluate(Layer& layer, const IWorkloadFactory& workloadFactory, std::vector<Layer*>& evaluatedLayers)
+    {
+        std::unordered_set<const Layer*> visitedLayers;
+
+        // Layers to evaluate, with the index of the next input to look at
+        std::vector<std::pair<Layer*, unsigned int>> stack;
+        stack.emplace_back(&layer, 0);
+        visitedLayers.insert(&layer);
+        while (!stack.empty())
+        {
+            Layer& current = *stack.back().first;
+            unsigned int& i = stack.back().second;
+            if (i < current.GetNumInputSlots())
+            {
+                Layer& producer = current.GetInputSlot(i++).GetConnectedOutputSlot()->GetOwningLayer();
+                if (visitedLayers.insert(&producer).second)
+                {
+                    stack.emplace_back(&producer, 0);
+                }
+                continue;
+            }
+            stack.pop_back();
+
+            evaluatedLayers.push_back(&current);
+            for (unsigned int j = 0; j < current.GetNumOutputSlots(); ++j)
+            {
+                OutputHandler& outputHandler = current.GetOutputHandler(j);
+                outputHandler.CreateTensorHandles(workloadFactory, false);
+                outputHandler.GetData()->Allocate();
+            }
+
+            std::unique_ptr<IWorkload> workload = current.CreateWorkload(workloadFactory);
+            workload->PostAllocationConfigure();
+            workload->Execute();
+        }
+    }
+
+    /// Moves the connections of every output of an evaluated layer to a new ConstantLayer holding its values.
+    static void ReplaceWithConstants(Graph& graph, Layer& layer)
+    {
+        for (unsigned int i = 0; i < layer.GetNumOutputSlots(); ++i)
+        {
+            OutputSlot& outputSlot = layer.GetOutputSlot(i);
+            const TensorInfo& info = outputSlot.GetTensorInfo();
+
+            std::string name = std::string("folded-") + layer.GetName();
+            if (layer.GetNumOutputSlots() > 1)
+            {
+                name += "-" + std::to_string(i);
+            }
+
+            ITensorHandle* outputHandle = layer.GetOutputHandler(i).GetData();
+            auto constantLayer = graph.AddLayer<ConstantLayer>(name.c_str());
+            constantLayer->m_LayerOutput = std::make_unique<ScopedCpuTensorHandle>(
+                ConstTensor(info, outputHandle->Map()));
+            outputHandle->Unmap();
+
+            constantLayer->GetOutputSlot(0).SetTensorInfo(info);
+            outputSlot.MoveAllConnections(constantLayer->GetOutputSlot(0));
+        }
+    }
+
+    /// Layers decided by IsComputedFromConstants() during the pass, as an optimization is created for each pass
+    mutable std::unordered_map<const Layer*, bool> m_IsComputedFromConstants;
+};
+
+using FoldConstants = OptimizeForType<Layer, FoldConstantsImpl>;
+
+} // namespace optimizations
+} // namespace armnn
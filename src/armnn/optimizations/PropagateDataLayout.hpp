@@ -0,0 +1,548 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include "Optimization.hpp"
+
+#include <armnn/utility/PolymorphicDowncast.hpp>
+#include <armnnUtils/Permute.hpp>
+#include <armnnUtils/Transpose.hpp>
+
+#include <backendsCommon/CpuTensorHandle.hpp>
+
+#include <algorithm>
+#include <deque>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace armnn
+{
+namespace optimizations
+{
+
+/// Runs for every Permute and Transpose layer converting a 4D tensor between NCHW and NHWC. Such a layer is the
+/// boundary of the regions of the graph before and after it, made of the layers which can compute in either data
+/// layout: the layers with a m_DataLayout parameter, and the elementwise layers, which do not depend on it.
+/// Each region is switched to the other data layout by rewriting the m_DataLayout of its layers, when the bytes
+/// copied by the Permute and Transpose layers this removes at its boundaries are more than the bytes copied by the
+/// Permute layers it needs at its other boundaries. Chains of layers computing in the data layout of the model,
+/// between the conversions a parser added for them, thus no longer convert their tensors back and forth.
+class PropagateDataLayoutImpl
+{
+public:
+    void Run(Graph& graph, Layer& layer) const
+    {
+        DataLayout inputLayout;
+        DataLayout outputLayout;
+        if (!GetConvertedLayouts(layer, inputLayout, outputLayout))
+        {
+            return;
+        }
+
+        // The region consuming the output of the conversion, then the one producing its input
+        for (unsigned int i = 0; i < layer.GetOutputSlot(0).GetNumConnections(); ++i)
+        {
+            Layer& consumer = layer.GetOutputSlot(0).GetConnection(i)->GetOwningLayer();
+            if (SwitchRegionIfCheaper(graph, consumer, outputLayout, layer))
+            {
+                break;
+            }
+        }
+
+        const OutputSlot* connectedSlot = layer.GetInputSlot(0).GetConnectedOutputSlot();
+        if (!layer.IsOutputUnconnected() && connectedSlot != nullptr)
+        {
+            SwitchRegionIfCheaper(graph, connectedSlot->GetOwningLayer(), inputLayout, layer);
+        }
+    }
+
+protected:
+    PropagateDataLayoutImpl() = default;
+    ~PropagateDataLayoutImpl() = default;
+
+private:
+    /// Layers of the graph computing in the same data layout and connected to each other, with the Permute and
+    /// Transpose layers converting their inputs to it or their outputs from it, and the other connections to the
+    /// rest of the graph.
+    struct Region
+    {
+        std::set<Layer*> m_Layers;
+        std::set<Layer*> m_InputConversions;
+        std::set<Layer*> m_OutputConversions;
+        std::vector<InputSlot*> m_OtherInputs;
+        std::vector<InputSlot*> m_OtherOutputs;
+    };
+
+    /// Permutation of a 4D tensor from a data layout to the other one, as a PermutationVector of a Permute layer.
+    static PermutationVector GetPermutation(DataLayout from)
+    {
+        return from == DataLayout::NCHW ? PermutationVector({ 0, 3, 1, 2 }) : PermutationVector({ 0, 2, 3, 1 });
+    }
+
+    static DataLayout GetOtherLayout(DataLayout dataLayout)
+    {
+        return dataLayout == DataLayout::NCHW ? DataLayout::NHWC : DataLayout::NCHW;
+    }
+
+    /// Returns whether a layer is a Permute or Transpose layer converting a 4D tensor between NCHW and NHWC, and
+    /// which data layouts it converts between.
+    static bool GetConvertedLayouts(const Layer& layer, DataLayout& inputLayout, DataLayout& outputLayout)
+    {
+        const TensorShape shape({ 1, 2, 3, 4 });
+        TensorShape convertedShape;
+        if (layer.GetType() == LayerType::Permute)
+        {
+            const PermutationVector& permutation = PolymorphicDowncast<const PermuteLayer*>(&layer)->GetPermutation();
+            if (permutation.GetSize() != 4)
+            {
+                return false;
+            }
+            convertedShape = armnnUtils::Permuted(shape, permutation);
+        }
+        else if (layer.GetType() == LayerType::Transpose)
+        {
+            const PermutationVector& permutation =
+                PolymorphicDowncast<const TransposeLayer*>(&layer)->GetPermutation();
+            if (permutation.GetSize() != 4)
+            {
+                return false;
+            }
+            convertedShape = armnnUtils::TransposeTensorShape(shape, permutation);
+        }
+        else
+        {
+            return false;
+        }
+
+        if (convertedShape == armnnUtils::Permuted(shape, GetPermutation(DataLayout::NCHW)))
+        {
+            inputLayout = DataLayout::NCHW;
+            outputLayout = DataLayout::NHWC;
+            return true;
+        }
+        if (convertedShape == armnnUtils::Permuted(shape, GetPermutation(DataLayout::NHWC)))
+        {
+            inputLayout = DataLayout::NHWC;
+            outputLayout = DataLayout::NCHW;
+            return true;
+        }
+        return false;
+    }
+
+    /// Returns whether a layer can be part of a region computing in the given data layout.
+    static bool CanSwitchLayout(const Layer& layer, DataLayout dataLayout)
+    {
+        switch (layer.GetType())
+        {
+            case LayerType::Activation:
+            case LayerType::Addition:
+            case LayerType::Division:
+            case LayerType::ElementwiseUnary:
+            case LayerType::Floor:
+            case LayerType::Maximum:
+            case LayerType::Minimum:
+            case LayerType::Multiplication:
+            case LayerType::Subtraction:
+                break;
+            case LayerType::BatchNormalization:
+            case LayerType::Convolution2d:
+            case LayerType::DepthwiseConvolution2d:
+            case LayerType::L2Normalization:
+            case LayerType::Normalization:
+            case LayerType::Pooling2d:
+            case LayerType::Resize:
+                if (GetDataLayout(layer) != dataLayout)
+                {
+                    return false;
+                }
+                break;
+            default:
+                return false;
+        }
+
+        for (auto&& inputSlot : layer.GetInputSlots())
+        {
+            const OutputSlot* connectedSlot = inputSlot.GetConnectedOutputSlot();
+            if (connectedSlot == nullptr || !IsSwitchableTensor(connectedSlot->GetTensorInfo()))
+            {
+                return false;
+            }
+        }
+        for (auto&& outputSlot : layer.GetOutputSlots())
+        {
+            if (!IsSwitchableTensor(outputSlot.GetTensorInfo()))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    static bool IsSwitchableTensor(const TensorInfo& info)
+    {
+        return info.GetNumDimensions() == 4 && !info.HasPerAxisQuantization();
+    }
+
+    static DataLayout GetDataLayout(const Layer& layer)
+    {
+        switch (layer.GetType())
+        {
+            case LayerType::BatchNormalization:
+                return PolymorphicDowncast<const BatchNormalizationLayer*>(&layer)->GetParameters().m_DataLayout;
+            case LayerType::Convolution2d:
+                return PolymorphicDowncast<const Convolution2dLayer*>(&layer)->GetParameters().m_DataLayout;
+            case LayerType::DepthwiseConvolution2d:
+                return PolymorphicDowncast<const DepthwiseConvolution2dLayer*>(&layer)->GetParameters().m_DataLayout;
+            case LayerType::L2Normalization:
+                return PolymorphicDowncast<const L2NormalizationLayer*>(&layer)->GetParameters().m_DataLayout;
+            case LayerType::Normalization:
+                return PolymorphicDowncast<const NormalizationLayer*>(&layer)->GetParameters().m_DataLayout;
+            case LayerType::Pooling2d:
+                return PolymorphicDowncast<const Pooling2dLayer*>(&layer)->GetParameters().m_DataLayout;
+            default:
+                return PolymorphicDowncast<const ResizeLayer*>(&layer)->GetParameters().m_DataLayout;
+        }
+    }
+
+    /// Finds the region computing in dataLayout that a layer is part of, and switches it to the other data layout if
+    /// this copies fewer bytes. Returns whether the region has been switched.
+    static bool SwitchRegionIfCheaper(Graph& graph, Layer& start, DataLayout dataLayout, Layer& baseLayer)
+    {
+        Region region;
+        if (!CanSwitchLayout(start, dataLayout) || !FindRegion(start, dataLayout, region))
+        {
+            return false;
+        }
+
+        unsigned int removedBytes = 0;
+        for (Layer* conversion : region.m_InputConversions)
+        {
+            // Conversions also read outside of the region are kept
+            if (AreAllConsumersIn(*conversion, region.m_Layers))
+            {
+                removedBytes += conversion->GetOutputSlot(0).GetTensorInfo().GetNumBytes();
+            }
+        }
+        for (Layer* conversion : region.m_OutputConversions)
+        {
+            removedBytes += conversion->GetOutputSlot(0).GetTensorInfo().GetNumBytes();
+        }
+
+        unsigned int addedBytes = 0;
+        for (InputSlot* input : region.m_OtherInputs)
+        {
+            addedBytes += input->GetConnectedOutputSlot()->GetTensorInfo().GetNumBytes();
+        }
+        std::set<const OutputSlot*> convertedOutputs;
+        for (InputSlot* output : region.m_OtherOutputs)
+        {
+            if (convertedOutputs.insert(output->GetConnectedOutputSlot()).second)
+            {
+                addedBytes += output->GetConnectedOutputSlot()->GetTensorInfo().GetNumBytes();
+            }
+        }
+
+        if (removedBytes <= addedBytes)
+        {
+            return false;
+        }
+        SwitchRegion(graph, region, dataLayout);
+
+        // The Optimizer erases the layer it runs the optimization for once it is left unconnected
+        for (Layer* conversion : region.m_InputConversions)
+        {
+            if (conversion != &baseLayer && conversion->IsOutputUnconnected())
+            {
+                graph.EraseLayer(conversion);
+            }
+        }
+        for (Layer* conversion : region.m_OutputConversions)
+        {
+            if (conversion != &baseLayer)
+            {
+                graph.EraseLayer(conversion);
+            }
+        }
+        return true;
+    }
+
+    /// Collects the layers of the region of a layer, and its connections to the rest of the graph. Returns false if
+    /// a conversion at the boundary of the region is connected to it on both sides, which switching would not remove.
+    static bool FindRegion(Layer& start, DataLayout dataLayout, Region& region)
+    {
+        std::deque<Layer*> toVisit = { &start };
+        region.m_Layers.insert(&start);
+
+        auto visit = [&](Layer& layer)
+        {
+            if (region.m_Layers.insert(&layer).second)
+            {
+                toVisit.push_back(&layer);
+            }
+        };
+
+        DataLayout inputLayout;
+        DataLayout outputLayout;
+        while (!toVisit.empty())
+        {
+            Layer& layer = *toVisit.front();
+            toVisit.pop_front();
+
+            for (auto&& inputSlot : layer.GetInputSlots())
+            {
+                Layer& producer = inputSlot.GetConnectedOutputSlot()->GetOwningLayer();
+                if (CanSwitchLayout(producer, dataLayout))
+                {
+                    visit(producer);
+                }
+                else if (GetConvertedLayouts(producer, inputLayout, outputLayout) && outputLayout == dataLayout)
+                {
+                    // The other layers reading the converted tensor read its input instead
+                    region.m_InputConversions.insert(&producer);
+                    for (unsigned int i = 0; i < producer.GetOutputSlot(0).GetNumConnections(); ++i)
+                    {
+                        Layer& consumer = producer.GetOutputSlot(0).GetConnection(i)->GetOwningLayer();
+                        if (CanSwitchLayout(consumer, dataLayout))
+                        {
+                            visit(consumer);
+                        }
+                    }
+                }
+            }
+
+            for (auto&& outputSlot : layer.GetOutputSlots())
+            {
+                for (InputSlot* connection : outputSlot.GetConnections())
+                {
+                    Layer& consumer = connection->GetOwningLayer();
+                    if (CanSwitchLayout(consumer, dataLayout))
+                    {
+                        visit(consumer);
+                    }
+                    else if (GetConvertedLayouts(consumer, inputLayout, outputLayout) && inputLayout == dataLayout)
+                    {
+                        region.m_OutputConversions.insert(&consumer);
+                    }
+                }
+            }
+        }
+
+        for (Layer* layer : region.m_Layers)
+        {
+            for (unsigned int i = 0; i < layer->GetNumInputSlots(); ++i)
+            {
+                InputSlot& inputSlot = layer->GetInputSlot(i);
+                Layer* producer = &inputSlot.GetConnectedOutputSlot()->GetOwningLayer();
+                if (region.m_Layers.count(producer) == 0 && region.m_InputConversions.count(producer) == 0)
+                {
+                    if (region.m_OutputConversions.count(producer) != 0)
+                    {
+                        return false;
+                    }
+                    region.m_OtherInputs.push_back(&inputSlot);
+                }
+            }
+            for (auto&& outputSlot : layer->GetOutputSlots())
+            {
+                for (InputSlot* connection : outputSlot.GetConnections())
+                {
+                    Layer* consumer = &connection->GetOwningLayer();
+                    if (region.m_Layers.count(consumer) == 0 && region.m_OutputConversions.count(consumer) == 0)
+                    {
+                        if (region.m_InputConversions.count(consumer) != 0)
+                        {
+                            return false;
+                        }
+                        region.m_OtherOutputs.push_back(connection);
+                    }
+                }
+            }
+        }
+        return true;
+    }
+
+    static bool AreAllConsumersIn(const Layer& layer, const std::set<Layer*>& layers)
+    {
+        for (const InputSlot* connection : layer.GetOutputSlot(0).GetConnections())
+        {
+            if (layers.count(&connection->GetOwningLayer()) == 0)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /// Switches the layers of a region from dataLayout to the other data layout, removes the conversions at its
+    /// boundaries and adds Permute layers at its other connections to the rest of the graph.
+    static void SwitchRegion(Graph& graph, Region& region, DataLayout dataLayout)
+    {
+        const DataLayout otherLayout = GetOtherLayout(dataLayout);
+        const PermutationVector toOtherLayout = GetPermutation(dataLayout);
+        const PermutationVector fromOtherLayout = GetPermutation(otherLayout);
+
+        // The layers of the region read the inputs of the conversions to their data layout
+        for (Layer* conversion : region.m_InputConversions)
+        {
+            OutputSlot& convertedSlot = *conversion->GetInputSlot(0).GetConnectedOutputSlot();
+            std::vector<InputSlot*> connections = conversion->GetOutputSlot(0).GetConnections();
+            for (InputSlot* connection : connections)
+            {
+                if (region.m_Layers.count(&connection->GetOwningLayer()) != 0)
+                {
+                    conversion->GetOutputSlot(0).Disconnect(*connection);
+                    convertedSlot.Connect(*connection);
+                }
+            }
+        }
+
+        // The other layers reading the outputs of the region read them through a conversion to the previous layout
+        std::map<OutputSlot*, PermuteLayer*> outputPermutes;
+        for (InputSlot* connection : region.m_OtherOutputs)
+        {
+            OutputSlot& outputSlot = *connection->GetConnectedOutputSlot();
+            PermuteLayer*& permute = outputPermutes[&outputSlot];
+            if (permute == nullptr)
+            {
+                const std::string name = std::string("layout-") + outputSlot.GetOwningLayer().GetName();
+                permute = graph.AddLayer<PermuteLayer>(PermuteDescriptor(fromOtherLayout), name.c_str());
+                permute->GetOutputSlot(0).SetTensorInfo(outputSlot.GetTensorInfo());
+                outputSlot.Connect(permute->GetInputSlot(0));
+            }
+            outputSlot.Disconnect(*connection);
+            permute->GetOutputSlot(0).Connect(*connection);
+        }
+
+        // The other inputs of the region are converted to its new data layout
+        for (InputSlot* inputSlot : region.m_OtherInputs)
+        {
+            const TensorInfo& info = inputSlot->GetConnectedOutputSlot()->GetTensorInfo();
+            const std::string name = std::string("layout-") + inputSlot->GetOwningLayer().GetName();
+            PermuteLayer& permute = *graph.InsertNewLayer<PermuteLayer>(*inputSlot,
+                                                                        PermuteDescriptor(toOtherLayout),
+                                                                        name.c_str());
+            permute.GetOutputSlot(0).SetTensorInfo(armnnUtils::Permuted(info, toOtherLayout));
+        }
+
+        for (Layer* layer : region.m_Layers)
+        {
+            for (unsigned int i = 0; i < layer->GetNumOutputSlots(); ++i)
+            {
+                OutputSlot& outputSlot = layer->GetOutputSlot(i);
+                outputSlot.SetTensorInfo(armnnUtils::Permuted(outputSlot.GetTensorInfo(), toOtherLayout));
+            }
+            SwitchDataLayout(graph, *layer, otherLayout, toOtherLayout);
+        }
+
+        // The conversions from the data layout of the region are no longer needed, the layers reading their outputs
+        // read the outputs of the region, which have the same tensor infos
+        for (Layer* conversion : region.m_OutputConversions)
+        {
+            conversion->GetOutputSlot(0).MoveAllConnections(*conversion->GetInputSlot(0).GetConnectedOutputSlot());
+        }
+    }
+
+    /// Replaces a layer with a m_DataLayout parameter with a copy using the given data layout. The other layers of
+    /// the region are left as they are.
+    static void SwitchDataLayout(Graph& graph, Layer& layer, DataLayout dataLayout,
+                                 const PermutationVector& permutation)
+    {
+        switch (layer.GetType())
+        {
+            case LayerType::BatchNormalization:
+                ReplaceLayer(graph, *PolymorphicDowncast<BatchNormalizationLayer*>(&layer), dataLayout, permutation);
+                break;
+            case LayerType::Convolution2d:
+                ReplaceLayer(graph, *PolymorphicDowncast<Convolution2dLayer*>(&layer), dataLayout, permutation);
+                break;
+            case LayerType::DepthwiseConvolution2d:
+                ReplaceLayer(graph, *PolymorphicDowncast<DepthwiseConvolution2dLayer*>(&layer), dataLayout,
+                             permutation);
+                break;
+            case LayerType::L2Normalization:
+                ReplaceLayer(graph, *PolymorphicDowncast<L2NormalizationLayer*>(&layer), dataLayout, permutation);
+                break;
+            case LayerType::Normalization:
+                ReplaceLayer(graph, *PolymorphicDowncast<NormalizationLayer*>(&layer), dataLayout, permutation);
+                break;
+            case LayerType::Pooling2d:
+                ReplaceLayer(graph, *PolymorphicDowncast<Pooling2dLayer*>(&layer), dataLayout, permutation);
+                break;
+            case LayerType::Resize:
+                ReplaceLayer(graph, *PolymorphicDowncast<ResizeLayer*>(&layer), dataLayout, permutation);
+                break;
+            default:
+                break;
+        }
+    }
+
+    template <typename LayerT>
+    static void ReplaceLayer(Graph& graph, LayerT& layer, DataLayout dataLayout, const PermutationVector& permutation)
+    {
+        typename LayerT::DescriptorType descriptor = layer.GetParameters();
+        descriptor.m_DataLayout = dataLayout;
+
+        LayerT& replacement = *graph.AddLayer<LayerT>(descriptor, layer.GetName());
+        MoveConstants(layer, replacement, permutation);
+
+        for (unsigned int i = 0; i < layer.GetNumInputSlots(); ++i)
+        {
+            OutputSlot& connectedSlot = *layer.GetInputSlot(i).GetConnectedOutputSlot();
+            connectedSlot.Disconnect(layer.GetInputSlot(i));
+            connectedSlot.Connect(replacement.GetInputSlot(i));
+        }
+        for (unsigned int i = 0; i < layer.GetNumOutputSlots(); ++i)
+        {
+            replacement.GetOutputSlot(i).SetTensorInfo(layer.GetOutputSlot(i).GetTensorInfo());
+            layer.GetOutputSlot(i).MoveAllConnections(replacement.GetOutputSlot(i));
+        }
+        Layer* replacedLayer = &layer;
+        graph.EraseLayer(replacedLayer);
+    }
+
+    template <typename LayerT>
+    static void MoveConstants(LayerT&, LayerT&, const PermutationVector&)
+    {}
+
+    /// The weights of a Convolution2d layer are in its data layout, OHWI for NHWC and OIHW for NCHW.
+    static void MoveConstants(Convolution2dLayer& layer, Convolution2dLayer& replacement,
+                              const PermutationVector& permutation)
+    {
+        const TensorInfo& weightsInfo = layer.m_Weight->GetTensorInfo();
+        const TensorInfo permutedInfo = armnnUtils::Permuted(weightsInfo, permutation, true);
+        std::vector<char> permutedData(permutedInfo.GetNumBytes());
+        armnnUtils::Permute(permutedInfo.GetShape(), permutation, layer.m_Weight->Map(true), permutedData.data(),
+                            GetDataTypeSize(weightsInfo.GetDataType()));
+        layer.m_Weight->Unmap();
+
+        replacement.m_Weight = std::make_unique<ScopedCpuTensorHandle>(ConstTensor(permutedInfo, permutedData));
+        replacement.m_Bias = std::move(layer.m_Bias);
+    }
+
+    /// The weights of a DepthwiseConvolution2d layer are MIHW whatever its data layout.
+    static void MoveConstants(DepthwiseConvolution2dLayer& layer, DepthwiseConvolution2dLayer& replacement,
+                              const PermutationVector&)
+    {
+        replacement.m_Weight = std::move(layer.m_Weight);
+        replacement.m_Bias = std::move(layer.m_Bias);
+    }
+
+    static void MoveConstants(BatchNormalizationLayer& layer, BatchNormalizationLayer& replacement,
+                              const PermutationVector&)
+    {
+        replacement.m_Mean = std::move(layer.m_Mean);
+        replacement.m_Variance = std::move(layer.m_Variance);
+        replacement.m_Beta = std::move(layer.m_Beta);
+        replacement.m_Gamma = std::move(layer.m_Gamma);
+    }
+};
+
+using PropagateDataLayout = OptimizeForType<Layer, PropagateDataLayoutImpl>;
+
+} // namespace optimizations
+} // namespace armnn
@@ -9,6 +9,7 @@
 #include <Graph.hpp>
 #include <Network.hpp>
 #include <Optimizer.hpp>
+#include <Profiling.hpp>
 
 #include <armnn/BackendRegistry.hpp>
 #include <armnn/INetwork.hpp>
@@ -23,6 +24,8 @@
 
 #include <boost/test/unit_test.hpp>
 
+#include <sstream>
+
 using namespace armnn;
 
 namespace
@@ -912,4 +915,44 @@ BOOST_AUTO_TEST_CASE(OptimizeForExclusiveConnectionsWithoutFuseTest)
                              &IsLayerOfType<armnn::OutputLayer>,
                              &IsLayerOfType<armnn::OutputLayer>));
 }
+
+BOOST_AUTO_TEST_CASE(OptimizerPassVisitsLongChainsAndReportsTimes)
+{
+    using namespace armnn::optimizations;
+
+    armnn::Graph graph;
+
+    auto output = graph.AddLayer<armnn::OutputLayer>(0, "output");
+    graph.InsertNewLayer<armnn::InputLayer>(output->GetInputSlot(0), 0, "input");
+
+    // Pairs of inverse permutes are only removed by a single pass if it carries on from the changes it makes
+    const unsigned int numPairs = 500;
+    for (unsigned int i = 0; i < numPairs; ++i)
+    {
+        graph.InsertNewLayer<armnn::PermuteLayer>(output->GetInputSlot(0), armnn::PermuteDescriptor({ 0, 2, 3, 1 }),
+                                                  "perm0231");
+        graph.InsertNewLayer<armnn::PermuteLayer>(output->GetInputSlot(0), armnn::PermuteDescriptor({ 0, 3, 1, 2 }),
+                                                  "perm0312");
+    }
+    BOOST_TEST(graph.GetNumLayers() == 2 + 2 * numPairs);
+
+    std::unique_ptr<armnn::Profiler> profiler = std::make_unique<armnn::Profiler>();
+    armnn::ProfilerManager::GetInstance().RegisterProfiler(profiler.get());
+    profiler->EnableProfiling(true);
+
+    armnn::Optimizer::Pass(graph, armnn::MakeOptimizations(OptimizeInversePermutes(), SquashEqualPermuteSiblings()));
+
+    armnn::ProfilerManager::GetInstance().RegisterProfiler(nullptr);
+
+    BOOST_TEST(CheckSequence(graph.cbegin(), graph.cend(), &IsLayerOfType<armnn::InputLayer>,
+                             &IsLayerOfType<armnn::OutputLayer>));
+
+    // The time spent in each optimization is reported within the event of the pass
+    std::stringstream results;
+    profiler->AnalyzeEventsAndWriteResults(results);
+    BOOST_TEST(results.str().find("Optimizer::Pass") != std::string::npos);
+    BOOST_TEST(results.str().find("OptimizeInversePermutesImpl") != std::string::npos);
+    BOOST_TEST(results.str().find("SquashEqualSiblingsImpl") != std::string::npos);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
\ No newline at end of file
@@ -10,9 +10,14 @@
 #include <boost/test/unit_test.hpp>
 #include <boost/test/tools/output_test_stream.hpp>
 
+#include <Filesystem.hpp>
+#include <LatencyHistogram.hpp>
+
+#include <fstream>
 #include <memory>
 #include <thread>
 #include <ostream>
+#include <sstream>
 
 #include <Profiling.hpp>
 
@@ -28,6 +33,16 @@ size_t GetProfilerEventSequenceSize(armnn::Profiler* profiler)
 
     return profiler->m_EventSequence.size();
 }
+
+size_t GetProfilerRecordedEventCount(armnn::Profiler* profiler)
+{
+    size_t count = 0;
+    for (const auto& recordedInference : profiler->m_RecordedInferences)
+    {
+        count += recordedInference.size();
+    }
+    return count;
+}
 } // namespace armnn
 
 namespace
@@ -251,6 +266,279 @@ BOOST_AUTO_TEST_CASE(WriteEventResults)
     profiler->EnableProfiling(false);
 }
 
+BOOST_AUTO_TEST_CASE(ProfilerRingBuffer)
+{
+    armnn::ProfilerManager& profilerManager = armnn::ProfilerManager::GetInstance();
+    std::unique_ptr<armnn::Profiler> profiler = std::make_unique<armnn::Profiler>();
+    profilerManager.RegisterProfiler(profiler.get());
+
+    profiler->SetMaxRecordedInferences(2);
+    profiler->EnableProfiling(true);
+
+    for (unsigned int inference = 0; inference < 5; ++inference)
+    {
+        ARMNN_SCOPED_PROFILING_EVENT(armnn::Compute::CpuRef, "EnqueueWorkload");
+        {
+            ARMNN_SCOPED_PROFILING_EVENT(armnn::Compute::CpuRef, "Execute");
+            {
+                ARMNN_SCOPED_PROFILING_EVENT(armnn::Compute::CpuRef, "Workload_Execute");
+            }
+        }
+    }
+
+    // Only the events of the last two inferences are kept
+    BOOST_TEST(armnn::GetProfilerEventSequenceSize(profiler.get()) == 0);
+    BOOST_TEST(armnn::GetProfilerRecordedEventCount(profiler.get()) == 6);
+
+    std::stringstream output;
+    profiler->AnalyzeEventsAndWriteResults(output);
+    BOOST_TEST(output.str().find("Workload_Execute") != std::string::npos);
+    BOOST_TEST(output.str().find("CpuRef") != std::string::npos);
+    BOOST_TEST(output.str().find("> Begin Inference: 1") != std::string::npos);
+    BOOST_TEST(output.str().find("> Begin Inference: 2") == std::string::npos);
+
+    std::stringstream json;
+    profiler->Print(json);
+    BOOST_TEST(json.str().find("Workload_Execute_#3") != std::string::npos);
+
+    // Going back to recording every event drops the recorded ones
+    profiler->SetMaxRecordedInferences(0);
+    BOOST_TEST(armnn::GetProfilerRecordedEventCount(profiler.get()) == 0);
+    {
+        ARMNN_SCOPED_PROFILING_EVENT(armnn::Compute::CpuRef, "EnqueueWorkload");
+    }
+    BOOST_TEST(armnn::GetProfilerEventSequenceSize(profiler.get()) == 1);
+
+    profiler->EnableProfiling(false);
+    armnn::ProfilerManager::GetInstance().RegisterProfiler(nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(InternedEventNames)
+{
+    const armnn::ProfilingEventId id = armnn::ProfilingEventNames::Intern("InternedEventNames_Execute");
+    BOOST_TEST(armnn::ProfilingEventNames::Intern(std::string("InternedEventNames_") + "Execute") == id);
+    BOOST_TEST(armnn::ProfilingEventNames::Intern("InternedEventNames_Other") != id);
+    BOOST_TEST(armnn::ProfilingEventNames::GetName(id) == "InternedEventNames_Execute");
+
+    armnn::ProfilerManager& profilerManager = armnn::ProfilerManager::GetInstance();
+    std::unique_ptr<armnn::Profiler> profiler = std::make_unique<armnn::Profiler>();
+    profilerManager.RegisterProfiler(profiler.get());
+    profiler->SetMaxRecordedInferences(1);
+    profiler->EnableProfiling(true);
+
+    // Every pass of a call site records the name interned on the first one, with the wall clock time of that pass
+    for (unsigned int pass = 0; pass < 3; ++pass)
+    {
+        ARMNN_SCOPED_PROFILING_EVENT(armnn::Compute::CpuRef, "EnqueueWorkload");
+        ARMNN_SCOPED_PROFILING_EVENT(armnn::Compute::CpuRef, std::string("InternedEventNames_") + "Execute");
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    std::stringstream output;
+    profiler->AnalyzeEventsAndWriteResults(output);
+    BOOST_TEST(output.str().find("InternedEventNames_Execute") != std::string::npos);
+    BOOST_TEST(output.str().find(" 0.000000 ") == std::string::npos);
+
+    profiler->EnableProfiling(false);
+    armnn::ProfilerManager::GetInstance().RegisterProfiler(nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(ProfilerChromeTrace)
+{
+    fs::path fileName = armnnUtils::Filesystem::NamedTempFile("Armnn-ProfilerChromeTrace.json");
+
+    armnn::ProfilerManager& profilerManager = armnn::ProfilerManager::GetInstance();
+    std::unique_ptr<armnn::Profiler> profiler = std::make_unique<armnn::Profiler>();
+    profilerManager.RegisterProfiler(profiler.get());
+    profiler->SetTraceFile(fileName.string());
+    profiler->EnableProfiling(true);
+
+    auto RunInference = []()
+    {
+        ARMNN_SCOPED_PROFILING_EVENT(armnn::Compute::CpuRef, "EnqueueWorkload");
+        {
+            ARMNN_SCOPED_PROFILING_EVENT(armnn::Compute::CpuRef, "Workload_\"Execute\"");
+        }
+    };
+    RunInference();
+    profiler->RecordCounter("Working Memory", "bytes", 1024);
+
+    // The second inference runs on another thread, which reports to its own profiler and gets its own lane in the
+    // same file
+    std::thread thread([&profiler, &RunInference]()
+    {
+        armnn::ProfilerManager::GetInstance().RegisterProfiler(profiler->GetThreadProfiler());
+        RunInference();
+        armnn::ProfilerManager::GetInstance().RegisterProfiler(nullptr);
+    });
+    thread.join();
+
+    // The events are in the file as soon as their inference ends
+    std::string trace;
+    {
+        std::ifstream file(fileName.string());
+        trace.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+    BOOST_TEST(trace.find("\"args\":{\"inference\":1}") != std::string::npos);
+
+    profiler->SetTraceFile("");
+    {
+        std::ifstream file(fileName.string());
+        trace.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+    fs::remove(fileName);
+
+    BOOST_TEST(trace.front() == '[');
+    BOOST_TEST(trace.find("\n]") != std::string::npos);
+    BOOST_TEST(trace.find("{\"name\":\"Workload_\\\"Execute\\\"\",\"cat\":\"CpuRef\",\"ph\":\"X\"")
+               != std::string::npos);
+    BOOST_TEST(trace.find("\"pid\":1,\"tid\":1,\"args\":{\"inference\":0}") != std::string::npos);
+    BOOST_TEST(trace.find("\"pid\":1,\"tid\":2,\"args\":{\"inference\":1}") != std::string::npos);
+    BOOST_TEST(trace.find("{\"name\":\"Working Memory\",\"ph\":\"C\"") != std::string::npos);
+    BOOST_TEST(trace.find("\"args\":{\"bytes\":1024}}") != std::string::npos);
+
+    profiler->EnableProfiling(false);
+    armnn::ProfilerManager::GetInstance().RegisterProfiler(nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(LatencyHistogramPercentiles)
+{
+    armnn::LatencyHistogram histogram;
+    BOOST_TEST(histogram.GetPercentileUs(50.0) == 0.0);
+
+    // 1us to 1000us, in an order which is not sorted
+    for (unsigned int i = 0; i < 1000; ++i)
+    {
+        histogram.Record(static_cast<double>((i * 7) % 1000 + 1));
+    }
+    BOOST_TEST(histogram.GetCount() == 1000);
+    BOOST_TEST(histogram.GetMinUs() == 1.0);
+    BOOST_TEST(histogram.GetMaxUs() == 1000.0);
+    BOOST_TEST(histogram.GetPercentileUs(50.0) == 500.0, boost::test_tools::tolerance(0.01));
+    BOOST_TEST(histogram.GetPercentileUs(90.0) == 900.0, boost::test_tools::tolerance(0.01));
+    BOOST_TEST(histogram.GetPercentileUs(99.0) == 990.0, boost::test_tools::tolerance(0.01));
+    BOOST_TEST(histogram.GetPercentileUs(99.9) == 999.0, boost::test_tools::tolerance(0.01));
+    BOOST_TEST(histogram.GetPercentileUs(100.0) == 1000.0, boost::test_tools::tolerance(0.01));
+    BOOST_TEST(histogram.GetPercentileUs(0.0) == 1.0, boost::test_tools::tolerance(0.01));
+
+    // A single long duration only shows in the tail
+    histogram.Record(100000.0);
+    BOOST_TEST(histogram.GetPercentileUs(99.9) == 1000.0, boost::test_tools::tolerance(0.01));
+    BOOST_TEST(histogram.GetPercentileUs(100.0) == 100000.0, boost::test_tools::tolerance(0.01));
+}
+
+BOOST_AUTO_TEST_CASE(ProfilerEventLatencies)
+{
+    armnn::ProfilerManager& profilerManager = armnn::ProfilerManager::GetInstance();
+    std::unique_ptr<armnn::Profiler> profiler = std::make_unique<armnn::Profiler>();
+    profilerManager.RegisterProfiler(profiler.get());
+    profiler->SetMaxRecordedInferences(1);
+    profiler->EnableProfiling(true);
+
+    for (unsigned int inference = 0; inference < 10; ++inference)
+    {
+        ARMNN_SCOPED_PROFILING_EVENT(armnn::Compute::CpuRef, "EnqueueWorkload");
+        for (unsigned int workload = 0; workload < 2; ++workload)
+        {
+            ARMNN_SCOPED_PROFILING_EVENT(armnn::Compute::CpuRef, "ProfilerEventLatencies_Execute");
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+        }
+    }
+
+    // The latencies cover every inference, not only the recorded one
+    std::vector<armnn::ProfilingEventLatencies> latencies = profiler->GetEventLatencies();
+    BOOST_TEST(latencies.size() == 2);
+    BOOST_TEST(latencies[0].m_Name == "EnqueueWorkload");
+    BOOST_TEST(latencies[0].m_Count == 10);
+    BOOST_TEST(latencies[1].m_Name == "ProfilerEventLatencies_Execute");
+    BOOST_TEST(latencies[1].m_Count == 20);
+    for (const armnn::ProfilingEventLatencies& eventLatencies : latencies)
+    {
+        // Within the 1% of error of the histogram
+        BOOST_TEST(eventLatencies.m_P50Us >= 99.0);
+        BOOST_TEST(eventLatencies.m_P50Us <= eventLatencies.m_P90Us);
+        BOOST_TEST(eventLatencies.m_P90Us <= eventLatencies.m_P99Us);
+        BOOST_TEST(eventLatencies.m_P99Us <= eventLatencies.m_P999Us);
+        BOOST_TEST(eventLatencies.m_P999Us <= eventLatencies.m_MaxUs);
+    }
+    BOOST_TEST(latencies[0].m_P50Us >= 198.0);
+
+    std::stringstream json;
+    profiler->Print(json);
+    // The percentiles are added to the objects of the inferences and of the workloads
+    BOOST_TEST(json.str().find("\"ProfilerEventLatencies_Execute_#") != std::string::npos);
+    const std::string output = json.str();
+    size_t numPercentileObjects = 0;
+    for (size_t pos = output.find("\"p99.9_#"); pos != std::string::npos; pos = output.find("\"p99.9_#", pos + 1))
+    {
+        ++numPercentileObjects;
+    }
+    BOOST_TEST(numPercentileObjects == 3);
+
+    profiler->EnableProfiling(false);
+    armnn::ProfilerManager::GetInstance().RegisterProfiler(nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(ProfilerReportsEventsOfThreadProfilers)
+{
+    armnn::ProfilerManager& profilerManager = armnn::ProfilerManager::GetInstance();
+    std::unique_ptr<armnn::Profiler> profiler = std::make_unique<armnn::Profiler>();
+    profilerManager.RegisterProfiler(profiler.get());
+    BOOST_TEST(profiler->GetThreadProfiler() == profiler.get());
+    profiler->EnableProfiling(true);
+
+    constexpr unsigned int numInferences = 10;
+    auto RunInferences = []()
+    {
+        for (unsigned int inference = 0; inference < numInferences; ++inference)
+        {
+            ARMNN_SCOPED_PROFILING_EVENT(armnn::Compute::CpuRef, "EnqueueWorkload");
+            ARMNN_SCOPED_PROFILING_EVENT(armnn::Compute::CpuRef, "ProfilerReportsEventsOfThreadProfilers_Execute");
+        }
+    };
+
+    // The threads run their inferences at the same time, each with its own profiler
+    constexpr unsigned int numThreads = 4;
+    std::vector<armnn::Profiler*> threadProfilers(numThreads);
+    std::vector<std::thread> threads;
+    for (unsigned int i = 0; i < numThreads; ++i)
+    {
+        threads.emplace_back([&profiler, &threadProfilers, &RunInferences, i]()
+        {
+            threadProfilers[i] = profiler->GetThreadProfiler();
+            armnn::ProfilerManager::GetInstance().RegisterProfiler(threadProfilers[i]);
+            RunInferences();
+            armnn::ProfilerManager::GetInstance().RegisterProfiler(nullptr);
+        });
+    }
+    RunInferences();
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    for (unsigned int i = 0; i < numThreads; ++i)
+    {
+        BOOST_TEST(threadProfilers[i] != profiler.get());
+        BOOST_TEST(armnn::GetProfilerEventSequenceSize(threadProfilers[i]) == 2 * numInferences);
+    }
+    BOOST_TEST(armnn::GetProfilerEventSequenceSize(profiler.get()) == 2 * numInferences);
+
+    // The reports of the profiler cover the events of every thread
+    std::vector<armnn::ProfilingEventLatencies> latencies = profiler->GetEventLatencies();
+    BOOST_TEST(latencies.size() == 2);
+    BOOST_TEST(latencies[0].m_Count == (numThreads + 1) * numInferences);
+    BOOST_TEST(latencies[1].m_Count == (numThreads + 1) * numInferences);
+
+    std::stringstream output;
+    profiler->AnalyzeEventsAndWriteResults(output);
+    BOOST_TEST(output.str().find("> Begin Inference: " + std::to_string((numThreads + 1) * numInferences - 1))
+               != std::string::npos);
+
+    profiler->EnableProfiling(false);
+    armnn::ProfilerManager::GetInstance().RegisterProfiler(nullptr);
+}
+
 BOOST_AUTO_TEST_CASE(ProfilerJsonPrinter)
 {
     class TestInstrument : public armnn::Instrument
@@ -8,6 +8,7 @@
 #include <armnn/INetwork.hpp>
 #include <Processes.hpp>
 #include <Runtime.hpp>
+#include <Threadpool.hpp>
 #include <armnn/TypesUtils.hpp>
 
 #include <LabelsAndEventClasses.hpp>
@@ -15,6 +16,14 @@
 
 #include <HeapProfiling.hpp>
 #include <LeakChecking.hpp>
+#include <Filesystem.hpp>
+
+#include <algorithm>
+#include <array>
+#include <fstream>
+#include <future>
+#include <sstream>
+#include <thread>
 
 #ifdef WITH_VALGRIND
 #include <valgrind/memcheck.h>
@@ -327,6 +336,624 @@ BOOST_AUTO_TEST_CASE(RuntimeBackendOptions)
     BOOST_TEST(backendOptions[1].GetOption(0).GetValue().AsInt() == 42);
 }
 
+BOOST_AUTO_TEST_CASE(RuntimeConcurrentExecuteCpuRef)
+{
+    using namespace armnn;
+
+    armnn::IRuntime::CreationOptions options;
+    armnn::IRuntimePtr runtime(armnn::IRuntime::Create(options));
+
+    // Input0 + Input1 -> BoundedReLu -> Output
+    INetworkPtr net(INetwork::Create());
+
+    IConnectableLayer* input0 = net->AddInputLayer(0);
+    IConnectableLayer* input1 = net->AddInputLayer(1);
+    IConnectableLayer* addition = net->AddAdditionLayer();
+
+    ActivationDescriptor activationDescriptor;
+    activationDescriptor.m_Function = ActivationFunction::BoundedReLu;
+    activationDescriptor.m_A = 10.0f;
+    activationDescriptor.m_B = 0.0f;
+    IConnectableLayer* activation = net->AddActivationLayer(activationDescriptor);
+
+    IConnectableLayer* output = net->AddOutputLayer(0);
+
+    input0->GetOutputSlot(0).Connect(addition->GetInputSlot(0));
+    input1->GetOutputSlot(0).Connect(addition->GetInputSlot(1));
+    addition->GetOutputSlot(0).Connect(activation->GetInputSlot(0));
+    activation->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+
+    TensorInfo tensorInfo({ 1, 4 }, DataType::Float32);
+    input0->GetOutputSlot(0).SetTensorInfo(tensorInfo);
+    input1->GetOutputSlot(0).SetTensorInfo(tensorInfo);
+    addition->GetOutputSlot(0).SetTensorInfo(tensorInfo);
+    activation->GetOutputSlot(0).SetTensorInfo(tensorInfo);
+
+    std::vector<armnn::BackendId> backends = { armnn::Compute::CpuRef };
+    IOptimizedNetworkPtr optNet = Optimize(*net, backends, runtime->GetDeviceSpec());
+
+    NetworkId netId;
+    std::string errorMessage;
+    INetworkProperties networkProperties(false, false, true);
+    BOOST_TEST(runtime->LoadNetwork(netId, std::move(optNet), errorMessage, networkProperties) == Status::Success);
+
+    // Each thread uses its own working memory handle and its own input/output buffers.
+    constexpr unsigned int numThreads = 4;
+    constexpr unsigned int numIterations = 20;
+    std::vector<std::unique_ptr<experimental::IWorkingMemHandle>> workingMemHandles;
+    for (unsigned int i = 0; i < numThreads; ++i)
+    {
+        workingMemHandles.push_back(runtime->CreateWorkingMemHandle(netId));
+        BOOST_CHECK(workingMemHandles.back() != nullptr);
+    }
+
+    std::array<bool, numThreads> results;
+    results.fill(true);
+    auto RunInferences = [&](unsigned int threadId)
+    {
+        for (unsigned int iteration = 0; iteration < numIterations; ++iteration)
+        {
+            const float offset = static_cast<float>(threadId + iteration);
+            std::vector<float> inputData0 = { -5.0f, 1.0f, 2.0f, 3.0f };
+            std::vector<float> inputData1 = { offset, offset, offset, 9.0f };
+            std::vector<float> outputData(4);
+
+            InputTensors inputTensors
+            {
+                { 0, ConstTensor(runtime->GetInputTensorInfo(netId, 0), inputData0.data()) },
+                { 1, ConstTensor(runtime->GetInputTensorInfo(netId, 1), inputData1.data()) }
+            };
+            OutputTensors outputTensors
+            {
+                { 0, Tensor(runtime->GetOutputTensorInfo(netId, 0), outputData.data()) }
+            };
+
+            if (runtime->Execute(*workingMemHandles[threadId], inputTensors, outputTensors) != Status::Success)
+            {
+                results[threadId] = false;
+                return;
+            }
+
+            std::vector<float> expectedOutput = { std::max(0.0f, std::min(10.0f, offset - 5.0f)),
+                                                  std::min(10.0f, offset + 1.0f),
+                                                  std::min(10.0f, offset + 2.0f),
+                                                  10.0f };
+            if (outputData != expectedOutput)
+            {
+                results[threadId] = false;
+                return;
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (unsigned int i = 0; i < numThreads; ++i)
+    {
+        threads.emplace_back(RunInferences, i);
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    for (unsigned int i = 0; i < numThreads; ++i)
+    {
+        BOOST_TEST(results[i]);
+        BOOST_TEST(workingMemHandles[i]->IsAllocated());
+    }
+
+    // The synchronous API is not available for an async enabled network.
+    std::vector<float> inputData(4);
+    std::vector<float> outputData(4);
+    InputTensors inputTensors
+    {
+        { 0, ConstTensor(runtime->GetInputTensorInfo(netId, 0), inputData.data()) },
+        { 1, ConstTensor(runtime->GetInputTensorInfo(netId, 1), inputData.data()) }
+    };
+    OutputTensors outputTensors
+    {
+        { 0, Tensor(runtime->GetOutputTensorInfo(netId, 0), outputData.data()) }
+    };
+    BOOST_TEST(runtime->EnqueueWorkload(netId, inputTensors, outputTensors) == Status::Failure);
+}
+
+BOOST_AUTO_TEST_CASE(RuntimeEnqueueWorkloadAsyncCpuRef)
+{
+    using namespace armnn;
+
+    armnn::IRuntime::CreationOptions options;
+    options.m_NumberOfThreads = 2;
+    armnn::IRuntimePtr runtime(armnn::IRuntime::Create(options));
+
+    // Input -> BoundedReLu -> Output
+    INetworkPtr net(INetwork::Create());
+
+    IConnectableLayer* input = net->AddInputLayer(0);
+
+    ActivationDescriptor activationDescriptor;
+    activationDescriptor.m_Function = ActivationFunction::BoundedReLu;
+    activationDescriptor.m_A = 10.0f;
+    activationDescriptor.m_B = 0.0f;
+    IConnectableLayer* activation = net->AddActivationLayer(activationDescriptor);
+
+    IConnectableLayer* output = net->AddOutputLayer(0);
+
+    input->GetOutputSlot(0).Connect(activation->GetInputSlot(0));
+    activation->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+
+    TensorInfo tensorInfo({ 1, 4 }, DataType::Float32);
+    input->GetOutputSlot(0).SetTensorInfo(tensorInfo);
+    activation->GetOutputSlot(0).SetTensorInfo(tensorInfo);
+
+    // Load the network twice, the async enabled copy runs on every thread of the pool concurrently.
+    std::vector<armnn::BackendId> backends = { armnn::Compute::CpuRef };
+    std::array<NetworkId, 2> netIds;
+    for (unsigned int i = 0; i < netIds.size(); ++i)
+    {
+        std::string errorMessage;
+        INetworkProperties networkProperties(false, false, i == 1);
+        BOOST_TEST(runtime->LoadNetwork(netIds[i],
+                                        Optimize(*net, backends, runtime->GetDeviceSpec()),
+                                        errorMessage,
+                                        networkProperties) == Status::Success);
+    }
+
+    constexpr unsigned int numExecutions = 16;
+    std::vector<std::vector<float>> inputData;
+    std::vector<std::vector<float>> outputData(numExecutions, std::vector<float>(4));
+    std::vector<std::future<Status>> futures;
+    for (unsigned int i = 0; i < numExecutions; ++i)
+    {
+        const float value = static_cast<float>(i);
+        inputData.push_back({ -value, value, value - 8.0f, value + 8.0f });
+    }
+
+    for (unsigned int i = 0; i < numExecutions; ++i)
+    {
+        NetworkId netId = netIds[i % netIds.size()];
+        InputTensors inputTensors
+        {
+            { 0, ConstTensor(runtime->GetInputTensorInfo(netId, 0), inputData[i].data()) }
+        };
+        OutputTensors outputTensors
+        {
+            { 0, Tensor(runtime->GetOutputTensorInfo(netId, 0), outputData[i].data()) }
+        };
+        QosExecPriority priority = i % 3 == 0 ? QosExecPriority::High : QosExecPriority::Low;
+        futures.push_back(runtime->EnqueueWorkloadAsync(netId, inputTensors, outputTensors, priority));
+    }
+
+    for (unsigned int i = 0; i < numExecutions; ++i)
+    {
+        BOOST_TEST((futures[i].get() == Status::Success));
+
+        const float value = static_cast<float>(i);
+        std::vector<float> expectedOutput = { 0.0f,
+                                              std::min(10.0f, value),
+                                              std::max(0.0f, value - 8.0f),
+                                              std::min(10.0f, value + 8.0f) };
+        BOOST_TEST(outputData[i] == expectedOutput, boost::test_tools::per_element());
+    }
+
+    // The callback variant reports failures, such as an unknown network, through the callback.
+    class TestCallback : public experimental::IAsyncExecutionCallback
+    {
+    public:
+        void Notify(Status status, InferenceTimingPair timeTaken) override
+        {
+            m_TimingOk = timeTaken.first <= timeTaken.second;
+            m_Status.set_value(status);
+        }
+        std::promise<Status> m_Status;
+        bool m_TimingOk = false;
+    };
+
+    auto callback = std::make_shared<TestCallback>();
+    std::future<Status> callbackStatus = callback->m_Status.get_future();
+    runtime->EnqueueWorkloadAsync(netIds[1] + 1, {}, {}, QosExecPriority::Medium, callback);
+    BOOST_TEST((callbackStatus.get() == Status::Failure));
+    BOOST_TEST(callback->m_TimingOk);
+
+    BOOST_CHECK_THROW(runtime->EnqueueWorkloadAsync(netIds[0], {}, {}, QosExecPriority::Medium, nullptr),
+                      armnn::InvalidArgumentException);
+}
+
+BOOST_AUTO_TEST_CASE(RuntimeEnqueueWorkloadAsyncSerialisesNetworkWithoutAsync)
+{
+    using namespace armnn;
+
+    armnn::IRuntime::CreationOptions options;
+    options.m_NumberOfThreads = 4;
+    armnn::IRuntimePtr runtime(armnn::IRuntime::Create(options));
+
+    // Input -> Linear -> BoundedReLu -> Output, with an intermediate tensor shared by every execution
+    INetworkPtr net(INetwork::Create());
+
+    IConnectableLayer* input = net->AddInputLayer(0);
+
+    ActivationDescriptor linearDescriptor;
+    linearDescriptor.m_Function = ActivationFunction::Linear;
+    linearDescriptor.m_A = 2.0f;
+    linearDescriptor.m_B = 1.0f;
+    IConnectableLayer* linear = net->AddActivationLayer(linearDescriptor);
+
+    ActivationDescriptor boundedReLuDescriptor;
+    boundedReLuDescriptor.m_Function = ActivationFunction::BoundedReLu;
+    boundedReLuDescriptor.m_A = 1000.0f;
+    boundedReLuDescriptor.m_B = 0.0f;
+    IConnectableLayer* boundedReLu = net->AddActivationLayer(boundedReLuDescriptor);
+
+    IConnectableLayer* output = net->AddOutputLayer(0);
+
+    input->GetOutputSlot(0).Connect(linear->GetInputSlot(0));
+    linear->GetOutputSlot(0).Connect(boundedReLu->GetInputSlot(0));
+    boundedReLu->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+
+    constexpr unsigned int numElements = 1024;
+    TensorInfo tensorInfo({ 1, numElements }, DataType::Float32);
+    input->GetOutputSlot(0).SetTensorInfo(tensorInfo);
+    linear->GetOutputSlot(0).SetTensorInfo(tensorInfo);
+    boundedReLu->GetOutputSlot(0).SetTensorInfo(tensorInfo);
+
+    NetworkId netId;
+    std::string errorMessage;
+    INetworkProperties networkProperties(false, false, false);
+    BOOST_TEST(runtime->LoadNetwork(netId,
+                                    Optimize(*net, { armnn::Compute::CpuRef }, runtime->GetDeviceSpec()),
+                                    errorMessage,
+                                    networkProperties) == Status::Success);
+    runtime->GetProfiler(netId)->EnableProfiling(true);
+
+    constexpr unsigned int numExecutions = 64;
+    std::vector<std::vector<float>> inputData(numExecutions, std::vector<float>(numElements));
+    std::vector<std::vector<float>> outputData(numExecutions, std::vector<float>(numElements));
+    std::vector<std::future<Status>> futures;
+    for (unsigned int i = 0; i < numExecutions; ++i)
+    {
+        std::fill(inputData[i].begin(), inputData[i].end(), static_cast<float>(i));
+
+        InputTensors inputTensors
+        {
+            { 0, ConstTensor(runtime->GetInputTensorInfo(netId, 0), inputData[i].data()) }
+        };
+        OutputTensors outputTensors
+        {
+            { 0, Tensor(runtime->GetOutputTensorInfo(netId, 0), outputData[i].data()) }
+        };
+        futures.push_back(runtime->EnqueueWorkloadAsync(netId, inputTensors, outputTensors));
+    }
+
+    // Every execution reads its own input and writes its own output, however the pool interleaves them
+    for (unsigned int i = 0; i < numExecutions; ++i)
+    {
+        BOOST_TEST((futures[i].get() == Status::Success));
+
+        std::vector<float> expectedOutput(numElements, 2.0f * static_cast<float>(i) + 1.0f);
+        BOOST_TEST(outputData[i] == expectedOutput, boost::test_tools::per_element());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(RuntimeEnqueueWorkloadAsyncProfilesEachThread)
+{
+    using namespace armnn;
+
+    armnn::IRuntime::CreationOptions options;
+    options.m_NumberOfThreads = 4;
+    armnn::IRuntimePtr runtime(armnn::IRuntime::Create(options));
+
+    // Input -> Linear -> Output
+    INetworkPtr net(INetwork::Create());
+
+    IConnectableLayer* input = net->AddInputLayer(0);
+
+    ActivationDescriptor linearDescriptor;
+    linearDescriptor.m_Function = ActivationFunction::Linear;
+    linearDescriptor.m_A = 2.0f;
+    linearDescriptor.m_B = 1.0f;
+    IConnectableLayer* linear = net->AddActivationLayer(linearDescriptor);
+
+    IConnectableLayer* output = net->AddOutputLayer(0);
+
+    input->GetOutputSlot(0).Connect(linear->GetInputSlot(0));
+    linear->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+
+    constexpr unsigned int numElements = 256;
+    TensorInfo tensorInfo({ 1, numElements }, DataType::Float32);
+    input->GetOutputSlot(0).SetTensorInfo(tensorInfo);
+    linear->GetOutputSlot(0).SetTensorInfo(tensorInfo);
+
+    NetworkId netId;
+    std::string errorMessage;
+    INetworkProperties networkProperties(false, false, true);
+    BOOST_TEST(runtime->LoadNetwork(netId,
+                                    Optimize(*net, { armnn::Compute::CpuRef }, runtime->GetDeviceSpec()),
+                                    errorMessage,
+                                    networkProperties) == Status::Success);
+    std::shared_ptr<IProfiler> profiler = runtime->GetProfiler(netId);
+    profiler->SetMaxRecordedInferences(8);
+    profiler->EnableProfiling(true);
+
+    constexpr unsigned int numExecutions = 64;
+    std::vector<std::vector<float>> inputData(numExecutions, std::vector<float>(numElements));
+    std::vector<std::vector<float>> outputData(numExecutions, std::vector<float>(numElements));
+    std::vector<std::future<Status>> futures;
+    for (unsigned int i = 0; i < numExecutions; ++i)
+    {
+        std::fill(inputData[i].begin(), inputData[i].end(), static_cast<float>(i));
+
+        InputTensors inputTensors
+        {
+            { 0, ConstTensor(runtime->GetInputTensorInfo(netId, 0), inputData[i].data()) }
+        };
+        OutputTensors outputTensors
+        {
+            { 0, Tensor(runtime->GetOutputTensorInfo(netId, 0), outputData[i].data()) }
+        };
+        futures.push_back(runtime->EnqueueWorkloadAsync(netId, inputTensors, outputTensors));
+    }
+    for (unsigned int i = 0; i < numExecutions; ++i)
+    {
+        BOOST_TEST((futures[i].get() == Status::Success));
+
+        std::vector<float> expectedOutput(numElements, 2.0f * static_cast<float>(i) + 1.0f);
+        BOOST_TEST(outputData[i] == expectedOutput, boost::test_tools::per_element());
+    }
+
+    // The events of the pool threads are reported together, whichever thread ran each execution
+    std::vector<ProfilingEventLatencies> latencies = profiler->GetEventLatencies();
+    auto executeLatencies = std::find_if(latencies.begin(), latencies.end(),
+                                         [](const ProfilingEventLatencies& eventLatencies)
+                                         {
+                                             return eventLatencies.m_Name == "Execute";
+                                         });
+    BOOST_TEST((executeLatencies != latencies.end()));
+    // Runtime::Execute and LoadedNetwork::Execute both report an Execute event
+    BOOST_TEST(executeLatencies->m_Count == 2 * numExecutions);
+
+    std::stringstream analysis;
+    profiler->AnalyzeEventsAndWriteResults(analysis);
+    BOOST_TEST(analysis.str().find("Cannot write profiling stats") == std::string::npos);
+    BOOST_TEST(analysis.str().find("Execute") != std::string::npos);
+
+    std::stringstream json;
+    profiler->Print(json);
+    BOOST_TEST(!json.str().empty());
+}
+
+BOOST_AUTO_TEST_CASE(RuntimeTracesWorkingMemoryOfHandles)
+{
+    using namespace armnn;
+
+    armnn::IRuntime::CreationOptions options;
+    armnn::IRuntimePtr runtime(armnn::IRuntime::Create(options));
+
+    // Input -> Linear -> Output, with two tensors of 1024 bytes in the working memory
+    INetworkPtr net(INetwork::Create());
+
+    IConnectableLayer* input = net->AddInputLayer(0);
+
+    ActivationDescriptor linearDescriptor;
+    linearDescriptor.m_Function = ActivationFunction::Linear;
+    IConnectableLayer* linear = net->AddActivationLayer(linearDescriptor);
+
+    IConnectableLayer* output = net->AddOutputLayer(0);
+
+    input->GetOutputSlot(0).Connect(linear->GetInputSlot(0));
+    linear->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+
+    TensorInfo tensorInfo({ 1, 256 }, DataType::Float32);
+    input->GetOutputSlot(0).SetTensorInfo(tensorInfo);
+    linear->GetOutputSlot(0).SetTensorInfo(tensorInfo);
+
+    NetworkId netId;
+    std::string errorMessage;
+    INetworkProperties networkProperties(false, false, true);
+    BOOST_TEST(runtime->LoadNetwork(netId,
+                                    Optimize(*net, { armnn::Compute::CpuRef }, runtime->GetDeviceSpec()),
+                                    errorMessage,
+                                    networkProperties) == Status::Success);
+
+    fs::path fileName = armnnUtils::Filesystem::NamedTempFile("Armnn-RuntimeTracesWorkingMemoryOfHandles.json");
+    std::shared_ptr<IProfiler> profiler = runtime->GetProfiler(netId);
+    profiler->SetTraceFile(fileName.string());
+    profiler->EnableProfiling(true);
+
+    // The counter covers the handles alive, until they are destroyed
+    {
+        std::unique_ptr<experimental::IWorkingMemHandle> handle0 = runtime->CreateWorkingMemHandle(netId);
+        std::unique_ptr<experimental::IWorkingMemHandle> handle1 = runtime->CreateWorkingMemHandle(netId);
+    }
+    profiler->SetTraceFile("");
+
+    std::string trace;
+    {
+        std::ifstream file(fileName.string());
+        trace.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+    fs::remove(fileName);
+
+    std::vector<std::string> values;
+    const std::string counterValue = "\"args\":{\"bytes\":";
+    for (size_t position = trace.find(counterValue); position != std::string::npos;
+         position = trace.find(counterValue, position + 1))
+    {
+        const size_t begin = position + counterValue.size();
+        values.push_back(trace.substr(begin, trace.find('}', begin) - begin));
+    }
+    const std::vector<std::string> expectedValues = { "2048", "4096", "2048", "0" };
+    BOOST_TEST(values == expectedValues, boost::test_tools::per_element());
+}
+
+BOOST_AUTO_TEST_CASE(RuntimeUnloadNetworkWaitsForQueuedExecutions)
+{
+    using namespace armnn;
+
+    armnn::IRuntime::CreationOptions options;
+    options.m_NumberOfThreads = 2;
+    armnn::IRuntimePtr runtime(armnn::IRuntime::Create(options));
+
+    INetworkPtr net(INetwork::Create());
+    IConnectableLayer* input = net->AddInputLayer(0);
+    ActivationDescriptor linearDescriptor;
+    linearDescriptor.m_Function = ActivationFunction::Linear;
+    linearDescriptor.m_A = 2.0f;
+    linearDescriptor.m_B = 1.0f;
+    IConnectableLayer* linear = net->AddActivationLayer(linearDescriptor);
+    IConnectableLayer* output = net->AddOutputLayer(0);
+
+    input->GetOutputSlot(0).Connect(linear->GetInputSlot(0));
+    linear->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+
+    constexpr unsigned int numElements = 4096;
+    TensorInfo tensorInfo({ 1, numElements }, DataType::Float32);
+    input->GetOutputSlot(0).SetTensorInfo(tensorInfo);
+    linear->GetOutputSlot(0).SetTensorInfo(tensorInfo);
+
+    // Both a network executed concurrently with working memory handles and one executed one at a time
+    for (bool asyncEnabled : { true, false })
+    {
+        NetworkId netId;
+        std::string errorMessage;
+        INetworkProperties networkProperties(false, false, asyncEnabled);
+        BOOST_TEST(runtime->LoadNetwork(netId,
+                                        Optimize(*net, { armnn::Compute::CpuRef }, runtime->GetDeviceSpec()),
+                                        errorMessage,
+                                        networkProperties) == Status::Success);
+
+        constexpr unsigned int numExecutions = 32;
+        std::vector<std::vector<float>> inputData(numExecutions, std::vector<float>(numElements));
+        std::vector<std::vector<float>> outputData(numExecutions, std::vector<float>(numElements));
+        std::vector<std::future<Status>> futures;
+        for (unsigned int i = 0; i < numExecutions; ++i)
+        {
+            std::fill(inputData[i].begin(), inputData[i].end(), static_cast<float>(i));
+
+            InputTensors inputTensors
+            {
+                { 0, ConstTensor(runtime->GetInputTensorInfo(netId, 0), inputData[i].data()) }
+            };
+            OutputTensors outputTensors
+            {
+                { 0, Tensor(runtime->GetOutputTensorInfo(netId, 0), outputData[i].data()) }
+            };
+            futures.push_back(runtime->EnqueueWorkloadAsync(netId, inputTensors, outputTensors));
+        }
+
+        // Unloading while executions are still queued waits for all of them to complete, rather than failing them
+        BOOST_TEST((runtime->UnloadNetwork(netId) == Status::Success));
+        for (unsigned int i = 0; i < numExecutions; ++i)
+        {
+            BOOST_TEST((futures[i].get() == Status::Success));
+
+            std::vector<float> expectedOutput(numElements, 2.0f * static_cast<float>(i) + 1.0f);
+            BOOST_TEST(outputData[i] == expectedOutput, boost::test_tools::per_element());
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(ThreadpoolStartsHigherPriorityJobsFirst)
+{
+    using namespace armnn;
+
+    std::vector<QosExecPriority> executionOrder;
+    std::promise<void> release;
+    std::shared_future<void> released = release.get_future().share();
+    {
+        experimental::Threadpool threadpool(1);
+
+        // Keep the only thread busy until every other job has been queued.
+        threadpool.Schedule([released](unsigned int) { released.wait(); }, QosExecPriority::Low);
+        for (QosExecPriority priority : { QosExecPriority::Low, QosExecPriority::Medium, QosExecPriority::High })
+        {
+            threadpool.Schedule([&executionOrder, priority](unsigned int) { executionOrder.push_back(priority); },
+                                priority);
+        }
+        release.set_value();
+    }
+
+    std::vector<QosExecPriority> expectedOrder = { QosExecPriority::High,
+                                                   QosExecPriority::Medium,
+                                                   QosExecPriority::Low };
+    BOOST_TEST((executionOrder == expectedOrder));
+}
+
+BOOST_AUTO_TEST_CASE(RuntimeBindIOBuffersCpuRef)
+{
+    using namespace armnn;
+
+    armnn::IRuntime::CreationOptions options;
+    armnn::IRuntimePtr runtime(armnn::IRuntime::Create(options));
+
+    // Input -> ReLu -> Output
+    INetworkPtr net(INetwork::Create());
+
+    IConnectableLayer* input = net->AddInputLayer(0);
+
+    ActivationDescriptor activationDescriptor;
+    activationDescriptor.m_Function = ActivationFunction::ReLu;
+    IConnectableLayer* activation = net->AddActivationLayer(activationDescriptor);
+
+    IConnectableLayer* output = net->AddOutputLayer(0);
+
+    input->GetOutputSlot(0).Connect(activation->GetInputSlot(0));
+    activation->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+
+    TensorInfo tensorInfo({ 1, 4 }, DataType::Float32);
+    input->GetOutputSlot(0).SetTensorInfo(tensorInfo);
+    activation->GetOutputSlot(0).SetTensorInfo(tensorInfo);
+
+    std::vector<armnn::BackendId> backends = { armnn::Compute::CpuRef };
+    NetworkId netId;
+    BOOST_TEST(runtime->LoadNetwork(netId, Optimize(*net, backends, runtime->GetDeviceSpec())) == Status::Success);
+
+    // Two independent sets of buffers bound to the same network.
+    std::array<std::vector<float>, 2> inputData = { std::vector<float>(4), std::vector<float>(4) };
+    std::array<std::vector<float>, 2> outputData = { std::vector<float>(4), std::vector<float>(4) };
+    std::array<std::unique_ptr<experimental::IBoundIOBuffers>, 2> boundIOBuffers;
+    for (unsigned int i = 0; i < boundIOBuffers.size(); ++i)
+    {
+        InputTensors inputTensors
+        {
+            { 0, ConstTensor(runtime->GetInputTensorInfo(netId, 0), inputData[i].data()) }
+        };
+        OutputTensors outputTensors
+        {
+            { 0, Tensor(runtime->GetOutputTensorInfo(netId, 0), outputData[i].data()) }
+        };
+        boundIOBuffers[i] = runtime->BindIOBuffers(netId, inputTensors, outputTensors);
+        BOOST_TEST(boundIOBuffers[i]->GetNetworkId() == netId);
+    }
+
+    // The bound buffers are read and written in place on every execution.
+    for (unsigned int iteration = 0; iteration < 3; ++iteration)
+    {
+        for (unsigned int i = 0; i < boundIOBuffers.size(); ++i)
+        {
+            const float value = static_cast<float>(iteration + i);
+            inputData[i] = { -value, value, -1.0f, 2.0f * value };
+
+            BOOST_TEST((runtime->EnqueueWorkload(*boundIOBuffers[i]) == Status::Success));
+
+            std::vector<float> expectedOutput = { 0.0f, value, 0.0f, 2.0f * value };
+            BOOST_TEST(outputData[i] == expectedOutput, boost::test_tools::per_element());
+        }
+    }
+
+    // Buffers must match the bindings of the network.
+    std::vector<float> data(4);
+    InputTensors wrongInputTensors
+    {
+        { 1, ConstTensor(runtime->GetInputTensorInfo(netId, 0), data.data()) }
+    };
+    OutputTensors outputTensors
+    {
+        { 0, Tensor(runtime->GetOutputTensorInfo(netId, 0), data.data()) }
+    };
+    BOOST_CHECK_THROW(runtime->BindIOBuffers(netId, wrongInputTensors, outputTensors),
+                      armnn::InvalidArgumentException);
+    BOOST_CHECK_THROW(runtime->BindIOBuffers(netId, {}, outputTensors), armnn::InvalidArgumentException);
+}
+
 BOOST_AUTO_TEST_CASE(ProfilingDisable)
 {
     using namespace armnn;
@@ -0,0 +1,171 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "../GraphUtils.hpp"
+#include "../TestUtils.hpp"
+
+#include <Optimizer.hpp>
+
+#include <backendsCommon/CpuTensorHandle.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+BOOST_AUTO_TEST_SUITE(Optimizer)
+using namespace armnn;
+using namespace armnn::optimizations;
+
+BOOST_AUTO_TEST_CASE(FoldConstantsTest)
+{
+    Graph graph;
+
+    const TensorInfo constantInfo({ 2, 3 }, DataType::Float32);
+    const TensorInfo reshapedInfo({ 3, 2 }, DataType::Float32);
+
+    std::vector<float> constant0Data = { 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f };
+    std::vector<float> constant1Data = { 10.0f, 20.0f, 30.0f, 40.0f, 50.0f, 60.0f };
+
+    // (constant0 + constant1) is reshaped and added to the input: only the last addition depends on the input
+    auto constant0 = graph.AddLayer<ConstantLayer>("constant0");
+    constant0->m_LayerOutput = std::make_unique<ScopedCpuTensorHandle>(ConstTensor(constantInfo, constant0Data));
+    auto constant1 = graph.AddLayer<ConstantLayer>("constant1");
+    constant1->m_LayerOutput = std::make_unique<ScopedCpuTensorHandle>(ConstTensor(constantInfo, constant1Data));
+    auto constantAddition = graph.AddLayer<AdditionLayer>("constantAddition");
+    auto reshape = graph.AddLayer<ReshapeLayer>(ReshapeDescriptor(reshapedInfo.GetShape()), "reshape");
+    auto input = graph.AddLayer<InputLayer>(0, "input");
+    auto addition = graph.AddLayer<AdditionLayer>("addition");
+    auto output = graph.AddLayer<OutputLayer>(0, "output");
+
+    constant0->GetOutputSlot(0).Connect(constantAddition->GetInputSlot(0));
+    constant1->GetOutputSlot(0).Connect(constantAddition->GetInputSlot(1));
+    constantAddition->GetOutputSlot(0).Connect(reshape->GetInputSlot(0));
+    reshape->GetOutputSlot(0).Connect(addition->GetInputSlot(0));
+    input->GetOutputSlot(0).Connect(addition->GetInputSlot(1));
+    addition->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+
+    constant0->GetOutputSlot(0).SetTensorInfo(constantInfo);
+    constant1->GetOutputSlot(0).SetTensorInfo(constantInfo);
+    constantAddition->GetOutputSlot(0).SetTensorInfo(constantInfo);
+    reshape->GetOutputSlot(0).SetTensorInfo(reshapedInfo);
+    input->GetOutputSlot(0).SetTensorInfo(reshapedInfo);
+    addition->GetOutputSlot(0).SetTensorInfo(reshapedInfo);
+
+    armnn::Optimizer::Pass(graph, MakeOptimizations(FoldConstants()));
+
+    // The constant additions and the reshape are replaced by a single constant
+    BOOST_TEST(graph.GetNumLayers() == 4);
+    BOOST_TEST(GraphHasNamedLayer(graph, "folded-reshape"));
+    BOOST_TEST(GraphHasNamedLayer(graph, "addition"));
+    BOOST_TEST(!GraphHasNamedLayer(graph, "constantAddition"));
+    BOOST_TEST(!GraphHasNamedLayer(graph, "constant0"));
+
+    const Layer& folded = addition->GetInputSlot(0).GetConnectedOutputSlot()->GetOwningLayer();
+    BOOST_TEST((folded.GetType() == LayerType::Constant));
+
+    const ScopedCpuTensorHandle& foldedOutput = *PolymorphicDowncast<const ConstantLayer*>(&folded)->m_LayerOutput;
+    BOOST_TEST((foldedOutput.GetTensorInfo() == reshapedInfo));
+    BOOST_TEST((folded.GetOutputSlot(0).GetTensorInfo() == reshapedInfo));
+
+    std::vector<float> foldedData(foldedOutput.GetConstTensor<float>(),
+                                  foldedOutput.GetConstTensor<float>() + reshapedInfo.GetNumElements());
+    std::vector<float> expectedData = { 11.0f, 22.0f, 33.0f, 44.0f, 55.0f, 66.0f };
+    BOOST_TEST(foldedData == expectedData, boost::test_tools::per_element());
+
+    // The layers left in the graph have no tensor handle until the graph is loaded
+    BOOST_TEST(folded.GetOutputHandler(0).GetData() == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(FoldConstantsDecidesEachLayerOnce)
+{
+    Graph graph;
+
+    const TensorInfo info({ 1, 2 }, DataType::Float32);
+    std::vector<float> constantData = { 1.0f, 2.0f };
+
+    // Each addition adds the two layers before it, so that there are exponentially many paths from the last one to
+    // the constants
+    auto constant0 = graph.AddLayer<ConstantLayer>("constant0");
+    constant0->m_LayerOutput = std::make_unique<ScopedCpuTensorHandle>(ConstTensor(info, constantData));
+    constant0->GetOutputSlot(0).SetTensorInfo(info);
+    auto constant1 = graph.AddLayer<ConstantLayer>("constant1");
+    constant1->m_LayerOutput = std::make_unique<ScopedCpuTensorHandle>(ConstTensor(info, constantData));
+    constant1->GetOutputSlot(0).SetTensorInfo(info);
+
+    constexpr unsigned int numAdditions = 64;
+    Layer* previous = constant0;
+    Layer* last = constant1;
+    std::vector<float> previousData = constantData;
+    std::vector<float> expectedData = constantData;
+    for (unsigned int i = 0; i < numAdditions; ++i)
+    {
+        auto addition = graph.AddLayer<AdditionLayer>(("addition" + std::to_string(i)).c_str());
+        previous->GetOutputSlot(0).Connect(addition->GetInputSlot(0));
+        last->GetOutputSlot(0).Connect(addition->GetInputSlot(1));
+        addition->GetOutputSlot(0).SetTensorInfo(info);
+        previous = last;
+        last = addition;
+
+        std::vector<float> sum = { previousData[0] + expectedData[0], previousData[1] + expectedData[1] };
+        previousData = expectedData;
+        expectedData = sum;
+    }
+    auto output = graph.AddLayer<OutputLayer>(0, "output");
+    last->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+
+    armnn::Optimizer::Pass(graph, MakeOptimizations(FoldConstants()));
+
+    BOOST_TEST(graph.GetNumLayers() == 2);
+    const Layer& folded = output->GetInputSlot(0).GetConnectedOutputSlot()->GetOwningLayer();
+    BOOST_TEST((folded.GetType() == LayerType::Constant));
+
+    const ScopedCpuTensorHandle& foldedOutput = *PolymorphicDowncast<const ConstantLayer*>(&folded)->m_LayerOutput;
+    std::vector<float> foldedData(foldedOutput.GetConstTensor<float>(),
+                                  foldedOutput.GetConstTensor<float>() + info.GetNumElements());
+    BOOST_TEST(foldedData == expectedData, boost::test_tools::per_element());
+}
+
+BOOST_AUTO_TEST_CASE(FoldConstantsEvaluatesLongChain)
+{
+    Graph graph;
+
+    const TensorInfo info({ 1, 2 }, DataType::Float32);
+    std::vector<float> constantData = { 1.0f, 2.0f };
+
+    // A chain long enough to overflow the stack if each layer were evaluated by a recursive call
+    auto constant = graph.AddLayer<ConstantLayer>("constant");
+    constant->m_LayerOutput = std::make_unique<ScopedCpuTensorHandle>(ConstTensor(info, constantData));
+    constant->GetOutputSlot(0).SetTensorInfo(info);
+
+    ActivationDescriptor incrementDescriptor;
+    incrementDescriptor.m_Function = ActivationFunction::Linear;
+    incrementDescriptor.m_A = 1.0f;
+    incrementDescriptor.m_B = 1.0f;
+
+    constexpr unsigned int numActivations = 100000;
+    Layer* last = constant;
+    for (unsigned int i = 0; i < numActivations; ++i)
+    {
+        auto activation = graph.AddLayer<ActivationLayer>(incrementDescriptor, "activation");
+        last->GetOutputSlot(0).Connect(activation->GetInputSlot(0));
+        activation->GetOutputSlot(0).SetTensorInfo(info);
+        last = activation;
+    }
+    auto output = graph.AddLayer<OutputLayer>(0, "output");
+    last->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+
+    armnn::Optimizer::Pass(graph, MakeOptimizations(FoldConstants()));
+
+    BOOST_TEST(graph.GetNumLayers() == 2);
+    const Layer& folded = output->GetInputSlot(0).GetConnectedOutputSlot()->GetOwningLayer();
+    BOOST_TEST((folded.GetType() == LayerType::Constant));
+
+    const ScopedCpuTensorHandle& foldedOutput = *PolymorphicDowncast<const ConstantLayer*>(&folded)->m_LayerOutput;
+    std::vector<float> foldedData(foldedOutput.GetConstTensor<float>(),
+                                  foldedOutput.GetConstTensor<float>() + info.GetNumElements());
+    const float increment = static_cast<float>(numActivations);
+    std::vector<float> expectedData = { 1.0f + increment, 2.0f + increment };
+    BOOST_TEST(foldedData == expectedData, boost::test_tools::per_element());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
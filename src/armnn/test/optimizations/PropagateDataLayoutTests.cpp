@@ -0,0 +1,111 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "../TestUtils.hpp"
+
+#include <Network.hpp>
+
+#include <armnn/INetwork.hpp>
+
+#include <backendsCommon/CpuTensorHandle.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+BOOST_AUTO_TEST_SUITE(Optimizer)
+using namespace armnn;
+
+BOOST_AUTO_TEST_CASE(PropagateDataLayoutRemovesConversionsTest)
+{
+    // An NCHW input converted to NHWC for a convolution and an activation, whose output is converted back to NCHW
+    INetworkPtr network = INetwork::Create();
+
+    Convolution2dDescriptor convolutionDescriptor;
+    convolutionDescriptor.m_StrideX    = 1;
+    convolutionDescriptor.m_StrideY    = 1;
+    convolutionDescriptor.m_DataLayout = DataLayout::NHWC;
+
+    // OHWI weights of a 2x2 kernel over 2 channels
+    std::vector<float> weightsData = { 1.0f, -1.0f, 2.0f, -2.0f, 3.0f, -3.0f, 4.0f, -4.0f };
+    ConstTensor weights(TensorInfo({ 1, 2, 2, 2 }, DataType::Float32), weightsData);
+
+    IConnectableLayer* input = network->AddInputLayer(0, "input");
+    IConnectableLayer* toNhwc = network->AddPermuteLayer(PermuteDescriptor({ 0, 3, 1, 2 }), "toNhwc");
+    IConnectableLayer* convolution =
+        network->AddConvolution2dLayer(convolutionDescriptor, weights, EmptyOptional(), "convolution");
+    IConnectableLayer* activation =
+        network->AddActivationLayer(ActivationDescriptor(ActivationFunction::Abs), "activation");
+    IConnectableLayer* toNchw = network->AddTransposeLayer(TransposeDescriptor({ 0, 3, 1, 2 }), "toNchw");
+    IConnectableLayer* output = network->AddOutputLayer(0, "output");
+
+    input->GetOutputSlot(0).Connect(toNhwc->GetInputSlot(0));
+    toNhwc->GetOutputSlot(0).Connect(convolution->GetInputSlot(0));
+    convolution->GetOutputSlot(0).Connect(activation->GetInputSlot(0));
+    activation->GetOutputSlot(0).Connect(toNchw->GetInputSlot(0));
+    toNchw->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+
+    input->GetOutputSlot(0).SetTensorInfo(TensorInfo({ 1, 2, 3, 2 }, DataType::Float32));
+    toNhwc->GetOutputSlot(0).SetTensorInfo(TensorInfo({ 1, 3, 2, 2 }, DataType::Float32));
+    convolution->GetOutputSlot(0).SetTensorInfo(TensorInfo({ 1, 2, 1, 1 }, DataType::Float32));
+    activation->GetOutputSlot(0).SetTensorInfo(TensorInfo({ 1, 2, 1, 1 }, DataType::Float32));
+    toNchw->GetOutputSlot(0).SetTensorInfo(TensorInfo({ 1, 1, 2, 1 }, DataType::Float32));
+
+    IRuntime::CreationOptions options;
+    IRuntimePtr runtime = IRuntime::Create(options);
+    IOptimizedNetworkPtr optNet = Optimize(*network, { Compute::CpuRef }, runtime->GetDeviceSpec());
+
+    // The convolution computes in NCHW and the conversions are removed, CpuRef then fuses the activation into it
+    const Graph& graph = static_cast<OptimizedNetwork*>(optNet.get())->GetGraph();
+    BOOST_TEST(graph.GetNumLayers() == 3);
+    for (auto&& layer : graph)
+    {
+        BOOST_TEST((layer->GetType() != LayerType::Permute && layer->GetType() != LayerType::Transpose));
+        if (layer->GetType() == LayerType::Convolution2d)
+        {
+            auto switchedConvolution = static_cast<const Convolution2dLayer*>(layer);
+            BOOST_TEST((switchedConvolution->GetParameters().m_DataLayout == DataLayout::NCHW));
+            BOOST_TEST((switchedConvolution->m_Weight->GetTensorInfo().GetShape() == TensorShape({ 1, 2, 2, 2 })));
+            BOOST_TEST((layer->GetOutputSlot(0).GetTensorInfo().GetShape() == TensorShape({ 1, 1, 2, 1 })));
+        }
+    }
+
+    NetworkId netId;
+    BOOST_TEST(runtime->LoadNetwork(netId, std::move(optNet)) == Status::Success);
+
+    // NCHW input of 2 channels of 3x2
+    std::vector<float> inputData = { 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f,
+                                     -1.0f, -2.0f, -3.0f, -4.0f, -5.0f, -6.0f };
+    std::vector<float> outputData(2);
+
+    // Output row y is the sum over the kernel of inputData[c][y + h][w] * weightsData[h][w][c]
+    std::vector<float> expectedOutput(2);
+    for (unsigned int y = 0; y < 2; ++y)
+    {
+        float sum = 0.0f;
+        for (unsigned int h = 0; h < 2; ++h)
+        {
+            for (unsigned int w = 0; w < 2; ++w)
+            {
+                for (unsigned int c = 0; c < 2; ++c)
+                {
+                    sum += inputData[c * 6 + (y + h) * 2 + w] * weightsData[h * 4 + w * 2 + c];
+                }
+            }
+        }
+        expectedOutput[y] = std::abs(sum);
+    }
+
+    InputTensors inputTensors
+    {
+        { 0, ConstTensor(runtime->GetInputTensorInfo(netId, 0), inputData.data()) }
+    };
+    OutputTensors outputTensors
+    {
+        { 0, Tensor(runtime->GetOutputTensorInfo(netId, 0), outputData.data()) }
+    };
+    BOOST_TEST(runtime->EnqueueWorkload(netId, inputTensors, outputTensors) == Status::Success);
+    BOOST_TEST(outputData == expectedOutput, boost::test_tools::per_element());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -5,18 +5,24 @@
 
 #include "Deserializer.hpp"
 
+#include <armnn/BackendRegistry.hpp>
 #include <armnn/Descriptors.hpp>
 #include <armnn/Exceptions.hpp>
 #include <armnn/TypesUtils.hpp>
 #include <armnn/LstmParams.hpp>
 #include <armnn/QuantizedLstmParams.hpp>
+#include <armnn/backends/IBackendInternal.hpp>
 
 #include <armnnUtils/Permute.hpp>
 #include <armnnUtils/Transpose.hpp>
 #include <armnn/utility/Assert.hpp>
 #include <armnn/utility/IgnoreUnused.hpp>
 #include <armnn/utility/NumericCast.hpp>
+#include <armnn/utility/PolymorphicDowncast.hpp>
 
+#include <BlockQuantization.hpp>
+#include <MemoryMappedFile.hpp>
+#include <Network.hpp>
 #include <ParserHelper.hpp>
 #include <VerificationHelpers.hpp>
 
@@ -34,6 +40,9 @@ using namespace armnnSerializer;
 namespace armnnDeserializer
 {
 
+// The graphs of optimized networks declare armnn::Layer too
+using armnnSerializer::Layer;
+
 namespace
 {
 
@@ -179,6 +188,10 @@ m_ParserFunctions(Layer_MAX+1, &Deserializer::ParseUnsupportedLayer)
     m_ParserFunctions[Layer_ComparisonLayer]             = &Deserializer::ParseComparison;
     m_ParserFunctions[Layer_ConcatLayer]                 = &Deserializer::ParseConcat;
     m_ParserFunctions[Layer_ConstantLayer]               = &Deserializer::ParseConstant;
+    m_ParserFunctions[Layer_ConvertBf16ToFp32Layer]      = &Deserializer::ParseOptimizerLayer;
+    m_ParserFunctions[Layer_ConvertFp16ToFp32Layer]      = &Deserializer::ParseOptimizerLayer;
+    m_ParserFunctions[Layer_ConvertFp32ToBf16Layer]      = &Deserializer::ParseOptimizerLayer;
+    m_ParserFunctions[Layer_ConvertFp32ToFp16Layer]      = &Deserializer::ParseOptimizerLayer;
     m_ParserFunctions[Layer_Convolution2dLayer]          = &Deserializer::ParseConvolution2d;
     m_ParserFunctions[Layer_DepthToSpaceLayer]           = &Deserializer::ParseDepthToSpace;
     m_ParserFunctions[Layer_DepthwiseConvolution2dLayer] = &Deserializer::ParseDepthwiseConvolution2d;
@@ -199,6 +212,8 @@ m_ParserFunctions(Layer_MAX+1, &Deserializer::ParseUnsupportedLayer)
     m_ParserFunctions[Layer_LstmLayer]                   = &Deserializer::ParseLstm;
     m_ParserFunctions[Layer_MaximumLayer]                = &Deserializer::ParseMaximum;
     m_ParserFunctions[Layer_MeanLayer]                   = &Deserializer::ParseMean;
+    m_ParserFunctions[Layer_MemCopyLayer]                = &Deserializer::ParseOptimizerLayer;
+    m_ParserFunctions[Layer_MemImportLayer]              = &Deserializer::ParseOptimizerLayer;
     m_ParserFunctions[Layer_MinimumLayer]                = &Deserializer::ParseMinimum;
     m_ParserFunctions[Layer_MergeLayer]                  = &Deserializer::ParseMerge;
     m_ParserFunctions[Layer_MergerLayer]                 = &Deserializer::ParseConcat;
@@ -207,6 +222,7 @@ m_ParserFunctions(Layer_MAX+1, &Deserializer::ParseUnsupportedLayer)
     m_ParserFunctions[Layer_PadLayer]                    = &Deserializer::ParsePad;
     m_ParserFunctions[Layer_PermuteLayer]                = &Deserializer::ParsePermute;
     m_ParserFunctions[Layer_Pooling2dLayer]              = &Deserializer::ParsePooling2d;
+    m_ParserFunctions[Layer_PreCompiledLayer]            = &Deserializer::ParsePreCompiled;
     m_ParserFunctions[Layer_PreluLayer]                  = &Deserializer::ParsePrelu;
     m_ParserFunctions[Layer_QLstmLayer]                  = &Deserializer::ParseQLstm;
     m_ParserFunctions[Layer_QuantizeLayer]               = &Deserializer::ParseQuantize;
@@ -254,6 +270,14 @@ Deserializer::LayerBaseRawPtr Deserializer::GetBaseLayer(const GraphPtr& graphPt
             return graphPtr->layers()->Get(layerIndex)->layer_as_ConcatLayer()->base();
         case Layer::Layer_ConstantLayer:
             return graphPtr->layers()->Get(layerIndex)->layer_as_ConstantLayer()->base();
+        case Layer::Layer_ConvertBf16ToFp32Layer:
+            return graphPtr->layers()->Get(layerIndex)->layer_as_ConvertBf16ToFp32Layer()->base();
+        case Layer::Layer_ConvertFp16ToFp32Layer:
+            return graphPtr->layers()->Get(layerIndex)->layer_as_ConvertFp16ToFp32Layer()->base();
+        case Layer::Layer_ConvertFp32ToBf16Layer:
+            return graphPtr->layers()->Get(layerIndex)->layer_as_ConvertFp32ToBf16Layer()->base();
+        case Layer::Layer_ConvertFp32ToFp16Layer:
+            return graphPtr->layers()->Get(layerIndex)->layer_as_ConvertFp32ToFp16Layer()->base();
         case Layer::Layer_Convolution2dLayer:
             return graphPtr->layers()->Get(layerIndex)->layer_as_Convolution2dLayer()->base();
         case Layer::Layer_DepthToSpaceLayer:
@@ -294,6 +318,10 @@ Deserializer::LayerBaseRawPtr Deserializer::GetBaseLayer(const GraphPtr& graphPt
             return graphPtr->layers()->Get(layerIndex)->layer_as_LstmLayer()->base();
         case Layer::Layer_MeanLayer:
             return graphPtr->layers()->Get(layerIndex)->layer_as_MeanLayer()->base();
+        case Layer::Layer_MemCopyLayer:
+            return graphPtr->layers()->Get(layerIndex)->layer_as_MemCopyLayer()->base();
+        case Layer::Layer_MemImportLayer:
+            return graphPtr->layers()->Get(layerIndex)->layer_as_MemImportLayer()->base();
         case Layer::Layer_MinimumLayer:
             return graphPtr->layers()->Get(layerIndex)->layer_as_MinimumLayer()->base();
         case Layer::Layer_MaximumLayer:
@@ -314,6 +342,8 @@ Deserializer::LayerBaseRawPtr Deserializer::GetBaseLayer(const GraphPtr& graphPt
             return graphPtr->layers()->Get(layerIndex)->layer_as_PermuteLayer()->base();
         case Layer::Layer_Pooling2dLayer:
             return graphPtr->layers()->Get(layerIndex)->layer_as_Pooling2dLayer()->base();
+        case Layer::Layer_PreCompiledLayer:
+            return graphPtr->layers()->Get(layerIndex)->layer_as_PreCompiledLayer()->base();
         case Layer::Layer_PreluLayer:
             return graphPtr->layers()->Get(layerIndex)->layer_as_PreluLayer()->base();
         case Layer::Layer_QLstmLayer:
@@ -427,6 +457,22 @@ armnn::ActivationFunction ToActivationFunction(armnnSerializer::ActivationFuncti
     }
 }
 
+armnn::EdgeStrategy ToEdgeStrategy(armnnSerializer::EdgeStrategy edgeStrategy)
+{
+    switch (edgeStrategy)
+    {
+        case armnnSerializer::EdgeStrategy_DirectCompatibility:
+            return armnn::EdgeStrategy::DirectCompatibility;
+        case armnnSerializer::EdgeStrategy_ExportToTarget:
+            return armnn::EdgeStrategy::ExportToTarget;
+        case armnnSerializer::EdgeStrategy_CopyToTarget:
+            return armnn::EdgeStrategy::CopyToTarget;
+        case armnnSerializer::EdgeStrategy_Undefined:
+        default:
+            return armnn::EdgeStrategy::Undefined;
+    }
+}
+
 armnn::ArgMinMaxFunction ToArgMinMaxFunction(armnnSerializer::ArgMinMaxFunction function)
 {
     switch (function)
@@ -591,7 +637,7 @@ armnn::TensorInfo ToTensorInfo(Deserializer::TensorRawPtr tensorPtr)
     return result;
 }
 
-armnn::ConstTensor ToConstTensor(Deserializer::ConstTensorRawPtr constTensorPtr)
+armnn::ConstTensor ToEmbeddedConstTensor(Deserializer::ConstTensorRawPtr constTensorPtr)
 {
     CHECK_CONST_TENSOR_PTR(constTensorPtr);
     armnn::TensorInfo tensorInfo = ToTensorInfo(constTensorPtr->info());
@@ -683,6 +729,51 @@ void Deserializer::ResetParser()
     m_Network = armnn::INetworkPtr(nullptr, nullptr);
     m_InputBindings.clear();
     m_OutputBindings.clear();
+    m_Layers.clear();
+    m_ConstantDataFileName.clear();
+    m_ConstantDataFile.reset();
+    m_ExpandedConstants.clear();
+}
+
+armnn::ConstTensor Deserializer::ToConstTensor(ConstTensorRawPtr constTensorPtr)
+{
+    CHECK_CONST_TENSOR_PTR(constTensorPtr);
+    if (constTensorPtr->data_type() == ConstTensorData_BlockQuantizedData)
+    {
+        return ExpandBlockQuantizedConstTensor(constTensorPtr);
+    }
+    if (constTensorPtr->data_type() != ConstTensorData_ExternalData)
+    {
+        return ToEmbeddedConstTensor(constTensorPtr);
+    }
+
+    armnn::TensorInfo tensorInfo = ToTensorInfo(constTensorPtr->info());
+    auto externalData = constTensorPtr->data_as_ExternalData();
+    if (m_ConstantDataFileName.empty())
+    {
+        throw ParseException(fmt::format("The graph holds constant tensors stored in a separate file, which "
+                                         "wasn't given. {}",
+                                         CHECK_LOCATION().AsString()));
+    }
+    if (!m_ConstantDataFile)
+    {
+        m_ConstantDataFile = std::make_unique<armnnUtils::MemoryMappedFile>(m_ConstantDataFileName.c_str());
+    }
+
+    const uint64_t fileSize = m_ConstantDataFile->GetSize();
+    if (externalData->size() != tensorInfo.GetNumBytes() || externalData->offset() > fileSize ||
+        externalData->size() > fileSize - externalData->offset())
+    {
+        throw ParseException(fmt::format("The constant tensor of {0} bytes at offset {1} doesn't match the constant "
+                                         "data file {2} of {3} bytes. {4}",
+                                         externalData->size(),
+                                         externalData->offset(),
+                                         m_ConstantDataFileName,
+                                         fileSize,
+                                         CHECK_LOCATION().AsString()));
+    }
+    return armnn::ConstTensor(tensorInfo,
+                              m_ConstantDataFile->GetData() + static_cast<size_t>(externalData->offset()));
 }
 
 IDeserializer* IDeserializer::CreateRaw()
@@ -710,11 +801,114 @@ INetworkPtr Deserializer::CreateNetworkFromBinary(const std::vector<uint8_t>& bi
 armnn::INetworkPtr Deserializer::CreateNetworkFromBinary(std::istream& binaryContent)
 {
     ResetParser();
-    std::vector<uint8_t> content((std::istreambuf_iterator<char>(binaryContent)), std::istreambuf_iterator<char>());
+
+    // The stream is read in large blocks rather than one character at a time
+    const size_t blockSize = 1 << 20;
+    std::vector<uint8_t> content;
+    while (binaryContent)
+    {
+        const size_t size = content.size();
+        content.resize(size + blockSize);
+        binaryContent.read(reinterpret_cast<char*>(content.data() + size), static_cast<std::streamsize>(blockSize));
+        content.resize(size + static_cast<size_t>(binaryContent.gcount()));
+    }
+
     GraphPtr graph = LoadGraphFromBinary(content.data(), content.size());
     return CreateNetworkFromGraph(graph);
 }
 
+armnn::INetworkPtr Deserializer::CreateNetworkFromBinaryFile(const char* graphFile)
+{
+    if (graphFile == nullptr)
+    {
+        throw InvalidArgumentException(fmt::format("Invalid (null) file name {}",
+                                                   CHECK_LOCATION().AsString()));
+    }
+    ResetParser();
+
+    // The constants are copied from the mapped pages into the layers which hold them, so the network no longer
+    // refers to the file once it is unmapped
+    armnnUtils::MemoryMappedFile file(graphFile);
+    GraphPtr graph = LoadGraphFromBinary(file.GetData(), file.GetSize());
+    return CreateNetworkFromGraph(graph);
+}
+
+armnn::ConstTensor Deserializer::ExpandBlockQuantizedConstTensor(ConstTensorRawPtr constTensorPtr)
+{
+    armnn::TensorInfo tensorInfo = ToTensorInfo(constTensorPtr->info());
+    auto blockQuantizedData = constTensorPtr->data_as_BlockQuantizedData();
+    if (tensorInfo.GetDataType() != armnn::DataType::Float32 || blockQuantizedData->scales() == nullptr ||
+        blockQuantizedData->data() == nullptr)
+    {
+        throw ParseException(fmt::format("Invalid block quantized constant tensor of type {0}. {1}",
+                                         armnn::GetDataTypeName(tensorInfo.GetDataType()),
+                                         CHECK_LOCATION().AsString()));
+    }
+
+    std::unique_ptr<float[]> data(new float[tensorInfo.GetNumElements()]);
+    try
+    {
+        armnnUtils::BlockDequantize(blockQuantizedData->data()->data(),
+                                    blockQuantizedData->data()->size(),
+                                    blockQuantizedData->scales()->data(),
+                                    blockQuantizedData->scales()->size(),
+                                    blockQuantizedData->blockSize(),
+                                    blockQuantizedData->numBits(),
+                                    tensorInfo.GetNumElements(),
+                                    data.get());
+    }
+    catch (const armnn::InvalidArgumentException& e)
+    {
+        throw ParseException(fmt::format("{0} {1}", e.what(), CHECK_LOCATION().AsString()));
+    }
+
+    m_ExpandedConstants.push_back(std::move(data));
+    return armnn::ConstTensor(tensorInfo, m_ExpandedConstants.back().get());
+}
+
+armnn::INetworkPtr Deserializer::CreateNetworkFromBinaryFile(const char* graphFile, const char* constantDataFile)
+{
+    if (graphFile == nullptr || constantDataFile == nullptr)
+    {
+        throw InvalidArgumentException(fmt::format("Invalid (null) file name {}",
+                                                   CHECK_LOCATION().AsString()));
+    }
+    ResetParser();
+    m_ConstantDataFileName = constantDataFile;
+
+    armnnUtils::MemoryMappedFile file(graphFile);
+    GraphPtr graph = LoadGraphFromBinary(file.GetData(), file.GetSize());
+    INetworkPtr network = CreateNetworkFromGraph(graph);
+
+    // The layers hold copies of their constants, so the constant data file is only mapped while they are created
+    m_ConstantDataFile.reset();
+    return network;
+}
+
+armnn::IOptimizedNetworkPtr Deserializer::CreateOptimizedNetworkFromBinary(const uint8_t* binaryContent,
+                                                                         size_t len,
+                                                                         const std::string& networkKey,
+                                                                         const armnn::ModelOptions& modelOptions)
+{
+    ResetParser();
+    GraphPtr graph = LoadGraphFromBinary(binaryContent, len);
+    if (graph->optimizedNetworkKey() == nullptr || graph->optimizedNetworkKey()->str() != networkKey)
+    {
+        throw ParseException(fmt::format("The binary content doesn't hold the optimized network {0} {1}",
+                                         networkKey,
+                                         CHECK_LOCATION().AsString()));
+    }
+
+    INetworkPtr network = CreateNetworkFromGraph(graph);
+    SetOptimizedLayerProperties(graph);
+
+    // The layers are moved to the graph of the optimized network along with their connections and properties
+    auto optimizedGraph =
+        std::make_unique<armnn::Graph>(std::move(PolymorphicDowncast<armnn::Network*>(network.get())->GetGraph()));
+    return IOptimizedNetworkPtr(new armnn::OptimizedNetwork(std::move(optimizedGraph), modelOptions),
+                                &IOptimizedNetwork::Destroy);
+}
+
 Deserializer::GraphPtr Deserializer::LoadGraphFromBinary(const uint8_t* binaryContent, size_t len)
 {
     if (binaryContent == nullptr)
@@ -771,6 +965,8 @@ INetworkPtr Deserializer::CreateNetworkFromGraph(GraphPtr graph)
         }
     }
 
+    // The layers hold copies of their constants
+    m_ExpandedConstants.clear();
     return std::move(m_Network);
 }
 
@@ -963,6 +1159,8 @@ void Deserializer::RegisterOutputSlots(GraphPtr graph,
                                          CHECK_LOCATION().AsString()));
     }
 
+    m_Layers[layerIndex] = layer;
+
     for (unsigned int i = 0; i < layer->GetNumOutputSlots(); ++i)
     {
         const unsigned int slotIndex = baseLayer->outputSlots()->Get(i)->index();
@@ -989,6 +1187,8 @@ void Deserializer::RegisterInputSlots(GraphPtr graph,
                                          CHECK_LOCATION().AsString()));
     }
 
+    m_Layers[layerIndex] = layer;
+
     for (unsigned int i = 0; i < layer->GetNumInputSlots(); ++i)
     {
         auto fbInputSlot = baseLayer->inputSlots()->Get(i);
@@ -998,6 +1198,61 @@ void Deserializer::RegisterInputSlots(GraphPtr graph,
     }
 }
 
+void Deserializer::SetOptimizedLayerProperties(GraphPtr graph)
+{
+    CHECK_GRAPH(graph, 0);
+    for (unsigned int layerIndex = 0; layerIndex < graph->layers()->size(); ++layerIndex)
+    {
+        LayerBaseRawPtr baseLayer = GetBaseLayer(graph, layerIndex);
+        auto layerIt = m_Layers.find(layerIndex);
+        if (layerIt == m_Layers.end())
+        {
+            throw ParseException(fmt::format("Layer index {0} was not deserialized {1}",
+                                             layerIndex,
+                                             CHECK_LOCATION().AsString()));
+        }
+        armnn::Layer* layer = PolymorphicDowncast<armnn::Layer*>(layerIt->second);
+
+        if (baseLayer->backendId() != nullptr)
+        {
+            layer->SetBackendId(armnn::BackendId(baseLayer->backendId()->str()));
+        }
+
+        if (auto fbFusedActivation = baseLayer->fusedActivation())
+        {
+            auto fusedActivation = std::make_shared<armnn::ActivationDescriptor>();
+            fusedActivation->m_Function = ToActivationFunction(fbFusedActivation->activationFunction());
+            fusedActivation->m_A = fbFusedActivation->a();
+            fusedActivation->m_B = fbFusedActivation->b();
+            layer->SetAdditionalInfoForObject(fusedActivation);
+        }
+
+        for (unsigned int i = 0; i < baseLayer->outputSlots()->size(); ++i)
+        {
+            auto fbOutputSlot = baseLayer->outputSlots()->Get(i);
+            if (fbOutputSlot->tensorHandleFactoryId() != nullptr)
+            {
+                layer->GetOutputSlot(fbOutputSlot->index()).SetTensorHandleFactory(
+                    fbOutputSlot->tensorHandleFactoryId()->str());
+            }
+        }
+
+        // The strategy of each connection is recorded by its input slot, as the connections of an output slot
+        // aren't made in the order they had when the network was serialized
+        for (unsigned int i = 0; i < baseLayer->inputSlots()->size(); ++i)
+        {
+            auto fbInputSlot = baseLayer->inputSlots()->Get(i);
+            armnn::InputSlot& inputSlot = layer->GetInputSlot(fbInputSlot->index());
+            armnn::OutputSlot* sourceSlot = inputSlot.GetConnectedOutputSlot();
+            const std::vector<armnn::InputSlot*>& sourceConnections = sourceSlot->GetConnections();
+            auto position = std::find(sourceConnections.begin(), sourceConnections.end(), &inputSlot);
+            sourceSlot->SetEdgeStrategy(armnn::numeric_cast<unsigned int>(std::distance(sourceConnections.begin(),
+                                                                                        position)),
+                                        ToEdgeStrategy(fbInputSlot->edgeStrategy()));
+        }
+    }
+}
+
 void Deserializer::RegisterInputSlotOfConnection(uint32_t sourceLayerIndex,
                                                  uint32_t outputSlotIndex,
                                                  armnn::IInputSlot* inputSlot)
@@ -2037,6 +2292,95 @@ armnn::TensorInfo Deserializer::OutputShapeOfReshape(const armnn::TensorInfo& in
     return reshapeInfo;
 }
 
+void Deserializer::ParseOptimizerLayer(GraphPtr graph, unsigned int layerIndex)
+{
+    CHECK_LAYERS(graph, 0, layerIndex);
+
+    Deserializer::TensorRawPtrVector inputs = GetInputs(graph, layerIndex);
+    CHECK_VALID_SIZE(inputs.size(), 1);
+
+    Deserializer::TensorRawPtrVector outputs = GetOutputs(graph, layerIndex);
+    CHECK_VALID_SIZE(outputs.size(), 1);
+
+    auto layerName = GetLayerName(graph, layerIndex);
+
+    // These layers are only inserted by the optimizer, so they are added to the graph of the network directly
+    armnn::Graph& networkGraph = PolymorphicDowncast<armnn::Network*>(m_Network.get())->GetGraph();
+    IConnectableLayer* layer = nullptr;
+    switch (graph->layers()->Get(layerIndex)->layer_type())
+    {
+        case Layer::Layer_ConvertBf16ToFp32Layer:
+            layer = networkGraph.AddLayer<armnn::ConvertBf16ToFp32Layer>(layerName.c_str());
+            break;
+        case Layer::Layer_ConvertFp16ToFp32Layer:
+            layer = networkGraph.AddLayer<armnn::ConvertFp16ToFp32Layer>(layerName.c_str());
+            break;
+        case Layer::Layer_ConvertFp32ToBf16Layer:
+            layer = networkGraph.AddLayer<armnn::ConvertFp32ToBf16Layer>(layerName.c_str());
+            break;
+        case Layer::Layer_ConvertFp32ToFp16Layer:
+            layer = networkGraph.AddLayer<armnn::ConvertFp32ToFp16Layer>(layerName.c_str());
+            break;
+        case Layer::Layer_MemCopyLayer:
+            layer = networkGraph.AddLayer<armnn::MemCopyLayer>(layerName.c_str());
+            break;
+        case Layer::Layer_MemImportLayer:
+            layer = networkGraph.AddLayer<armnn::MemImportLayer>(layerName.c_str());
+            break;
+        default:
+            throw ParseException(fmt::format("Layer index {0} is not inserted by the optimizer {1}",
+                                             layerIndex,
+                                             CHECK_LOCATION().AsString()));
+    }
+
+    armnn::TensorInfo outputTensorInfo = ToTensorInfo(outputs[0]);
+    layer->GetOutputSlot(0).SetTensorInfo(outputTensorInfo);
+
+    RegisterInputSlots(graph, layerIndex, layer);
+    RegisterOutputSlots(graph, layerIndex, layer);
+}
+
+void Deserializer::ParsePreCompiled(GraphPtr graph, unsigned int layerIndex)
+{
+    CHECK_LAYERS(graph, 0, layerIndex);
+
+    auto fbLayer = graph->layers()->Get(layerIndex)->layer_as_PreCompiledLayer();
+    auto fbDescriptor = fbLayer->descriptor();
+    auto fbBackendId = fbLayer->base()->backendId();
+    if (fbDescriptor == nullptr || fbLayer->data() == nullptr || fbBackendId == nullptr)
+    {
+        throw ParseException(fmt::format("The precompiled layer {0} has no descriptor, data or backend {1}",
+                                         layerIndex,
+                                         CHECK_LOCATION().AsString()));
+    }
+
+    Deserializer::TensorRawPtrVector inputs = GetInputs(graph, layerIndex);
+    CHECK_VALID_SIZE(inputs.size(), fbDescriptor->numInputSlots());
+
+    Deserializer::TensorRawPtrVector outputs = GetOutputs(graph, layerIndex);
+    CHECK_VALID_SIZE(outputs.size(), fbDescriptor->numOutputSlots());
+
+    auto layerName = GetLayerName(graph, layerIndex);
+
+    // Precompiled layers are only created by the backends, which restore their precompiled objects. The layer is
+    // added to the graph of the network directly like the layers inserted by the optimizer.
+    armnn::PreCompiledDescriptor descriptor(fbDescriptor->numInputSlots(), fbDescriptor->numOutputSlots());
+    armnn::Graph& networkGraph = PolymorphicDowncast<armnn::Network*>(m_Network.get())->GetGraph();
+    armnn::PreCompiledLayer* layer = networkGraph.AddLayer<armnn::PreCompiledLayer>(descriptor, layerName.c_str());
+
+    auto backend = armnn::BackendRegistryInstance().GetFactory(fbBackendId->str())();
+    backend->DeserializePreCompiledObject(*layer, std::vector<uint8_t>(fbLayer->data()->begin(),
+                                                                       fbLayer->data()->end()));
+
+    for (unsigned int i = 0; i < outputs.size(); ++i)
+    {
+        layer->GetOutputSlot(i).SetTensorInfo(ToTensorInfo(outputs[i]));
+    }
+
+    RegisterInputSlots(graph, layerIndex, layer);
+    RegisterOutputSlots(graph, layerIndex, layer);
+}
+
 void Deserializer::ParseRank(GraphPtr graph, unsigned int layerIndex)
 {
     CHECK_LAYERS(graph, 0, layerIndex);
@@ -9,6 +9,9 @@
 #include "armnnDeserializer/IDeserializer.hpp"
 #include <ArmnnSchema_generated.h>
 
+#include <MemoryMappedFile.hpp>
+
+#include <memory>
 #include <unordered_map>
 
 namespace armnnDeserializer
@@ -39,6 +42,20 @@ public:
     /// Create an input network from a binary input stream
     armnn::INetworkPtr CreateNetworkFromBinary(std::istream& binaryContent) override;
 
+    /// Create an input network from a binary file, which is mapped into memory rather than read into a buffer
+    armnn::INetworkPtr CreateNetworkFromBinaryFile(const char* graphFile) override;
+
+    /// Create an input network from a binary file whose large constant tensors are held in a separate file
+    armnn::INetworkPtr CreateNetworkFromBinaryFile(const char* graphFile, const char* constantDataFile) override;
+
+    /// Create an optimized network from binary file contents serialized with the properties set by the optimizer
+    /// @param [in] networkKey The key the network was serialized with, checked against the binary content
+    /// @param [in] modelOptions The backend options the network was optimized with
+    armnn::IOptimizedNetworkPtr CreateOptimizedNetworkFromBinary(const uint8_t* binaryContent,
+                                                                 size_t len,
+                                                                 const std::string& networkKey,
+                                                                 const armnn::ModelOptions& modelOptions);
+
     /// Retrieve binding info (layer id and tensor info) for the network input identified by the given layer name
     BindingPointInfo GetNetworkInputBindingInfo(unsigned int layerId, const std::string& name) const override;
 
@@ -111,11 +128,13 @@ private:
     void ParseMerge(GraphPtr graph, unsigned int layerIndex);
     void ParseMultiplication(GraphPtr graph, unsigned int layerIndex);
     void ParseNormalization(GraphPtr graph, unsigned int layerIndex);
+    void ParseOptimizerLayer(GraphPtr graph, unsigned int layerIndex);
     void ParseLstm(GraphPtr graph, unsigned int layerIndex);
     void ParseQuantizedLstm(GraphPtr graph, unsigned int layerIndex);
     void ParsePad(GraphPtr graph, unsigned int layerIndex);
     void ParsePermute(GraphPtr graph, unsigned int layerIndex);
     void ParsePooling2d(GraphPtr graph, unsigned int layerIndex);
+    void ParsePreCompiled(GraphPtr graph, unsigned int layerIndex);
     void ParsePrelu(GraphPtr graph, unsigned int layerIndex);
     void ParseQLstm(GraphPtr graph, unsigned int layerIndex);
     void ParseQuantize(GraphPtr graph, unsigned int layerIndex);
@@ -142,12 +161,21 @@ private:
     void RegisterOutputSlots(GraphPtr graph, uint32_t layerIndex,
                              armnn::IConnectableLayer* layer);
 
+    /// Sets the backends, tensor handle strategies and fused activations of the layers of an optimized network
+    void SetOptimizedLayerProperties(GraphPtr graph);
+
     // NOTE index here must be from flatbuffer object index property
     void RegisterOutputSlotOfConnection(uint32_t sourceLayerIndex, uint32_t outputSlotIndex, armnn::IOutputSlot* slot);
     void RegisterInputSlotOfConnection(uint32_t sourceLayerIndex, uint32_t outputSlotIndex, armnn::IInputSlot* slot);
 
     void ResetParser();
 
+    /// Returns the constant tensor of the graph, which points into the constant data file for external data
+    armnn::ConstTensor ToConstTensor(ConstTensorRawPtr constTensorPtr);
+
+    /// Returns the Float32 constant tensor expanded from block quantized data, which is held until the network is built
+    armnn::ConstTensor ExpandBlockQuantizedConstTensor(ConstTensorRawPtr constTensorPtr);
+
     void SetupInputLayers(GraphPtr graphPtr);
     void SetupOutputLayers(GraphPtr graphPtr);
 
@@ -186,6 +214,16 @@ private:
 
     /// Maps layer index (index property in flatbuffer object) to Connections for each layer
     std::unordered_map<unsigned int, Connections> m_GraphConnections;
+
+    /// Maps the index of a layer in the flatbuffer vector to the layer created for it
+    std::unordered_map<unsigned int, armnn::IConnectableLayer*> m_Layers;
+
+    /// File holding the data of the constant tensors stored outside of the graph, and its mapping once it is needed
+    std::string                                   m_ConstantDataFileName;
+    std::unique_ptr<armnnUtils::MemoryMappedFile> m_ConstantDataFile;
+
+    /// Data of the constant tensors expanded from their compressed form while the network is built
+    std::vector<std::unique_ptr<float[]>>         m_ExpandedConstants;
 };
 
 } // namespace armnnDeserializer
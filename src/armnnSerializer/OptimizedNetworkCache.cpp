@@ -0,0 +1,205 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include <armnnSerializer/OptimizedNetworkCache.hpp>
+
+#include "Serializer.hpp"
+#include "../armnnDeserializer/Deserializer.hpp"
+
+#include <armnn/Exceptions.hpp>
+#include <armnn/Logging.hpp>
+#include <armnn/Version.hpp>
+
+#include <MemoryMappedFile.hpp>
+#include <Processes.hpp>
+#include <Sha256.hpp>
+
+#include <cstdio>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <type_traits>
+
+namespace armnnSerializer
+{
+
+namespace
+{
+
+/// Feeds values to a SHA-256 digest, so that the keys of different models or options can't be made to collide.
+class KeyHasher
+{
+public:
+    void AddBytes(const void* data, size_t size)
+    {
+        m_Digest.Update(data, size);
+    }
+
+    template <typename T>
+    void AddValue(const T& value)
+    {
+        static_assert(std::is_arithmetic<T>::value || std::is_enum<T>::value, "Only plain values can be hashed");
+        AddBytes(&value, sizeof(value));
+    }
+
+    /// Strings are prefixed with their size, so that consecutive strings can't be mistaken for others.
+    void AddString(const std::string& value)
+    {
+        AddValue(value.size());
+        AddBytes(value.data(), value.size());
+    }
+
+    std::string GetHexDigest()
+    {
+        return m_Digest.FinalizeHex();
+    }
+
+private:
+    armnnUtils::Sha256 m_Digest;
+};
+
+void AddBackendOptionValue(KeyHasher& hasher, const armnn::BackendOptions::Var& value)
+{
+    if (value.IsBool())
+    {
+        hasher.AddString("bool");
+        hasher.AddValue(value.AsBool());
+    }
+    else if (value.IsInt())
+    {
+        hasher.AddString("int");
+        hasher.AddValue(value.AsInt());
+    }
+    else if (value.IsFloat())
+    {
+        hasher.AddString("float");
+        hasher.AddValue(value.AsFloat());
+    }
+    else if (value.IsString())
+    {
+        hasher.AddString("string");
+        hasher.AddString(value.AsString());
+    }
+}
+
+armnn::IOptimizedNetworkPtr EmptyOptimizedNetwork()
+{
+    return armnn::IOptimizedNetworkPtr(nullptr, &armnn::IOptimizedNetwork::Destroy);
+}
+
+} // anonymous namespace
+
+OptimizedNetworkCache::OptimizedNetworkCache(const std::string& directory)
+    : m_Directory(directory)
+{
+}
+
+std::string OptimizedNetworkCache::GetKey(const void* modelContent,
+                                          size_t modelSize,
+                                          const std::vector<armnn::BackendId>& backendPreferences,
+                                          const armnn::OptimizerOptions& options)
+{
+    KeyHasher hasher;
+    hasher.AddString(ARMNN_VERSION);
+
+    hasher.AddValue(modelSize);
+    hasher.AddBytes(modelContent, modelSize);
+
+    hasher.AddValue(backendPreferences.size());
+    for (const armnn::BackendId& backend : backendPreferences)
+    {
+        hasher.AddString(backend.Get());
+    }
+
+    hasher.AddValue(options.m_ReduceFp32ToFp16);
+    hasher.AddValue(options.m_Debug);
+    hasher.AddValue(options.m_ReduceFp32ToBf16);
+    hasher.AddValue(options.m_shapeInferenceMethod);
+    hasher.AddValue(options.m_ImportEnabled);
+
+    hasher.AddValue(options.m_ModelOptions.size());
+    for (const armnn::BackendOptions& backendOptions : options.m_ModelOptions)
+    {
+        hasher.AddString(backendOptions.GetBackendId().Get());
+        hasher.AddValue(backendOptions.GetOptionCount());
+        for (size_t i = 0; i < backendOptions.GetOptionCount(); ++i)
+        {
+            const armnn::BackendOptions::BackendOption& option = backendOptions.GetOption(i);
+            hasher.AddString(option.GetName());
+            AddBackendOptionValue(hasher, option.GetValue());
+        }
+    }
+
+    // The size of the model is kept in clear next to the digest. Both are held by the cached network, which is only
+    // loaded under the key it was stored with.
+    return hasher.GetHexDigest() + "-" + std::to_string(modelSize);
+}
+
+armnn::IOptimizedNetworkPtr OptimizedNetworkCache::Load(const std::string& key,
+                                                        const armnn::ModelOptions& modelOptions) const
+{
+    const std::string path = GetPath(key);
+    if (!std::ifstream(path))
+    {
+        return EmptyOptimizedNetwork();
+    }
+
+    try
+    {
+        armnnUtils::MemoryMappedFile file(path.c_str());
+        armnnDeserializer::Deserializer deserializer;
+        return deserializer.CreateOptimizedNetworkFromBinary(file.GetData(), file.GetSize(), key, modelOptions);
+    }
+    catch (const armnn::Exception& e)
+    {
+        ARMNN_LOG(warning) << "Ignoring the optimized network cached in " << path << ": " << e.what();
+        return EmptyOptimizedNetwork();
+    }
+}
+
+bool OptimizedNetworkCache::Store(const std::string& key, const armnn::IOptimizedNetwork& network) const
+{
+    Serializer serializer;
+    try
+    {
+        serializer.Serialize(network, key);
+    }
+    catch (const armnn::Exception& e)
+    {
+        ARMNN_LOG(warning) << "The optimized network can't be cached: " << e.what();
+        return false;
+    }
+
+    // The network is written next to its entry and renamed into place, so that no process loads a partial entry.
+    // The temporary file is unique to the call, as several threads or processes may store the same key at once.
+    const std::string path = GetPath(key);
+    std::stringstream temporarySuffix;
+    temporarySuffix << "." << armnnUtils::Processes::GetCurrentId() << "-" << std::hex << std::random_device()()
+                    << std::random_device()() << ".tmp";
+    const std::string temporaryPath = path + temporarySuffix.str();
+    {
+        std::ofstream file(temporaryPath, std::ios::binary | std::ios::trunc);
+        if (!file || !serializer.SaveSerializedToStream(file) || !file.flush())
+        {
+            ARMNN_LOG(warning) << "Failed to write the optimized network to " << temporaryPath;
+            std::remove(temporaryPath.c_str());
+            return false;
+        }
+    }
+    if (std::rename(temporaryPath.c_str(), path.c_str()) != 0)
+    {
+        ARMNN_LOG(warning) << "Failed to store the optimized network in " << path;
+        std::remove(temporaryPath.c_str());
+        return false;
+    }
+    return true;
+}
+
+std::string OptimizedNetworkCache::GetPath(const std::string& key) const
+{
+    return m_Directory + "/" + key + ".armnn";
+}
+
+} // namespace armnnSerializer
@@ -4,12 +4,19 @@
 //
 #include "Serializer.hpp"
 
+#include <armnn/BackendRegistry.hpp>
 #include <armnn/Descriptors.hpp>
 #include <armnn/LstmParams.hpp>
 #include <armnn/QuantizedLstmParams.hpp>
+#include <armnn/backends/IBackendInternal.hpp>
 #include <armnn/utility/IgnoreUnused.hpp>
 #include <armnn/utility/NumericCast.hpp>
+#include <armnn/utility/PolymorphicDowncast.hpp>
 
+#include <BlockQuantization.hpp>
+#include <Network.hpp>
+
+#include <algorithm>
 #include <iostream>
 
 #include <flatbuffers/util.h>
@@ -318,7 +325,7 @@ void SerializerVisitor::VisitConvolution2dLayer(const armnn::IConnectableLayer*
                                                               descriptor.m_DilationY,
                                                               descriptor.m_BiasEnabled,
                                                               GetFlatBufferDataLayout(descriptor.m_DataLayout));
-    auto flatBufferWeightsConstTensorInfo = CreateConstTensorInfo(weights);
+    auto flatBufferWeightsConstTensorInfo = CreateWeightsTensorInfo(weights);
     flatbuffers::Offset<serializer::ConstTensor> flatBufferBiasesConstTensorInfo;
 
     if (biases.has_value())
@@ -374,7 +381,7 @@ void SerializerVisitor::VisitDepthwiseConvolution2dLayer(const armnn::IConnectab
                                                                descriptor.m_BiasEnabled,
                                                                GetFlatBufferDataLayout(descriptor.m_DataLayout));
 
-    flatbuffers::Offset<serializer::ConstTensor> fbWeightsConstTensorInfo = CreateConstTensorInfo(weights);
+    flatbuffers::Offset<serializer::ConstTensor> fbWeightsConstTensorInfo = CreateWeightsTensorInfo(weights);
     flatbuffers::Offset<serializer::ConstTensor> fbBiasesConstTensorInfo;
     if (biases.has_value())
     {
@@ -1071,7 +1078,7 @@ void SerializerVisitor::VisitFullyConnectedLayer(const armnn::IConnectableLayer*
                                                    fullyConnectedDescriptor.m_TransposeWeightMatrix);
 
     // Create FlatBuffer weights data
-    auto flatBufferWeights = CreateConstTensorInfo(weights);
+    auto flatBufferWeights = CreateWeightsTensorInfo(weights);
 
     // Create FlatBuffer bias data
     flatbuffers::Offset<serializer::ConstTensor> flatBufferBiases;
@@ -1341,7 +1348,7 @@ void SerializerVisitor::VisitTransposeConvolution2dLayer(
                                                                GetFlatBufferDataLayout(descriptor.m_DataLayout));
 
     // weights & biases
-    auto fbWeightsConstTensorInfo = CreateConstTensorInfo(weights);
+    auto fbWeightsConstTensorInfo = CreateWeightsTensorInfo(weights);
     flatbuffers::Offset<serializer::ConstTensor> fbBiasesConstTensorInfo;
     if (biases.has_value())
     {
@@ -1565,12 +1572,110 @@ fb::Offset<serializer::LayerBase> SerializerVisitor::CreateLayerBase(const IConn
     std::vector<fb::Offset<serializer::InputSlot>> inputSlots = CreateInputSlots(layer);
     std::vector<fb::Offset<serializer::OutputSlot>> outputSlots = CreateOutputSlots(layer);
 
+    if (!m_SerializeOptimizedProperties)
+    {
+        return serializer::CreateLayerBase(m_flatBufferBuilder,
+                                           fbIndex,
+                                           m_flatBufferBuilder.CreateString(layer->GetName()),
+                                           layerType,
+                                           m_flatBufferBuilder.CreateVector(inputSlots),
+                                           m_flatBufferBuilder.CreateVector(outputSlots));
+    }
+
+    const armnn::Layer* optimizedLayer = PolymorphicDowncast<const armnn::Layer*>(layer);
+
+    // The activations fused into a layer by its backend are the only information backends attach to layers
+    flatbuffers::Offset<serializer::ActivationDescriptor> fusedActivation;
+    if (auto activation = optimizedLayer->GetAdditionalInformation<armnn::ActivationDescriptor>())
+    {
+        fusedActivation = serializer::CreateActivationDescriptor(
+            m_flatBufferBuilder,
+            GetFlatBufferActivationFunction(activation->m_Function),
+            activation->m_A,
+            activation->m_B);
+    }
+
     return serializer::CreateLayerBase(m_flatBufferBuilder,
                                        fbIndex,
                                        m_flatBufferBuilder.CreateString(layer->GetName()),
                                        layerType,
                                        m_flatBufferBuilder.CreateVector(inputSlots),
-                                       m_flatBufferBuilder.CreateVector(outputSlots));
+                                       m_flatBufferBuilder.CreateVector(outputSlots),
+                                       m_flatBufferBuilder.CreateString(optimizedLayer->GetBackendId().Get()),
+                                       fusedActivation);
+}
+
+void SerializerVisitor::VisitOptimizerLayer(const armnn::IConnectableLayer* layer)
+{
+    const armnn::LayerType layerType = PolymorphicDowncast<const armnn::Layer*>(layer)->GetType();
+    switch (layerType)
+    {
+        case armnn::LayerType::MemCopy:
+        {
+            auto fbBaseLayer = CreateLayerBase(layer, serializer::LayerType::LayerType_MemCopy);
+            auto fbLayer = serializer::CreateMemCopyLayer(m_flatBufferBuilder, fbBaseLayer);
+            CreateAnyLayer(fbLayer.o, serializer::Layer::Layer_MemCopyLayer);
+            break;
+        }
+        case armnn::LayerType::MemImport:
+        {
+            auto fbBaseLayer = CreateLayerBase(layer, serializer::LayerType::LayerType_MemImport);
+            auto fbLayer = serializer::CreateMemImportLayer(m_flatBufferBuilder, fbBaseLayer);
+            CreateAnyLayer(fbLayer.o, serializer::Layer::Layer_MemImportLayer);
+            break;
+        }
+        case armnn::LayerType::ConvertFp16ToFp32:
+        {
+            auto fbBaseLayer = CreateLayerBase(layer, serializer::LayerType::LayerType_ConvertFp16ToFp32);
+            auto fbLayer = serializer::CreateConvertFp16ToFp32Layer(m_flatBufferBuilder, fbBaseLayer);
+            CreateAnyLayer(fbLayer.o, serializer::Layer::Layer_ConvertFp16ToFp32Layer);
+            break;
+        }
+        case armnn::LayerType::ConvertFp32ToFp16:
+        {
+            auto fbBaseLayer = CreateLayerBase(layer, serializer::LayerType::LayerType_ConvertFp32ToFp16);
+            auto fbLayer = serializer::CreateConvertFp32ToFp16Layer(m_flatBufferBuilder, fbBaseLayer);
+            CreateAnyLayer(fbLayer.o, serializer::Layer::Layer_ConvertFp32ToFp16Layer);
+            break;
+        }
+        case armnn::LayerType::ConvertBf16ToFp32:
+        {
+            auto fbBaseLayer = CreateLayerBase(layer, serializer::LayerType::LayerType_ConvertBf16ToFp32);
+            auto fbLayer = serializer::CreateConvertBf16ToFp32Layer(m_flatBufferBuilder, fbBaseLayer);
+            CreateAnyLayer(fbLayer.o, serializer::Layer::Layer_ConvertBf16ToFp32Layer);
+            break;
+        }
+        case armnn::LayerType::ConvertFp32ToBf16:
+        {
+            auto fbBaseLayer = CreateLayerBase(layer, serializer::LayerType::LayerType_ConvertFp32ToBf16);
+            auto fbLayer = serializer::CreateConvertFp32ToBf16Layer(m_flatBufferBuilder, fbBaseLayer);
+            CreateAnyLayer(fbLayer.o, serializer::Layer::Layer_ConvertFp32ToBf16Layer);
+            break;
+        }
+        case armnn::LayerType::PreCompiled:
+        {
+            // The precompiled object is only known to the backend the layer is assigned to, which throws if it
+            // can't write it
+            auto preCompiledLayer = PolymorphicDowncast<const armnn::PreCompiledLayer*>(layer);
+            auto backend = armnn::BackendRegistryInstance().GetFactory(preCompiledLayer->GetBackendId())();
+            std::vector<uint8_t> data = backend->SerializePreCompiledObject(*preCompiledLayer);
+
+            const armnn::PreCompiledDescriptor& descriptor = preCompiledLayer->GetParameters();
+            auto fbBaseLayer = CreateLayerBase(layer, serializer::LayerType::LayerType_PreCompiled);
+            auto fbDescriptor = serializer::CreatePreCompiledDescriptor(m_flatBufferBuilder,
+                                                                        descriptor.m_NumInputSlots,
+                                                                        descriptor.m_NumOutputSlots);
+            auto fbLayer = serializer::CreatePreCompiledLayer(m_flatBufferBuilder,
+                                                              fbBaseLayer,
+                                                              fbDescriptor,
+                                                              m_flatBufferBuilder.CreateVector(data));
+            CreateAnyLayer(fbLayer.o, serializer::Layer::Layer_PreCompiledLayer);
+            break;
+        }
+        default:
+            throw armnn::InvalidArgumentException(std::string("Layers of type ") + GetLayerTypeAsCString(layerType) +
+                                                  " can't be serialized");
+    }
 }
 
 void SerializerVisitor::CreateAnyLayer(const flatbuffers::Offset<void>& layer, const serializer::Layer serializerLayer)
@@ -1632,6 +1737,15 @@ flatbuffers::Offset<serializer::ConstTensor>
 {
     armnn::TensorInfo tensorInfo = constTensor.GetInfo();
 
+    if (m_ConstantDataStream != nullptr && constTensor.GetNumBytes() >= m_MinExternalBytes)
+    {
+        flatbuffers::Offset<serializer::ExternalData> externalData = CreateExternalData(constTensor);
+        return serializer::CreateConstTensor(m_flatBufferBuilder,
+                                             CreateTensorInfo(tensorInfo),
+                                             serializer::ConstTensorData_ExternalData,
+                                             externalData.o);
+    }
+
     flatbuffers::Offset<void> fbPayload;
 
     switch (tensorInfo.GetDataType())
@@ -1678,6 +1792,65 @@ flatbuffers::Offset<serializer::ConstTensor>
     return flatBufferConstTensor;
 }
 
+flatbuffers::Offset<serializer::ConstTensor>
+    SerializerVisitor::CreateWeightsTensorInfo(const armnn::ConstTensor& weights)
+{
+    if (m_WeightCompressionBits == 0 || weights.GetInfo().GetDataType() != armnn::DataType::Float32)
+    {
+        return CreateConstTensorInfo(weights);
+    }
+
+    armnnUtils::BlockQuantizedValues quantized =
+        armnnUtils::BlockQuantize(static_cast<const float*>(weights.GetMemoryArea()), weights.GetNumElements(),
+                                  m_WeightCompressionBlockSize, m_WeightCompressionBits);
+    auto blockQuantizedData = serializer::CreateBlockQuantizedData(
+            m_flatBufferBuilder,
+            quantized.m_BlockSize,
+            armnn::numeric_cast<uint8_t>(quantized.m_NumBits),
+            m_flatBufferBuilder.CreateVector(quantized.m_Scales),
+            m_flatBufferBuilder.CreateVector(quantized.m_Data));
+
+    return serializer::CreateConstTensor(m_flatBufferBuilder,
+                                         CreateTensorInfo(weights.GetInfo()),
+                                         serializer::ConstTensorData_BlockQuantizedData,
+                                         blockQuantizedData.o);
+}
+
+void SerializerVisitor::SetConstantDataStream(std::ostream& stream, size_t minExternalBytes)
+{
+    // The offsets of the data are counted from the start of the stream, which may already hold data
+    const std::streampos position = stream.tellp();
+    if (position == std::streampos(-1))
+    {
+        throw armnn::InvalidArgumentException("The position of the constant data stream cannot be determined");
+    }
+
+    m_ConstantDataStream = &stream;
+    m_MinExternalBytes = minExternalBytes;
+    m_ConstantDataPosition = armnn::numeric_cast<uint64_t>(static_cast<std::streamoff>(position));
+}
+
+flatbuffers::Offset<serializer::ExternalData>
+    SerializerVisitor::CreateExternalData(const armnn::ConstTensor& constTensor)
+{
+    // The data is padded so that the deserializer can read the tensor in place from the mapped stream
+    const uint64_t alignment = ISerializer::ConstantDataAlignment;
+    const uint64_t padding = (alignment - m_ConstantDataPosition % alignment) % alignment;
+    const char zeros[ISerializer::ConstantDataAlignment] = {};
+    m_ConstantDataStream->write(zeros, armnn::numeric_cast<std::streamsize>(padding));
+
+    const uint64_t offset = m_ConstantDataPosition + padding;
+    m_ConstantDataStream->write(static_cast<const char*>(constTensor.GetMemoryArea()),
+                                armnn::numeric_cast<std::streamsize>(constTensor.GetNumBytes()));
+    if (!*m_ConstantDataStream)
+    {
+        throw armnn::RuntimeException("Failed to write the data of a constant tensor to the constant data stream");
+    }
+    m_ConstantDataPosition = offset + constTensor.GetNumBytes();
+
+    return serializer::CreateExternalData(m_flatBufferBuilder, offset, constTensor.GetNumBytes());
+}
+
 flatbuffers::Offset<armnnSerializer::FeatureCompatibilityVersions> SerializerVisitor::GetVersionTable()
 {
     flatbuffers::Offset<armnnSerializer::FeatureCompatibilityVersions> versionsTable =
@@ -1704,8 +1877,21 @@ std::vector<fb::Offset<serializer::InputSlot>>
         // Create FlatBuffer Connection
         serializer::Connection conn(GetSerializedId(inputSlot.GetConnection()->GetOwningLayerGuid()),
                                     connection->CalculateIndexOnOwner());
+
+        // The strategies of the connections are held by their output slots
+        serializer::EdgeStrategy edgeStrategy = serializer::EdgeStrategy_Undefined;
+        if (m_SerializeOptimizedProperties)
+        {
+            const armnn::InputSlot* optimizedSlot = PolymorphicDowncast<const armnn::InputSlot*>(&inputSlot);
+            const armnn::OutputSlot* sourceSlot = optimizedSlot->GetConnectedOutputSlot();
+            const std::vector<armnn::InputSlot*>& sourceConnections = sourceSlot->GetConnections();
+            auto position = std::find(sourceConnections.begin(), sourceConnections.end(), optimizedSlot);
+            edgeStrategy = GetFlatBufferEdgeStrategy(sourceSlot->GetEdgeStrategyForConnection(
+                armnn::numeric_cast<unsigned int>(std::distance(sourceConnections.begin(), position))));
+        }
+
         // Create FlatBuffer InputSlot
-        inputSlots.push_back(serializer::CreateInputSlot(m_flatBufferBuilder, slotIndex, &conn));
+        inputSlots.push_back(serializer::CreateInputSlot(m_flatBufferBuilder, slotIndex, &conn, edgeStrategy));
     }
     return inputSlots;
 }
@@ -1721,10 +1907,18 @@ std::vector<fb::Offset<serializer::OutputSlot>>
         const IOutputSlot& outputSlot = layer->GetOutputSlot(slotIndex);
         const armnn::TensorInfo& tensorInfo = outputSlot.GetTensorInfo();
 
+        flatbuffers::Offset<flatbuffers::String> tensorHandleFactoryId;
+        if (m_SerializeOptimizedProperties)
+        {
+            tensorHandleFactoryId = m_flatBufferBuilder.CreateString(
+                PolymorphicDowncast<const armnn::OutputSlot*>(&outputSlot)->GetTensorHandleFactoryId());
+        }
+
         // Create FlatBuffer Outputslot
         outputSlots.push_back(serializer::CreateOutputSlot(m_flatBufferBuilder,
                                                            slotIndex,
-                                                           CreateTensorInfo(tensorInfo)));
+                                                           CreateTensorInfo(tensorInfo),
+                                                           tensorHandleFactoryId));
     }
     return outputSlots;
 }
@@ -1763,6 +1957,56 @@ void Serializer::Serialize(const INetwork& inNetwork)
     fbBuilder.Finish(serializedGraph);
 }
 
+void Serializer::SetConstantDataStream(std::ostream& stream, size_t minExternalBytes)
+{
+    m_SerializerVisitor.SetConstantDataStream(stream, minExternalBytes);
+}
+
+void Serializer::SetWeightCompression(unsigned int numBits, unsigned int blockSize)
+{
+    m_SerializerVisitor.SetWeightCompression(numBits, blockSize);
+}
+
+void Serializer::Serialize(const armnn::IOptimizedNetwork& optimizedNetwork, const std::string& networkKey)
+{
+    const armnn::Graph& graph = PolymorphicDowncast<const armnn::OptimizedNetwork*>(&optimizedNetwork)->GetGraph();
+
+    // Iterate through the optimized graph. The layers inserted by the optimizer can't be visited, while the other
+    // layers which never appear in an input network throw when they are.
+    m_SerializerVisitor.SetSerializeOptimizedProperties(true);
+    for (const armnn::Layer* layer : graph.TopologicalSort())
+    {
+        switch (layer->GetType())
+        {
+            case armnn::LayerType::MemCopy:
+            case armnn::LayerType::MemImport:
+            case armnn::LayerType::ConvertFp16ToFp32:
+            case armnn::LayerType::ConvertFp32ToFp16:
+            case armnn::LayerType::ConvertBf16ToFp32:
+            case armnn::LayerType::ConvertFp32ToBf16:
+            case armnn::LayerType::PreCompiled:
+                m_SerializerVisitor.VisitOptimizerLayer(layer);
+                break;
+            default:
+                layer->Accept(m_SerializerVisitor);
+                break;
+        }
+    }
+    flatbuffers::FlatBufferBuilder& fbBuilder = m_SerializerVisitor.GetFlatBufferBuilder();
+
+    // Create FlatBuffer SerializedGraph
+    auto serializedGraph = serializer::CreateSerializedGraph(
+        fbBuilder,
+        fbBuilder.CreateVector(m_SerializerVisitor.GetSerializedLayers()),
+        fbBuilder.CreateVector(m_SerializerVisitor.GetInputIds()),
+        fbBuilder.CreateVector(m_SerializerVisitor.GetOutputIds()),
+        m_SerializerVisitor.GetVersionTable(),
+        fbBuilder.CreateString(networkKey));
+
+    // Serialize the graph
+    fbBuilder.Finish(serializedGraph);
+}
+
 bool Serializer::SaveSerializedToStream(std::ostream& stream)
 {
     flatbuffers::FlatBufferBuilder& fbBuilder = m_SerializerVisitor.GetFlatBufferBuilder();
@@ -21,7 +21,15 @@ namespace armnnSerializer
 class SerializerVisitor : public armnn::ILayerVisitor
 {
 public:
-    SerializerVisitor() : m_layerId(0) {}
+    SerializerVisitor()
+        : m_layerId(0)
+        , m_SerializeOptimizedProperties(false)
+        , m_ConstantDataStream(nullptr)
+        , m_MinExternalBytes(0)
+        , m_ConstantDataPosition(0)
+        , m_WeightCompressionBits(0)
+        , m_WeightCompressionBlockSize(0)
+    {}
     ~SerializerVisitor() {}
 
     flatbuffers::FlatBufferBuilder& GetFlatBufferBuilder()
@@ -46,6 +54,29 @@ public:
 
     flatbuffers::Offset<armnnSerializer::FeatureCompatibilityVersions> GetVersionTable();
 
+    /// Records the backend, tensor handle strategies and fused activation of the layers visited, which are only set
+    /// in the graphs of optimized networks.
+    void SetSerializeOptimizedProperties(bool serializeOptimizedProperties)
+    {
+        m_SerializeOptimizedProperties = serializeOptimizedProperties;
+    }
+
+    /// Writes the data of the constant tensors of at least minExternalBytes bytes to a stream as they are visited,
+    /// after what the stream already holds.
+    void SetConstantDataStream(std::ostream& stream, size_t minExternalBytes);
+
+    /// Quantizes the Float32 weights of the layers visited to numBits bits in blocks of blockSize elements.
+    void SetWeightCompression(unsigned int numBits, unsigned int blockSize)
+    {
+        m_WeightCompressionBits = numBits;
+        m_WeightCompressionBlockSize = blockSize;
+    }
+
+    /// Serializes a layer only inserted by the optimizer, such as the compatibility layers copying tensors between
+    /// backends or the precompiled layers of the backends, which can't be visited as it never appears in an input
+    /// network.
+    void VisitOptimizerLayer(const armnn::IConnectableLayer* layer);
+
 
     ARMNN_DEPRECATED_MSG("Use VisitElementwiseUnaryLayer instead")
     void VisitAbsLayer(const armnn::IConnectableLayer* layer,
@@ -309,12 +340,19 @@ private:
     flatbuffers::Offset<armnnSerializer::ConstTensor> CreateConstTensorInfo(
             const armnn::ConstTensor& constTensor);
 
+    /// Creates the serializer ConstTensor for the weights of a layer, which are compressed if it is enabled.
+    flatbuffers::Offset<armnnSerializer::ConstTensor> CreateWeightsTensorInfo(
+            const armnn::ConstTensor& weights);
+
     /// Creates the serializer TensorInfo for the armnn TensorInfo.
     flatbuffers::Offset<TensorInfo>  CreateTensorInfo(const armnn::TensorInfo& tensorInfo);
 
     template <typename T>
     flatbuffers::Offset<flatbuffers::Vector<T>> CreateDataVector(const void* memory, unsigned int size);
 
+    /// Appends the data of a constant tensor to the constant data stream and creates the reference to it.
+    flatbuffers::Offset<armnnSerializer::ExternalData> CreateExternalData(const armnn::ConstTensor& constTensor);
+
     ///Function which maps Guid to an index
     uint32_t GetSerializedId(armnn::LayerGuid guid);
 
@@ -343,6 +381,24 @@ private:
 
     /// layer within our FlatBuffer index.
     uint32_t m_layerId;
+
+    /// Whether the properties set by the optimizer are recorded in the LayerBase of the layers.
+    bool m_SerializeOptimizedProperties;
+
+    /// Stream the data of the large constant tensors is written to, if any.
+    std::ostream* m_ConstantDataStream;
+
+    /// Size from which the data of a constant tensor is written to m_ConstantDataStream.
+    size_t m_MinExternalBytes;
+
+    /// Position of the end of the data written to m_ConstantDataStream, from the start of the stream.
+    uint64_t m_ConstantDataPosition;
+
+    /// Number of bits the weights are quantized to, or zero if they are serialized as they are.
+    unsigned int m_WeightCompressionBits;
+
+    /// Number of consecutive elements of the weights sharing a scale.
+    unsigned int m_WeightCompressionBlockSize;
 };
 
 class Serializer : public ISerializer
@@ -355,6 +411,18 @@ public:
     /// @param [in] inNetwork The network to be serialized.
     void Serialize(const armnn::INetwork& inNetwork) override;
 
+    void SetConstantDataStream(std::ostream& stream, size_t minExternalBytes) override;
+
+    void SetWeightCompression(unsigned int numBits, unsigned int blockSize) override;
+
+    /// Serializes an optimized network to ArmNN SerializedGraph, along with the backend assignment, compatibility
+    /// layers and tensor handle strategies chosen by the optimizer.
+    /// @param [in] optimizedNetwork The optimized network to be serialized.
+    /// @param [in] networkKey The key identifying the network in the optimized network cache.
+    /// @throws armnn::Exception if the network holds layers which can't be serialized, such as the precompiled
+    ///         layers of a backend which doesn't implement IBackendInternal::SerializePreCompiledObject().
+    void Serialize(const armnn::IOptimizedNetwork& optimizedNetwork, const std::string& networkKey);
+
     /// Serializes the SerializedGraph to the stream.
     /// @param [stream] the stream to save to
     /// @return true if graph is Serialized to the Stream, false otherwise
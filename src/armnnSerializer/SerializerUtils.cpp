@@ -198,4 +198,20 @@ armnnSerializer::ResizeMethod GetFlatBufferResizeMethod(armnn::ResizeMethod meth
     }
 }
 
+armnnSerializer::EdgeStrategy GetFlatBufferEdgeStrategy(armnn::EdgeStrategy edgeStrategy)
+{
+    switch (edgeStrategy)
+    {
+        case armnn::EdgeStrategy::DirectCompatibility:
+            return armnnSerializer::EdgeStrategy_DirectCompatibility;
+        case armnn::EdgeStrategy::ExportToTarget:
+            return armnnSerializer::EdgeStrategy_ExportToTarget;
+        case armnn::EdgeStrategy::CopyToTarget:
+            return armnnSerializer::EdgeStrategy_CopyToTarget;
+        case armnn::EdgeStrategy::Undefined:
+        default:
+            return armnnSerializer::EdgeStrategy_Undefined;
+    }
+}
+
 } // namespace armnnSerializer
@@ -5,6 +5,7 @@
 #pragma once
 
 #include <armnn/Types.hpp>
+#include <armnn/backends/ITensorHandleFactory.hpp>
 #include <ArmnnSchema_generated.h>
 
 namespace armnnSerializer
@@ -38,4 +39,6 @@ armnnSerializer::ResizeMethod GetFlatBufferResizeMethod(armnn::ResizeMethod meth
 armnnSerializer::LogicalBinaryOperation GetFlatBufferLogicalBinaryOperation(
     armnn::LogicalBinaryOperation logicalBinaryOperation);
 
+armnnSerializer::EdgeStrategy GetFlatBufferEdgeStrategy(armnn::EdgeStrategy edgeStrategy);
+
 } // namespace armnnSerializer
@@ -0,0 +1,207 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include <armnn/Descriptors.hpp>
+#include <armnn/INetwork.hpp>
+#include <armnn/IRuntime.hpp>
+#include <armnn/utility/PolymorphicDowncast.hpp>
+#include <armnnSerializer/OptimizedNetworkCache.hpp>
+
+#include <Filesystem.hpp>
+#include <Network.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(SerializerTests)
+
+namespace
+{
+
+fs::path CreateCacheDirectory(const char* name)
+{
+    fs::path directory = fs::temp_directory_path() / name;
+    fs::remove_all(directory);
+    fs::create_directories(directory);
+    return directory;
+}
+
+} // anonymous namespace
+
+BOOST_AUTO_TEST_CASE(OptimizedNetworkCacheStoresAndLoadsNetworks)
+{
+    const std::vector<armnn::BackendId> backends = { armnn::Compute::CpuRef };
+    const std::vector<uint8_t> modelContent = { 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+
+    armnn::OptimizerOptions options;
+    const std::string key = armnnSerializer::OptimizedNetworkCache::GetKey(modelContent.data(), modelContent.size(),
+                                                                           backends, options);
+
+    // The key depends on the model, the backends and the options
+    BOOST_TEST(key == armnnSerializer::OptimizedNetworkCache::GetKey(modelContent.data(), modelContent.size(),
+                                                                     backends, options));
+    BOOST_TEST(key != armnnSerializer::OptimizedNetworkCache::GetKey(modelContent.data(), modelContent.size() - 1,
+                                                                     backends, options));
+    BOOST_TEST(key != armnnSerializer::OptimizedNetworkCache::GetKey(modelContent.data(), modelContent.size(),
+                                                                     { armnn::Compute::CpuAcc }, options));
+    armnn::OptimizerOptions debugOptions;
+    debugOptions.m_Debug = true;
+    BOOST_TEST(key != armnnSerializer::OptimizedNetworkCache::GetKey(modelContent.data(), modelContent.size(),
+                                                                     backends, debugOptions));
+
+    fs::path directory = CreateCacheDirectory("Armnn-OptimizedNetworkCacheStoresAndLoadsNetworks");
+    armnnSerializer::OptimizedNetworkCache cache(directory.string());
+    BOOST_CHECK(!cache.Load(key));
+
+    armnn::TensorInfo info({ 1, 2, 2, 1 }, armnn::DataType::Float32);
+    armnn::INetworkPtr network = armnn::INetwork::Create();
+
+    armnn::ActivationDescriptor descriptor;
+    descriptor.m_Function = armnn::ActivationFunction::ReLu;
+
+    armnn::IConnectableLayer* const inputLayer      = network->AddInputLayer(0, "input");
+    armnn::IConnectableLayer* const activationLayer = network->AddActivationLayer(descriptor, "activation");
+    armnn::IConnectableLayer* const outputLayer     = network->AddOutputLayer(0, "output");
+
+    inputLayer->GetOutputSlot(0).Connect(activationLayer->GetInputSlot(0));
+    inputLayer->GetOutputSlot(0).SetTensorInfo(info);
+    activationLayer->GetOutputSlot(0).Connect(outputLayer->GetInputSlot(0));
+    activationLayer->GetOutputSlot(0).SetTensorInfo(info);
+
+    armnn::IRuntimePtr runtime = armnn::IRuntime::Create(armnn::IRuntime::CreationOptions());
+    armnn::IOptimizedNetworkPtr optimizedNetwork = armnn::Optimize(*network, backends, runtime->GetDeviceSpec(),
+                                                                   options);
+    BOOST_TEST(cache.Store(key, *optimizedNetwork));
+
+    // The network is written to a temporary file which is renamed to the entry
+    std::vector<fs::path> files{ fs::directory_iterator(directory), fs::directory_iterator() };
+    BOOST_TEST(files.size() == 1);
+    BOOST_TEST(files[0].filename().string() == key + ".armnn");
+
+    // The cached network is only found under its own key
+    BOOST_CHECK(!cache.Load(armnnSerializer::OptimizedNetworkCache::GetKey(modelContent.data(), modelContent.size(),
+                                                                          backends, debugOptions)));
+    armnn::IOptimizedNetworkPtr cachedNetwork = cache.Load(key);
+    BOOST_CHECK(cachedNetwork);
+
+    armnn::NetworkId networkId;
+    BOOST_TEST(runtime->LoadNetwork(networkId, std::move(cachedNetwork)) == armnn::Status::Success);
+
+    std::vector<float> inputData { 0.0f, -5.3f, 42.0f, -42.0f };
+    std::vector<float> outputData(4);
+    armnn::InputTensors inputTensors
+    {
+        { 0, armnn::ConstTensor(runtime->GetInputTensorInfo(networkId, 0), inputData.data()) }
+    };
+    armnn::OutputTensors outputTensors
+    {
+        { 0, armnn::Tensor(runtime->GetOutputTensorInfo(networkId, 0), outputData.data()) }
+    };
+    runtime->EnqueueWorkload(networkId, inputTensors, outputTensors);
+
+    std::vector<float> expectedOutputData { 0.0f, 0.0f, 42.0f, 0.0f };
+    BOOST_TEST(outputData == expectedOutputData, boost::test_tools::per_element());
+
+    fs::remove_all(directory);
+}
+
+BOOST_AUTO_TEST_CASE(OptimizedNetworkCacheKeysHoldDigestAndModelSize)
+{
+    const std::vector<armnn::BackendId> backends = { armnn::Compute::CpuRef };
+    std::vector<uint8_t> modelContent(64);
+    for (size_t i = 0; i < modelContent.size(); ++i)
+    {
+        modelContent[i] = static_cast<uint8_t>(i);
+    }
+    const std::string key = armnnSerializer::OptimizedNetworkCache::GetKey(modelContent.data(), modelContent.size(),
+                                                                           backends, armnn::OptimizerOptions());
+
+    // 64 hexadecimal digits of the SHA-256 digest, then the size of the model
+    BOOST_TEST(key.size() == 67u);
+    BOOST_TEST(key.find_first_not_of("0123456789abcdef") == 64u);
+    BOOST_TEST(key.substr(64) == "-64");
+
+    // Flipping the top bit of two words cancelled out in a word-wise hash
+    modelContent[7] ^= 0x80;
+    modelContent[15] ^= 0x80;
+    BOOST_TEST(key != armnnSerializer::OptimizedNetworkCache::GetKey(modelContent.data(), modelContent.size(),
+                                                                     backends, armnn::OptimizerOptions()));
+}
+
+BOOST_AUTO_TEST_CASE(OptimizedNetworkCacheStoresFusedElementwiseChains)
+{
+    const std::vector<armnn::BackendId> backends = { armnn::Compute::CpuRef };
+    const std::vector<uint8_t> modelContent = { 1, 2, 3 };
+    const std::string key = armnnSerializer::OptimizedNetworkCache::GetKey(modelContent.data(), modelContent.size(),
+                                                                           backends, armnn::OptimizerOptions());
+
+    armnn::TensorInfo info({ 1, 2, 2, 1 }, armnn::DataType::Float32);
+    armnn::INetworkPtr network = armnn::INetwork::Create();
+
+    armnn::ActivationDescriptor descriptor;
+    descriptor.m_Function = armnn::ActivationFunction::ReLu;
+
+    // The reference backend fuses the addition and the activation into a precompiled layer
+    armnn::IConnectableLayer* const input0Layer     = network->AddInputLayer(0, "input0");
+    armnn::IConnectableLayer* const input1Layer     = network->AddInputLayer(1, "input1");
+    armnn::IConnectableLayer* const additionLayer   = network->AddAdditionLayer("addition");
+    armnn::IConnectableLayer* const activationLayer = network->AddActivationLayer(descriptor, "activation");
+    armnn::IConnectableLayer* const outputLayer     = network->AddOutputLayer(0, "output");
+
+    input0Layer->GetOutputSlot(0).Connect(additionLayer->GetInputSlot(0));
+    input0Layer->GetOutputSlot(0).SetTensorInfo(info);
+    input1Layer->GetOutputSlot(0).Connect(additionLayer->GetInputSlot(1));
+    input1Layer->GetOutputSlot(0).SetTensorInfo(info);
+    additionLayer->GetOutputSlot(0).Connect(activationLayer->GetInputSlot(0));
+    additionLayer->GetOutputSlot(0).SetTensorInfo(info);
+    activationLayer->GetOutputSlot(0).Connect(outputLayer->GetInputSlot(0));
+    activationLayer->GetOutputSlot(0).SetTensorInfo(info);
+
+    armnn::IRuntimePtr runtime = armnn::IRuntime::Create(armnn::IRuntime::CreationOptions());
+    armnn::IOptimizedNetworkPtr optimizedNetwork = armnn::Optimize(*network, backends, runtime->GetDeviceSpec());
+
+    fs::path directory = CreateCacheDirectory("Armnn-OptimizedNetworkCacheStoresFusedElementwiseChains");
+    armnnSerializer::OptimizedNetworkCache cache(directory.string());
+    BOOST_TEST(cache.Store(key, *optimizedNetwork));
+
+    // The fused layer is restored with its program rather than the layers it replaced
+    armnn::IOptimizedNetworkPtr cachedNetwork = cache.Load(key);
+    BOOST_REQUIRE(cachedNetwork);
+    const armnn::Graph& graph = armnn::PolymorphicDowncast<armnn::OptimizedNetwork*>(cachedNetwork.get())->GetGraph();
+    BOOST_TEST(graph.GetNumLayers() == 4);
+    BOOST_TEST(std::any_of(graph.begin(), graph.end(), [](const armnn::Layer* layer)
+        {
+            return layer->GetType() == armnn::LayerType::PreCompiled &&
+                   std::string(layer->GetName()) == "fused-elementwise-activation" &&
+                   layer->GetBackendId() == armnn::Compute::CpuRef;
+        }));
+
+    armnn::NetworkId networkId;
+    BOOST_TEST(runtime->LoadNetwork(networkId, std::move(cachedNetwork)) == armnn::Status::Success);
+
+    std::vector<float> input0Data { 1.0f, -2.0f, 3.0f, -4.0f };
+    std::vector<float> input1Data { 1.0f, 1.0f, -5.0f, 5.0f };
+    std::vector<float> outputData(4);
+    armnn::InputTensors inputTensors
+    {
+        { 0, armnn::ConstTensor(runtime->GetInputTensorInfo(networkId, 0), input0Data.data()) },
+        { 1, armnn::ConstTensor(runtime->GetInputTensorInfo(networkId, 1), input1Data.data()) }
+    };
+    armnn::OutputTensors outputTensors
+    {
+        { 0, armnn::Tensor(runtime->GetOutputTensorInfo(networkId, 0), outputData.data()) }
+    };
+    runtime->EnqueueWorkload(networkId, inputTensors, outputTensors);
+
+    std::vector<float> expectedOutputData { 2.0f, 0.0f, 0.0f, 1.0f };
+    BOOST_TEST(outputData == expectedOutputData, boost::test_tools::per_element());
+
+    fs::remove_all(directory);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -12,6 +12,11 @@
 #include <armnn/QuantizedLstmParams.hpp>
 #include <armnnDeserializer/IDeserializer.hpp>
 
+#include <BlockQuantization.hpp>
+#include <Filesystem.hpp>
+
+#include <fstream>
+#include <map>
 #include <random>
 #include <vector>
 
@@ -300,6 +305,42 @@ BOOST_AUTO_TEST_CASE(SerializeAddition)
     deserializedNetwork->Accept(verifier);
 }
 
+BOOST_AUTO_TEST_CASE(DeserializeNetworkFromBinaryFile)
+{
+    DECLARE_LAYER_VERIFIER_CLASS(Addition)
+
+    const std::string layerName("addition");
+    const armnn::TensorInfo tensorInfo({1, 2, 3}, armnn::DataType::Float32);
+
+    armnn::INetworkPtr network = armnn::INetwork::Create();
+    armnn::IConnectableLayer* const inputLayer0 = network->AddInputLayer(0);
+    armnn::IConnectableLayer* const inputLayer1 = network->AddInputLayer(1);
+    armnn::IConnectableLayer* const additionLayer = network->AddAdditionLayer(layerName.c_str());
+    armnn::IConnectableLayer* const outputLayer = network->AddOutputLayer(0);
+
+    inputLayer0->GetOutputSlot(0).Connect(additionLayer->GetInputSlot(0));
+    inputLayer1->GetOutputSlot(0).Connect(additionLayer->GetInputSlot(1));
+    additionLayer->GetOutputSlot(0).Connect(outputLayer->GetInputSlot(0));
+
+    inputLayer0->GetOutputSlot(0).SetTensorInfo(tensorInfo);
+    inputLayer1->GetOutputSlot(0).SetTensorInfo(tensorInfo);
+    additionLayer->GetOutputSlot(0).SetTensorInfo(tensorInfo);
+
+    fs::path fileName = armnnUtils::Filesystem::NamedTempFile("Armnn-DeserializeNetworkFromBinaryFile.armnn");
+    {
+        std::ofstream file(fileName.string(), std::ios::binary);
+        file << SerializeNetwork(*network);
+    }
+
+    armnn::INetworkPtr deserializedNetwork =
+        IDeserializer::Create()->CreateNetworkFromBinaryFile(fileName.string().c_str());
+    BOOST_CHECK(deserializedNetwork);
+    fs::remove(fileName);
+
+    AdditionLayerVerifier verifier(layerName, {tensorInfo, tensorInfo}, {tensorInfo});
+    deserializedNetwork->Accept(verifier);
+}
+
 BOOST_AUTO_TEST_CASE(SerializeArgMinMax)
 {
     DECLARE_LAYER_VERIFIER_CLASS_WITH_DESCRIPTOR(ArgMinMax)
@@ -535,6 +576,83 @@ BOOST_AUTO_TEST_CASE(SerializeConstant)
     deserializedNetwork->Accept(verifier);
 }
 
+BOOST_AUTO_TEST_CASE(SerializeConstantToConstantDataFile)
+{
+    class ConstantLayerVerifier : public LayerVerifierBase
+    {
+    public:
+        ConstantLayerVerifier(const std::map<std::string, armnn::ConstTensor>& layerInputs)
+            : LayerVerifierBase("", {}, {})
+            , m_LayerInputs(layerInputs) {}
+
+        void VisitConstantLayer(const armnn::IConnectableLayer*,
+                                const armnn::ConstTensor& input,
+                                const char* name) override
+        {
+            auto layerInput = m_LayerInputs.find(name);
+            BOOST_TEST((layerInput != m_LayerInputs.end()));
+            CompareConstTensor(input, layerInput->second);
+        }
+
+        void VisitAdditionLayer(const armnn::IConnectableLayer*, const char*) override {}
+
+    private:
+        std::map<std::string, armnn::ConstTensor> m_LayerInputs;
+    };
+
+    // The data of the large constant is written to the constant data file, the data of the small one to the graph
+    const armnn::TensorInfo largeInfo({ 16, 16 }, armnn::DataType::Float32);
+    const armnn::TensorInfo smallInfo({ 1, 16 }, armnn::DataType::Float32);
+
+    std::vector<float> largeData = GenerateRandomData<float>(largeInfo.GetNumElements());
+    std::vector<float> smallData = GenerateRandomData<float>(smallInfo.GetNumElements());
+    armnn::ConstTensor largeTensor(largeInfo, largeData);
+    armnn::ConstTensor smallTensor(smallInfo, smallData);
+
+    armnn::INetworkPtr network(armnn::INetwork::Create());
+    armnn::IConnectableLayer* largeConstant = network->AddConstantLayer(largeTensor, "large");
+    armnn::IConnectableLayer* smallConstant = network->AddConstantLayer(smallTensor, "small");
+    armnn::IConnectableLayer* add = network->AddAdditionLayer();
+    armnn::IConnectableLayer* output = network->AddOutputLayer(0);
+
+    largeConstant->GetOutputSlot(0).Connect(add->GetInputSlot(0));
+    smallConstant->GetOutputSlot(0).Connect(add->GetInputSlot(1));
+    add->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+
+    largeConstant->GetOutputSlot(0).SetTensorInfo(largeInfo);
+    smallConstant->GetOutputSlot(0).SetTensorInfo(smallInfo);
+    add->GetOutputSlot(0).SetTensorInfo(largeInfo);
+
+    fs::path graphFileName = armnnUtils::Filesystem::NamedTempFile("Armnn-SerializeConstantToConstantDataFile.armnn");
+    fs::path dataFileName = armnnUtils::Filesystem::NamedTempFile("Armnn-SerializeConstantToConstantDataFile.data");
+    {
+        // The data is written after what the stream already holds, aligned from the start of the stream
+        std::ofstream dataFile(dataFileName.string(), std::ios::binary);
+        dataFile << "ArmNN";
+        armnnSerializer::Serializer serializer;
+        serializer.SetConstantDataStream(dataFile, 1024);
+        serializer.Serialize(*network);
+
+        std::ofstream graphFile(graphFileName.string(), std::ios::binary);
+        BOOST_TEST(serializer.SaveSerializedToStream(graphFile));
+    }
+    BOOST_TEST(fs::file_size(dataFileName) ==
+               armnnSerializer::ISerializer::ConstantDataAlignment + largeTensor.GetNumBytes());
+
+    // The graph can't be deserialized without the data of its constants
+    BOOST_CHECK_THROW(IDeserializer::Create()->CreateNetworkFromBinaryFile(graphFileName.string().c_str()),
+                      armnn::ParseException);
+
+    armnn::INetworkPtr deserializedNetwork = IDeserializer::Create()->CreateNetworkFromBinaryFile(
+        graphFileName.string().c_str(), dataFileName.string().c_str());
+    BOOST_CHECK(deserializedNetwork);
+    fs::remove(graphFileName);
+    fs::remove(dataFileName);
+
+    ConstantLayerVerifier verifier({ { "large", largeTensor }, { "small", smallTensor } });
+    deserializedNetwork->Accept(verifier);
+}
+
 BOOST_AUTO_TEST_CASE(SerializeConvolution2d)
 {
     using Descriptor = armnn::Convolution2dDescriptor;
@@ -1331,6 +1449,99 @@ BOOST_AUTO_TEST_CASE(SerializeFullyConnected)
     deserializedNetwork->Accept(verifier);
 }
 
+BOOST_AUTO_TEST_CASE(SerializeFullyConnectedWithWeightCompression)
+{
+    using Descriptor = armnn::FullyConnectedDescriptor;
+    class FullyConnectedLayerVerifier : public LayerVerifierBaseWithDescriptor<Descriptor>
+    {
+    public:
+        FullyConnectedLayerVerifier(const std::string& layerName,
+                                    const std::vector<armnn::TensorInfo>& inputInfos,
+                                    const std::vector<armnn::TensorInfo>& outputInfos,
+                                    const Descriptor& descriptor,
+                                    const armnn::ConstTensor& weight,
+                                    const armnn::Optional<armnn::ConstTensor>& bias)
+            : LayerVerifierBaseWithDescriptor<Descriptor>(layerName, inputInfos, outputInfos, descriptor)
+            , m_Weight(weight)
+            , m_Bias(bias) {}
+
+        void VisitFullyConnectedLayer(const armnn::IConnectableLayer* layer,
+                                      const Descriptor& descriptor,
+                                      const armnn::ConstTensor& weight,
+                                      const armnn::Optional<armnn::ConstTensor>& bias,
+                                      const char* name) override
+        {
+            VerifyNameAndConnections(layer, name);
+            VerifyDescriptor(descriptor);
+
+            CompareConstTensor(weight, m_Weight);
+
+            BOOST_TEST(bias.has_value() == descriptor.m_BiasEnabled);
+            BOOST_TEST(bias.has_value() == m_Bias.has_value());
+
+            if (bias.has_value() && m_Bias.has_value())
+            {
+                CompareConstTensor(bias.value(), m_Bias.value());
+            }
+        }
+
+    private:
+        armnn::ConstTensor m_Weight;
+        armnn::Optional<armnn::ConstTensor> m_Bias;
+    };
+
+    const std::string layerName("fullyConnected");
+    const armnn::TensorInfo inputInfo ({ 2, 5, 1, 1 }, armnn::DataType::Float32);
+    const armnn::TensorInfo outputInfo({ 2, 3 }, armnn::DataType::Float32);
+
+    const armnn::TensorInfo weightsInfo({ 5, 3 }, armnn::DataType::Float32);
+    const armnn::TensorInfo biasesInfo ({ 3 }, armnn::DataType::Float32);
+    std::vector<float> weightsData = GenerateRandomData<float>(weightsInfo.GetNumElements());
+    std::vector<float> biasesData  = GenerateRandomData<float>(biasesInfo.GetNumElements());
+    armnn::ConstTensor weights(weightsInfo, weightsData);
+    armnn::ConstTensor biases(biasesInfo, biasesData);
+
+    armnn::FullyConnectedDescriptor descriptor;
+    descriptor.m_BiasEnabled = true;
+    descriptor.m_TransposeWeightMatrix = false;
+
+    armnn::INetworkPtr network = armnn::INetwork::Create();
+    armnn::IConnectableLayer* const inputLayer = network->AddInputLayer(0);
+    armnn::IConnectableLayer* const fullyConnectedLayer =
+        network->AddFullyConnectedLayer(descriptor,
+                                        weights,
+                                        armnn::Optional<armnn::ConstTensor>(biases),
+                                        layerName.c_str());
+    armnn::IConnectableLayer* const outputLayer = network->AddOutputLayer(0);
+
+    inputLayer->GetOutputSlot(0).Connect(fullyConnectedLayer->GetInputSlot(0));
+    fullyConnectedLayer->GetOutputSlot(0).Connect(outputLayer->GetInputSlot(0));
+
+    inputLayer->GetOutputSlot(0).SetTensorInfo(inputInfo);
+    fullyConnectedLayer->GetOutputSlot(0).SetTensorInfo(outputInfo);
+
+    armnnSerializer::Serializer serializer;
+    serializer.SetWeightCompression(4, 4);
+    serializer.Serialize(*network);
+    std::stringstream stream;
+    serializer.SaveSerializedToStream(stream);
+
+    armnn::INetworkPtr deserializedNetwork = DeserializeNetwork(stream.str());
+    BOOST_CHECK(deserializedNetwork);
+
+    // The weights are expanded from their 4-bit quantized values, while the biases are kept as they are
+    armnnUtils::BlockQuantizedValues quantizedWeights =
+        armnnUtils::BlockQuantize(weightsData.data(), weightsData.size(), 4, 4);
+    std::vector<float> expandedWeightsData(weightsData.size());
+    armnnUtils::BlockDequantize(quantizedWeights.m_Data.data(), quantizedWeights.m_Data.size(),
+                                quantizedWeights.m_Scales.data(), quantizedWeights.m_Scales.size(),
+                                4, 4, expandedWeightsData.size(), expandedWeightsData.data());
+    armnn::ConstTensor expandedWeights(weightsInfo, expandedWeightsData);
+
+    FullyConnectedLayerVerifier verifier(layerName, {inputInfo}, {outputInfo}, descriptor, expandedWeights, biases);
+    deserializedNetwork->Accept(verifier);
+}
+
 BOOST_AUTO_TEST_CASE(SerializeGather)
 {
     using GatherDescriptor = armnn::GatherDescriptor;
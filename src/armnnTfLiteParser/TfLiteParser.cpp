@@ -18,6 +18,7 @@
 // armnnUtils:
 #include <armnnUtils/Permute.hpp>
 #include <Filesystem.hpp>
+#include <MemoryMappedFile.hpp>
 
 #include <ParserHelper.hpp>
 #include <VerificationHelpers.hpp>
@@ -198,23 +199,16 @@ void CheckBuffer(const TfLiteParser::ModelPtr & model,
 #define CHECK_BUFFER(MODEL, BUFFER_INDEX) \
     CheckBuffer(MODEL, BUFFER_INDEX, CHECK_LOCATION())
 
-void CheckBufferSize(TfLiteParser::BufferRawPtr bufferPtr,
+void CheckBufferSize(const TfLiteParser::BufferView& buffer,
                      const armnn::TensorInfo & tensorInfo,
                      uint32_t bufferId,
                      const CheckLocation & location)
 {
-    if (bufferPtr == nullptr)
-    {
-        throw ParseException(
-            fmt::format("BufferPtr is null for buffer:{}. {}",
-                        bufferId,
-                        location.AsString()));
-    }
-    else if(tensorInfo.GetNumElements() > bufferPtr->data.size() ||
-            tensorInfo.GetNumBytes() > bufferPtr->data.size())
+    if(tensorInfo.GetNumElements() > buffer.m_Size ||
+       tensorInfo.GetNumBytes() > buffer.m_Size)
     {
         std::stringstream ss;
-        ss << "Buffer #" << bufferId << " has " << bufferPtr->data.size() << " bytes. "
+        ss << "Buffer #" << bufferId << " has " << buffer.m_Size << " bytes. "
            << "For tensor: " << tensorInfo.GetShape()
            << " expecting: " << tensorInfo.GetNumBytes() << " bytes and "
            << tensorInfo.GetNumElements() << " elements. " << location.AsString();
@@ -222,8 +216,8 @@ void CheckBufferSize(TfLiteParser::BufferRawPtr bufferPtr,
     }
 }
 
-#define CHECK_BUFFER_SIZE(BUFFER_PTR, TENSOR_INFO, BUFFER_ID) \
-    CheckBufferSize(BUFFER_PTR, TENSOR_INFO, BUFFER_ID, CHECK_LOCATION())
+#define CHECK_BUFFER_SIZE(BUFFER, TENSOR_INFO, BUFFER_ID) \
+    CheckBufferSize(BUFFER, TENSOR_INFO, BUFFER_ID, CHECK_LOCATION())
 
 bool IsActivationSupported(tflite::ActivationFunctionType activationType)
 {
@@ -445,30 +439,25 @@ armnn::TensorInfo ToTensorInfo(TfLiteParser::TensorRawPtr tensorPtr,
 
 template<typename T>
 std::pair<armnn::ConstTensor, std::unique_ptr<T[]>>
-CreateConstTensorImpl(TfLiteParser::BufferRawPtr bufferPtr,
+CreateConstTensorImpl(const TfLiteParser::BufferView& buffer,
                       TfLiteParser::TensorRawPtr tensorPtr,
                       armnn::TensorInfo& tensorInfo,
                       armnn::Optional<armnn::PermutationVector&> permutationVector)
 {
     IgnoreUnused(tensorPtr);
     ARMNN_ASSERT_MSG(tensorPtr != nullptr, "tensorPtr is null");
-    ARMNN_ASSERT_MSG(bufferPtr != nullptr,
-        fmt::format("Buffer for buffer:{} is null", tensorPtr->buffer).c_str());
-
-    std::unique_ptr<T[]> data(new T[tensorInfo.GetNumElements()]);
 
     if (permutationVector.has_value() && permutationVector.value().GetSize() > 0)
     {
+        std::unique_ptr<T[]> data(new T[tensorInfo.GetNumElements()]);
         tensorInfo = armnnUtils::Permuted(tensorInfo, permutationVector.value());
         armnnUtils::Permute(tensorInfo.GetShape(), permutationVector.value(),
-                            reinterpret_cast<const T*>(bufferPtr->data.data()), data.get(), sizeof(T));
-    }
-    else
-    {
-        ::memcpy(data.get(), bufferPtr->data.data(), tensorInfo.GetNumBytes());
+                            reinterpret_cast<const T*>(buffer.m_Data), data.get(), sizeof(T));
+        return std::make_pair(ConstTensor(tensorInfo, data.get()), std::move(data));
     }
 
-    return std::make_pair(ConstTensor(tensorInfo, data.get()), std::move(data));
+    // The layer the tensor is given to copies its content, so it is read from the flatbuffer in place
+    return std::make_pair(ConstTensor(tensorInfo, buffer.m_Data), std::unique_ptr<T[]>());
 }
 
 armnn::LayerBindingId GenerateLayerBindingId(size_t subgraphIndex, size_t tensorIndex)
@@ -591,21 +580,30 @@ void TfLiteParser::ResetParser()
 {
     m_Network = armnn::INetworkPtr(nullptr, nullptr);
     m_Model = nullptr;
+    m_BufferViews.clear();
     m_SubgraphConnections.clear();
 }
 
 INetworkPtr TfLiteParser::CreateNetworkFromBinaryFile(const char* graphFile)
 {
     ResetParser();
-    m_Model = LoadModelFromFile(graphFile);
-    return CreateNetworkFromModel();
+    CheckModelFileExists(graphFile);
+
+    // The buffers of the model are read from the pages of the file, which are only mapped while the network is created
+    armnnUtils::MemoryMappedFile file(graphFile);
+    LoadModelStructure(file.GetData(), file.GetSize());
+    INetworkPtr network = CreateNetworkFromModel();
+    m_BufferViews.clear();
+    return network;
 }
 
 INetworkPtr TfLiteParser::CreateNetworkFromBinary(const std::vector<uint8_t> & binaryContent)
 {
     ResetParser();
-    m_Model = LoadModelFromBinary(binaryContent.data(), binaryContent.size());
-    return CreateNetworkFromModel();
+    LoadModelStructure(binaryContent.data(), binaryContent.size());
+    INetworkPtr network = CreateNetworkFromModel();
+    m_BufferViews.clear();
+    return network;
 }
 
 INetworkPtr TfLiteParser::CreateNetworkFromModel()
@@ -1044,10 +1042,10 @@ void TfLiteParser::ParseTranspose(size_t subgraphIndex, size_t operatorIndex)
     if (inputs.size() == 2)
     {
         armnn::TensorInfo permuteTensorInfo = ToTensorInfo(inputs[1]);
-        BufferRawPtr permuteBufferPtr = GetBuffer(m_Model, inputs[1]->buffer);
+        BufferView permuteBuffer = GetBufferView(inputs[1]->buffer);
         auto numPermVecElements = permuteTensorInfo.GetNumElements();
         std::vector<unsigned int> permuteShape(numPermVecElements);
-        ::memcpy(permuteShape.data(), permuteBufferPtr->data.data(), permuteTensorInfo.GetNumBytes());
+        ::memcpy(permuteShape.data(), permuteBuffer.m_Data, permuteTensorInfo.GetNumBytes());
         PermutationVector permutationVector(permuteShape.data(), permuteTensorInfo.GetNumElements());
 
         desc = TransposeDescriptor(permutationVector);
@@ -1093,13 +1091,13 @@ void TfLiteParser::ParseTransposeConv(size_t subgraphIndex, size_t operatorIndex
         std::vector<int> output_shape(tensorInfo.GetNumElements());
         if (tensorInfo.GetDataType() == DataType::Signed32)
         {
-            ::memcpy(output_shape.data(), GetBuffer(m_Model, inputs[0]->buffer)->data.data(), tensorInfo.GetNumBytes());
+            ::memcpy(output_shape.data(), GetBufferView(inputs[0]->buffer).m_Data, tensorInfo.GetNumBytes());
         }
         if (tensorInfo.GetDataType() == DataType::QAsymmU8)
         {
             for(unsigned int i=0; i < tensorInfo.GetNumElements(); i++)
             {
-                output_shape[i] = GetBuffer(m_Model, inputs[0]->buffer)->data.data()[i];
+                output_shape[i] = GetBufferView(inputs[0]->buffer).m_Data[i];
             }
         }
         // Change from signed to unsigned int to store in TransposeConvolution2dDescriptor.
@@ -1176,16 +1174,16 @@ void TfLiteParser::ParseBatchToSpaceND(size_t subgraphIndex, size_t operatorInde
     CHECK_VALID_SIZE(outputs.size(), 1);
 
     armnn::TensorInfo blockShapeTensorInfo = ToTensorInfo(inputs[1]);
-    BufferRawPtr blockShapeBufferPtr = GetBuffer(m_Model, inputs[1]->buffer);
+    BufferView blockShapeBuffer = GetBufferView(inputs[1]->buffer);
 
     armnn::TensorInfo cropsTensorInfo = ToTensorInfo(inputs[2]);
-    BufferRawPtr cropsBufferPtr = GetBuffer(m_Model, inputs[2]->buffer);
+    BufferView cropsBuffer = GetBufferView(inputs[2]->buffer);
 
     std::vector<unsigned int> blockShape(blockShapeTensorInfo.GetNumElements());
-    ::memcpy(blockShape.data(), blockShapeBufferPtr->data.data(), blockShapeTensorInfo.GetNumBytes());
+    ::memcpy(blockShape.data(), blockShapeBuffer.m_Data, blockShapeTensorInfo.GetNumBytes());
 
     std::vector<unsigned int> cropsVector(cropsTensorInfo.GetNumElements());
-    ::memcpy(cropsVector.data(), cropsBufferPtr->data.data(), cropsTensorInfo.GetNumBytes());
+    ::memcpy(cropsVector.data(), cropsBuffer.m_Data, cropsTensorInfo.GetNumBytes());
 
     size_t step = 2;
     std::vector<std::pair<unsigned int, unsigned int>> crops;
@@ -1393,17 +1391,17 @@ void TfLiteParser::ParseSlice(size_t subgraphIndex, size_t operatorIndex)
 
     // set begin tensor info for slice descriptor
     armnn::TensorInfo beginTensorInfo = ToTensorInfo(inputs[1]);
-    BufferRawPtr beginBufferPtr = GetBuffer(m_Model, inputs[1]->buffer);
+    BufferView beginBuffer = GetBufferView(inputs[1]->buffer);
 
     std::vector<unsigned int> begin(beginTensorInfo.GetNumElements());
-    ::memcpy(begin.data(), beginBufferPtr->data.data(), beginTensorInfo.GetNumBytes());
+    ::memcpy(begin.data(), beginBuffer.m_Data, beginTensorInfo.GetNumBytes());
 
     // set size tensor info for slice descriptor
     armnn::TensorInfo sizeTensorInfo = ToTensorInfo(inputs[2]);
-    BufferRawPtr sizeBufferPtr = GetBuffer(m_Model, inputs[2]->buffer);
+    BufferView sizeBuffer = GetBufferView(inputs[2]->buffer);
 
     std::vector<unsigned int> size(sizeTensorInfo.GetNumElements());
-    ::memcpy(size.data(), sizeBufferPtr->data.data(), sizeTensorInfo.GetNumBytes());
+    ::memcpy(size.data(), sizeBuffer.m_Data, sizeTensorInfo.GetNumBytes());
     desc = SliceDescriptor(begin, size);
 
     auto layerName = fmt::format("Slice:{}:{}", subgraphIndex, operatorIndex);
@@ -1466,16 +1464,16 @@ void TfLiteParser::ParseSpaceToBatchND(size_t subgraphIndex, size_t operatorInde
     CHECK_VALID_SIZE(outputs.size(), 1);
 
     armnn::TensorInfo blockShapeTensorInfo = ToTensorInfo(inputs[1]);
-    BufferRawPtr blockShapeBufferPtr = GetBuffer(m_Model, inputs[1]->buffer);
+    BufferView blockShapeBuffer = GetBufferView(inputs[1]->buffer);
 
     armnn::TensorInfo padListTensorInfo = ToTensorInfo(inputs[2]);
-    BufferRawPtr padListBufferPtr = GetBuffer(m_Model, inputs[2]->buffer);
+    BufferView padListBuffer = GetBufferView(inputs[2]->buffer);
 
     std::vector<unsigned int> blockShape(blockShapeTensorInfo.GetNumElements());
-    ::memcpy(blockShape.data(), blockShapeBufferPtr->data.data(), blockShapeTensorInfo.GetNumBytes());
+    ::memcpy(blockShape.data(), blockShapeBuffer.m_Data, blockShapeTensorInfo.GetNumBytes());
 
     std::vector<unsigned int> padListVector(padListTensorInfo.GetNumElements());
-    ::memcpy(padListVector.data(), padListBufferPtr->data.data(), padListTensorInfo.GetNumBytes());
+    ::memcpy(padListVector.data(), padListBuffer.m_Data, padListTensorInfo.GetNumBytes());
 
     size_t step = 2;
     std::vector<std::pair<unsigned int, unsigned int>> padList;
@@ -1614,22 +1612,22 @@ void TfLiteParser::ParseStridedSlice(size_t subgraphIndex, size_t operatorIndex)
     desc.m_DataLayout = armnn::DataLayout::NHWC;
 
     armnn::TensorInfo beginTensorInfo = ToTensorInfo(inputs[1]);
-    BufferRawPtr beginBufferPtr = GetBuffer(m_Model, inputs[1]->buffer);
+    BufferView beginBuffer = GetBufferView(inputs[1]->buffer);
 
     std::vector<int> begin(beginTensorInfo.GetNumElements());
-    ::memcpy(begin.data(), beginBufferPtr->data.data(), beginTensorInfo.GetNumBytes());
+    ::memcpy(begin.data(), beginBuffer.m_Data, beginTensorInfo.GetNumBytes());
 
     armnn::TensorInfo endTensorInfo = ToTensorInfo(inputs[2]);
-    BufferRawPtr endBufferPtr = GetBuffer(m_Model, inputs[2]->buffer);
+    BufferView endBuffer = GetBufferView(inputs[2]->buffer);
 
     std::vector<int> end(endTensorInfo.GetNumElements());
-    ::memcpy(end.data(), endBufferPtr->data.data(), endTensorInfo.GetNumBytes());
+    ::memcpy(end.data(), endBuffer.m_Data, endTensorInfo.GetNumBytes());
 
     armnn::TensorInfo strideTensorInfo = ToTensorInfo(inputs[3]);
-    BufferRawPtr strideBufferPtr = GetBuffer(m_Model, inputs[3]->buffer);
+    BufferView strideBuffer = GetBufferView(inputs[3]->buffer);
 
     std::vector<int> stride(strideTensorInfo.GetNumElements());
-    ::memcpy(stride.data(), strideBufferPtr->data.data(), strideTensorInfo.GetNumBytes());
+    ::memcpy(stride.data(), strideBuffer.m_Data, strideTensorInfo.GetNumBytes());
 
     desc.m_Begin = begin;
     desc.m_End = end;
@@ -1784,11 +1782,11 @@ void TfLiteParser::ParseMean(size_t subgraphIndex, size_t operatorIndex)
     CHECK_VALID_SIZE(outputs.size(), 1);
 
     armnn::TensorInfo dimTensorInfo = ToTensorInfo(inputs[1]);
-    BufferRawPtr bufferPtr = GetBuffer(m_Model, inputs[1]->buffer);
+    BufferView dimBuffer = GetBufferView(inputs[1]->buffer);
 
     armnn::MeanDescriptor desc;
     std::vector<unsigned int> axis(dimTensorInfo.GetNumElements());
-    ::memcpy(axis.data(), bufferPtr->data.data(), dimTensorInfo.GetNumBytes());
+    ::memcpy(axis.data(), dimBuffer.m_Data, dimTensorInfo.GetNumBytes());
     desc.m_Axis = axis;
 
     armnn::TensorInfo inputTensorInfo  = ToTensorInfo(inputs[0]);
@@ -1846,10 +1844,10 @@ void TfLiteParser::ParsePad(size_t subgraphIndex, size_t operatorIndex)
     CHECK_VALID_SIZE(outputs.size(), 1);
 
     armnn::TensorInfo padTensorInfo = ToTensorInfo(inputs[1]);
-    BufferRawPtr bufferPtr = GetBuffer(m_Model, inputs[1]->buffer);
+    BufferView padListBuffer = GetBufferView(inputs[1]->buffer);
 
     std::vector<unsigned int> padBuffer(padTensorInfo.GetNumElements());
-    ::memcpy(padBuffer.data(), bufferPtr->data.data(), padTensorInfo.GetNumBytes());
+    ::memcpy(padBuffer.data(), padListBuffer.m_Data, padTensorInfo.GetNumBytes());
 
     size_t step = 2;
     armnn::PadDescriptor desc;
@@ -2087,8 +2085,8 @@ void TfLiteParser::ParseReshape(size_t subgraphIndex, size_t operatorIndex)
             }
 
             // Extract target shape from input
-            auto bufferPtr = GetBuffer(m_Model, inputs[1]->buffer);
-            auto values = reinterpret_cast<const int32_t*>(bufferPtr->data.data());
+            BufferView shapeBuffer = GetBufferView(inputs[1]->buffer);
+            auto values = reinterpret_cast<const int32_t*>(shapeBuffer.m_Data);
             for (int i=0; i < inputs[1]->shape[0]; ++i)
             {
                 targetShape.push_back(values[i]);
@@ -2157,8 +2155,8 @@ void TfLiteParser::ParseResize(size_t subgraphIndex, size_t operatorIndex, Resiz
     // Data for the parsed tensor args (size) must be stored locally.
     std::vector<int32_t> sizeTensorData(sizeTensorInfo.GetNumElements());
 
-    BufferRawPtr sizeBufferPtr = GetBuffer(m_Model, inputs[1]->buffer);
-    ::memcpy(sizeTensorData.data(), sizeBufferPtr->data.data(), sizeTensorInfo.GetNumBytes());
+    BufferView sizeBuffer = GetBufferView(inputs[1]->buffer);
+    ::memcpy(sizeTensorData.data(), sizeBuffer.m_Data, sizeTensorInfo.GetNumBytes());
 
     ResizeDescriptor desc;
     desc.m_Method       = resizeMethod;
@@ -2612,9 +2610,9 @@ void TfLiteParser::ParseSplit(size_t subgraphIndex, size_t operatorIndex)
     armnn::TensorInfo inputTensorInfo  = ToTensorInfo(inputs[1]);
     armnn::TensorInfo axisTensorInfo = ToTensorInfo(inputs[0]);
 
-    BufferRawPtr axisBufferPtr = GetBuffer(m_Model, inputs[0]->buffer);
+    BufferView axisBuffer = GetBufferView(inputs[0]->buffer);
     std::vector<unsigned int> axisData(axisTensorInfo.GetNumElements());
-    ::memcpy(axisData.data(), axisBufferPtr->data.data(), axisTensorInfo.GetNumBytes());
+    ::memcpy(axisData.data(), axisBuffer.m_Data, axisTensorInfo.GetNumBytes());
 
     ARMNN_ASSERT(axisTensorInfo.GetNumElements() == 1);
     const unsigned int splitDim = axisData[0];
@@ -2713,9 +2711,9 @@ void TfLiteParser::ParseSplitV(size_t subgraphIndex, size_t operatorIndex)
     }
 
     // Get split axis
-    BufferRawPtr axisBufferPtr = GetBuffer(m_Model, axisTensor->buffer);
+    BufferView axisBuffer = GetBufferView(axisTensor->buffer);
     std::vector<int> axisData(axisTensorInfo.GetNumElements());
-    ::memcpy(axisData.data(), axisBufferPtr->data.data(), axisTensorInfo.GetNumBytes());
+    ::memcpy(axisData.data(), axisBuffer.m_Data, axisTensorInfo.GetNumBytes());
     const unsigned int splitDim = ComputeWrappedIndex(axisData[0], inputTensorInfo.GetNumDimensions());
 
     // Set split sizes
@@ -2737,8 +2735,8 @@ void TfLiteParser::ParseSplitV(size_t subgraphIndex, size_t operatorIndex)
     }
 
     std::vector<int> splitsData(numSplits);
-    BufferRawPtr splitsBufferPtr = GetBuffer(m_Model, splitsTensor->buffer);
-    ::memcpy(splitsData.data(), splitsBufferPtr->data.data(), splitsInfo.GetNumBytes());
+    BufferView splitsBuffer = GetBufferView(splitsTensor->buffer);
+    ::memcpy(splitsData.data(), splitsBuffer.m_Data, splitsInfo.GetNumBytes());
 
     unsigned int idx = 0;
     int numInferred{0};
@@ -2835,10 +2833,10 @@ void TfLiteParser::ParseArgMax(size_t subgraphIndex, size_t operatorIndex)
     armnn::TensorInfo sizeTensorInfo1 = ToTensorInfo(inputs[1]);
 
     // Get const axis value from model and set it to descriptor.
-    BufferRawPtr axisBufferPtr = GetBuffer(m_Model, inputs[1]->buffer);
+    BufferView axisBuffer = GetBufferView(inputs[1]->buffer);
 
     ArgMinMaxDescriptor desc;
-    desc.m_Axis = axisBufferPtr->data.data()[0];
+    desc.m_Axis = axisBuffer.m_Data[0];
     // If output_type is int32 then set Signed32 else Signed64. Default type is Signed64.
     desc.m_Output_Type = options->output_type == 3 ? armnn::DataType::Signed32 : armnn::DataType::Signed64;
     desc.m_Function = ArgMinMaxFunction::Max;
@@ -2919,7 +2917,7 @@ armnn::IConnectableLayer* TfLiteParser::AddFusedActivationLayer(armnn::IConnecta
     return activationLayer;
 }
 
-TfLiteParser::ModelPtr TfLiteParser::LoadModelFromFile(const char * fileName)
+void TfLiteParser::CheckModelFileExists(const char * fileName)
 {
     if (fileName == nullptr)
     {
@@ -2937,13 +2935,16 @@ TfLiteParser::ModelPtr TfLiteParser::LoadModelFromFile(const char * fileName)
 
         throw FileNotFoundException(msg.str());
     }
-    std::ifstream file(fileName, std::ios::binary);
-    std::string fileContent((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
-    return LoadModelFromBinary(reinterpret_cast<const uint8_t *>(fileContent.c_str()),
-                               fileContent.size());
 }
 
-TfLiteParser::ModelPtr TfLiteParser::LoadModelFromBinary(const uint8_t * binaryContent, size_t len)
+TfLiteParser::ModelPtr TfLiteParser::LoadModelFromFile(const char * fileName)
+{
+    CheckModelFileExists(fileName);
+    armnnUtils::MemoryMappedFile file(fileName);
+    return LoadModelFromBinary(file.GetData(), file.GetSize());
+}
+
+const tflite::Model* TfLiteParser::VerifyModel(const uint8_t * binaryContent, size_t len)
 {
     if (binaryContent == nullptr)
      {
@@ -2959,9 +2960,53 @@ TfLiteParser::ModelPtr TfLiteParser::LoadModelFromBinary(const uint8_t * binaryC
                         len,
                         CHECK_LOCATION().AsString()));
     }
+    return tflite::GetModel(binaryContent);
+}
+
+TfLiteParser::ModelPtr TfLiteParser::LoadModelFromBinary(const uint8_t * binaryContent, size_t len)
+{
+    VerifyModel(binaryContent, len);
     return tflite::UnPackModel(binaryContent);
 }
 
+void TfLiteParser::LoadModelStructure(const uint8_t * binaryContent, size_t len)
+{
+    const tflite::Model* model = VerifyModel(binaryContent, len);
+
+    // Only the tables the parser reads are unpacked, the buffers of the model are left empty and viewed in place
+    m_Model = std::make_unique<tflite::ModelT>();
+    m_Model->version = model->version();
+    if (model->operator_codes() != nullptr)
+    {
+        for (const tflite::OperatorCode* operatorCode : *model->operator_codes())
+        {
+            m_Model->operator_codes.emplace_back(operatorCode->UnPack());
+        }
+    }
+    if (model->subgraphs() != nullptr)
+    {
+        for (const tflite::SubGraph* subgraph : *model->subgraphs())
+        {
+            m_Model->subgraphs.emplace_back(subgraph->UnPack());
+        }
+    }
+    if (model->buffers() != nullptr)
+    {
+        for (const tflite::Buffer* buffer : *model->buffers())
+        {
+            m_Model->buffers.emplace_back(std::make_unique<tflite::BufferT>());
+            if (buffer != nullptr && buffer->data() != nullptr)
+            {
+                m_BufferViews.push_back({ buffer->data()->data(), buffer->data()->size() });
+            }
+            else
+            {
+                m_BufferViews.push_back({ nullptr, 0 });
+            }
+        }
+    }
+}
+
 TfLiteParser::TensorRawPtrVector TfLiteParser::GetInputs(const ModelPtr & model,
                                                          size_t subgraphIndex,
                                                          size_t operatorIndex)
@@ -3187,14 +3232,20 @@ TfLiteParser::BufferRawPtr TfLiteParser::GetBuffer(const ModelPtr& model, size_t
     return model->buffers[bufferIndex].get();
 }
 
+TfLiteParser::BufferView TfLiteParser::GetBufferView(size_t bufferIndex) const
+{
+    CHECK_BUFFER(m_Model, bufferIndex);
+    return m_BufferViews[bufferIndex];
+}
+
 template<typename T>
 std::pair<armnn::ConstTensor, TfLiteParser::SupportedDataStorage>
-TfLiteParser::CreateConstTensorAndStoreData(TfLiteParser::BufferRawPtr bufferPtr,
+TfLiteParser::CreateConstTensorAndStoreData(const TfLiteParser::BufferView& buffer,
                                             TfLiteParser::TensorRawPtr tensorPtr,
                                             armnn::TensorInfo& tensorInfo,
                                             armnn::Optional<armnn::PermutationVector&> permutationVector)
 {
-    auto constData = CreateConstTensorImpl<T>(bufferPtr,
+    auto constData = CreateConstTensorImpl<T>(buffer,
                                               tensorPtr,
                                               tensorInfo,
                                               permutationVector);
@@ -3208,33 +3259,33 @@ TfLiteParser::CreateConstTensor(TensorRawPtr tensorPtr,
                                 armnn::Optional<armnn::PermutationVector&> permutationVector)
 {
     CHECK_TENSOR_PTR(tensorPtr);
-    auto bufferPtr = GetBuffer(m_Model, tensorPtr->buffer);
-    CHECK_BUFFER_SIZE(bufferPtr, tensorInfo, tensorPtr->buffer);
+    BufferView buffer = GetBufferView(tensorPtr->buffer);
+    CHECK_BUFFER_SIZE(buffer, tensorInfo, tensorPtr->buffer);
 
     switch (tensorInfo.GetDataType())
     {
         case armnn::DataType::Float32:
-            return CreateConstTensorAndStoreData<float>(bufferPtr,
+            return CreateConstTensorAndStoreData<float>(buffer,
                                                         tensorPtr,
                                                         tensorInfo,
                                                         permutationVector);
         case armnn::DataType::QAsymmU8:
-            return CreateConstTensorAndStoreData<uint8_t>(bufferPtr,
+            return CreateConstTensorAndStoreData<uint8_t>(buffer,
                                                           tensorPtr,
                                                           tensorInfo,
                                                           permutationVector);
         case armnn::DataType::QSymmS8:
-            return CreateConstTensorAndStoreData<int8_t>(bufferPtr,
+            return CreateConstTensorAndStoreData<int8_t>(buffer,
                                                          tensorPtr,
                                                          tensorInfo,
                                                          permutationVector);
         case armnn::DataType::QAsymmS8:
-            return CreateConstTensorAndStoreData<int8_t>(bufferPtr,
+            return CreateConstTensorAndStoreData<int8_t>(buffer,
                                                          tensorPtr,
                                                          tensorInfo,
                                                          permutationVector);
         case armnn::DataType::Signed32:
-            return CreateConstTensorAndStoreData<int32_t>(bufferPtr,
+            return CreateConstTensorAndStoreData<int32_t>(buffer,
                                                           tensorPtr,
                                                           tensorInfo,
                                                           permutationVector);
@@ -32,6 +32,14 @@ public:
     using BufferPtr = std::unique_ptr<tflite::BufferT>;
     using BufferRawPtr = const tflite::BufferT *;
 
+    /// Content of a buffer of the model being parsed, which points into the flatbuffer the model was loaded from
+    /// rather than into a copy of it.
+    struct BufferView
+    {
+        const uint8_t* m_Data;
+        size_t         m_Size;
+    };
+
 public:
     /// Create the network from a flatbuffers binary file on disk
     virtual armnn::INetworkPtr CreateNetworkFromBinaryFile(const char* graphFile) override;
@@ -87,6 +95,15 @@ private:
     /// Create the network from an already loaded flatbuffers model
     armnn::INetworkPtr CreateNetworkFromModel();
 
+    static void CheckModelFileExists(const char * fileName);
+    static const tflite::Model* VerifyModel(const uint8_t * binaryContent, size_t len);
+
+    /// Loads the operators and tensors of a model, leaving the content of its buffers in the flatbuffer, which has to
+    /// outlive the creation of the network
+    void LoadModelStructure(const uint8_t * binaryContent, size_t len);
+
+    BufferView GetBufferView(size_t bufferIndex) const;
+
     // signature for the parser functions
     using OperatorParsingFunction = void(TfLiteParser::*)(size_t subgraphIndex, size_t operatorIndex);
 
@@ -187,7 +204,7 @@ private:
 
     template<typename T>
     std::pair<armnn::ConstTensor, TfLiteParser::SupportedDataStorage>
-    CreateConstTensorAndStoreData(TfLiteParser::BufferRawPtr bufferPtr,
+    CreateConstTensorAndStoreData(const TfLiteParser::BufferView& buffer,
                                   TfLiteParser::TensorRawPtr tensorPtr,
                                   armnn::TensorInfo& tensorInfo,
                                   armnn::Optional<armnn::PermutationVector&> permutationVector);
@@ -203,6 +220,8 @@ private:
     /// The network we're building. Gets cleared after it is passed to the user
     armnn::INetworkPtr                    m_Network;
     ModelPtr                              m_Model;
+    /// Content of the buffers of m_Model, which is only valid while the network is created
+    std::vector<BufferView>               m_BufferViews;
 
     std::vector<OperatorParsingFunction>                     m_ParserFunctions;
     std::unordered_map<std::string, OperatorParsingFunction> m_CustomParserFunctions;
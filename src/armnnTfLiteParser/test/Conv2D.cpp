@@ -6,6 +6,9 @@
 #include <boost/test/unit_test.hpp>
 #include "ParserFlatbuffersFixture.hpp"
 #include "../TfLiteParser.hpp"
+
+#include <Filesystem.hpp>
+
 #include <sstream>
 
 BOOST_AUTO_TEST_SUITE(TensorflowLiteParser)
@@ -104,6 +107,35 @@ BOOST_FIXTURE_TEST_CASE( ParseSimpleConv2D, SimpleConv2DFixture )
         });
 }
 
+BOOST_FIXTURE_TEST_CASE( ParseSimpleConv2DFromBinaryFile, SimpleConv2DFixture )
+{
+    // The weights of the network are read from the pages the file is mapped to
+    fs::path fileName = armnnUtils::Filesystem::NamedTempFile("Armnn-tfLite-ParseSimpleConv2DFromBinaryFile.tflite");
+    bool saved = flatbuffers::SaveFile(fileName.c_str(),
+                                       reinterpret_cast<char *>(m_GraphBinary.data()),
+                                       m_GraphBinary.size(), true);
+    BOOST_CHECK_MESSAGE(saved, "Cannot save test file");
+
+    armnn::INetworkPtr network = m_Parser->CreateNetworkFromBinaryFile(fileName.c_str());
+    fs::remove(fileName);
+
+    auto optimized = Optimize(*network, { armnn::Compute::CpuRef }, m_Runtime->GetDeviceSpec());
+    BOOST_TEST(m_Runtime->LoadNetwork(m_NetworkIdentifier, std::move(optimized)) == armnn::Status::Success);
+
+    RunTest<4, armnn::DataType::QAsymmU8>(
+        0,
+        {
+            1, 2, 3,
+            4, 5, 6,
+            7, 8, 9,
+        },
+        {
+            (1*2 + 2*1 + 3*0 +
+             4*6 + 5*2 + 6*1 +
+             7*4 + 8*1 + 9*2) /2
+        });
+}
+
 struct Conv2DWithBiasesFixture : public ParserFlatbuffersFixture
 {
     explicit Conv2DWithBiasesFixture(const std::string & inputShape,
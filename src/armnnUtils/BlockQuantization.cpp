@@ -0,0 +1,122 @@
+//
+// Copyright © 2020 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "BlockQuantization.hpp"
+
+#include <armnn/Exceptions.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+
+namespace armnnUtils
+{
+
+namespace
+{
+
+void CheckBlockQuantization(unsigned int blockSize, unsigned int numBits)
+{
+    if (blockSize == 0)
+    {
+        throw armnn::InvalidArgumentException("The block size of block quantized values can't be zero");
+    }
+    if (numBits != 8 && numBits != 4)
+    {
+        throw armnn::InvalidArgumentException("Values can only be block quantized to 8 or 4 bits, not " +
+                                              std::to_string(numBits));
+    }
+}
+
+size_t GetNumBlocks(size_t numValues, unsigned int blockSize)
+{
+    return (numValues + blockSize - 1) / blockSize;
+}
+
+} // anonymous namespace
+
+size_t GetBlockQuantizedDataSize(size_t numValues, unsigned int numBits)
+{
+    return numBits == 4 ? (numValues + 1) / 2 : numValues;
+}
+
+BlockQuantizedValues BlockQuantize(const float* values, size_t numValues, unsigned int blockSize,
+                                   unsigned int numBits)
+{
+    CheckBlockQuantization(blockSize, numBits);
+
+    const float maxQuantized = numBits == 8 ? 127.0f : 7.0f;
+    const size_t numBlocks = GetNumBlocks(numValues, blockSize);
+
+    BlockQuantizedValues quantized { blockSize, numBits, std::vector<float>(numBlocks),
+                                     std::vector<int8_t>(GetBlockQuantizedDataSize(numValues, numBits)) };
+
+    for (size_t block = 0; block < numBlocks; ++block)
+    {
+        const size_t begin = block * blockSize;
+        const size_t end = std::min(begin + blockSize, numValues);
+
+        float maxAbs = 0.0f;
+        for (size_t i = begin; i < end; ++i)
+        {
+            maxAbs = std::max(maxAbs, std::abs(values[i]));
+        }
+        const float scale = maxAbs / maxQuantized;
+        quantized.m_Scales[block] = scale;
+
+        for (size_t i = begin; i < end; ++i)
+        {
+            const float rounded = scale > 0.0f ? std::round(values[i] / scale) : 0.0f;
+            const int8_t value = static_cast<int8_t>(std::max(-maxQuantized, std::min(maxQuantized, rounded)));
+            if (numBits == 8)
+            {
+                quantized.m_Data[i] = value;
+            }
+            else
+            {
+                const unsigned int shift = (i % 2) * 4;
+                const unsigned int nibble = static_cast<unsigned int>(value) & 0xFu;
+                quantized.m_Data[i / 2] = static_cast<int8_t>(static_cast<unsigned int>(quantized.m_Data[i / 2]) |
+                                                              (nibble << shift));
+            }
+        }
+    }
+    return quantized;
+}
+
+void BlockDequantize(const int8_t* data,
+                     size_t dataSize,
+                     const float* scales,
+                     size_t numScales,
+                     unsigned int blockSize,
+                     unsigned int numBits,
+                     size_t numValues,
+                     float* values)
+{
+    CheckBlockQuantization(blockSize, numBits);
+    if (dataSize != GetBlockQuantizedDataSize(numValues, numBits) || numScales != GetNumBlocks(numValues, blockSize))
+    {
+        throw armnn::InvalidArgumentException("The block quantized data doesn't match the " +
+                                              std::to_string(numValues) + " values it holds");
+    }
+
+    for (size_t i = 0; i < numValues; ++i)
+    {
+        int value;
+        if (numBits == 8)
+        {
+            value = data[i];
+        }
+        else
+        {
+            // The nibble is sign extended from its 4 bits
+            const unsigned int nibble = (static_cast<unsigned int>(data[i / 2]) >> ((i % 2) * 4)) & 0xFu;
+            value = static_cast<int>(nibble ^ 0x8u) - 8;
+        }
+        values[i] = static_cast<float>(value) * scales[i / blockSize];
+    }
+}
+
+} // namespace armnnUtils
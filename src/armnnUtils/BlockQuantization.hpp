@@ -0,0 +1,44 @@
+//
+// Copyright © 2020 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace armnnUtils
+{
+
+/// Values quantized in blocks of consecutive elements, each block having its own symmetric scale so that the blocks
+/// holding small values keep their precision. 4-bit values are packed in pairs, the first one in the low nibble.
+struct BlockQuantizedValues
+{
+    unsigned int        m_BlockSize;
+    unsigned int        m_NumBits;
+    std::vector<float>  m_Scales;
+    std::vector<int8_t> m_Data;
+};
+
+/// Returns the number of bytes holding numValues values quantized to numBits bits.
+size_t GetBlockQuantizedDataSize(size_t numValues, unsigned int numBits);
+
+/// Quantizes values to 8 or 4 bits in blocks of blockSize elements.
+/// @throws armnn::InvalidArgumentException if the block size is zero or the number of bits is neither 8 nor 4.
+BlockQuantizedValues BlockQuantize(const float* values, size_t numValues, unsigned int blockSize,
+                                   unsigned int numBits);
+
+/// Expands numValues block quantized values back to floats.
+/// @throws armnn::InvalidArgumentException if the data or scales don't match the number of values.
+void BlockDequantize(const int8_t* data,
+                     size_t dataSize,
+                     const float* scales,
+                     size_t numScales,
+                     unsigned int blockSize,
+                     unsigned int numBits,
+                     size_t numValues,
+                     float* values);
+
+} // namespace armnnUtils
@@ -0,0 +1,121 @@
+//
+// Copyright © 2020 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "MemoryMappedFile.hpp"
+
+#include <armnn/Exceptions.hpp>
+
+#include <string>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#elif defined(_MSC_VER)
+#include <common/include/WindowsWrapper.hpp>
+#endif
+
+namespace armnnUtils
+{
+
+#if defined(__unix__) || defined(__APPLE__)
+
+MemoryMappedFile::MemoryMappedFile(const char* fileName)
+    : m_Data(nullptr)
+    , m_Size(0)
+{
+    const int file = open(fileName, O_RDONLY);
+    if (file < 0)
+    {
+        throw armnn::FileNotFoundException(std::string("Cannot open the file ") + fileName);
+    }
+
+    struct stat fileStatus;
+    if (fstat(file, &fileStatus) != 0)
+    {
+        close(file);
+        throw armnn::RuntimeException(std::string("Cannot get the size of the file ") + fileName);
+    }
+    m_Size = static_cast<size_t>(fileStatus.st_size);
+
+    // Empty files can't be mapped, and have no content to give anyway
+    if (m_Size > 0)
+    {
+        void* data = mmap(nullptr, m_Size, PROT_READ, MAP_PRIVATE, file, 0);
+        if (data == MAP_FAILED)
+        {
+            close(file);
+            throw armnn::RuntimeException(std::string("Cannot map the file ") + fileName + " into memory");
+        }
+        m_Data = static_cast<const uint8_t*>(data);
+    }
+
+    // The mapping stays valid once the file is closed
+    close(file);
+}
+
+MemoryMappedFile::~MemoryMappedFile()
+{
+    if (m_Data != nullptr)
+    {
+        munmap(const_cast<uint8_t*>(m_Data), m_Size);
+    }
+}
+
+#elif defined(_MSC_VER)
+
+MemoryMappedFile::MemoryMappedFile(const char* fileName)
+    : m_Data(nullptr)
+    , m_Size(0)
+    , m_File(INVALID_HANDLE_VALUE)
+    , m_Mapping(nullptr)
+{
+    m_File = ::CreateFileA(fileName, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL,
+                           nullptr);
+    if (m_File == INVALID_HANDLE_VALUE)
+    {
+        throw armnn::FileNotFoundException(std::string("Cannot open the file ") + fileName);
+    }
+
+    LARGE_INTEGER size;
+    if (!::GetFileSizeEx(m_File, &size))
+    {
+        ::CloseHandle(m_File);
+        throw armnn::RuntimeException(std::string("Cannot get the size of the file ") + fileName);
+    }
+    m_Size = static_cast<size_t>(size.QuadPart);
+
+    // Empty files can't be mapped, and have no content to give anyway
+    if (m_Size > 0)
+    {
+        m_Mapping = ::CreateFileMappingA(m_File, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        void* data = m_Mapping ? ::MapViewOfFile(m_Mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+        if (data == nullptr)
+        {
+            if (m_Mapping)
+            {
+                ::CloseHandle(m_Mapping);
+            }
+            ::CloseHandle(m_File);
+            throw armnn::RuntimeException(std::string("Cannot map the file ") + fileName + " into memory");
+        }
+        m_Data = static_cast<const uint8_t*>(data);
+    }
+}
+
+MemoryMappedFile::~MemoryMappedFile()
+{
+    if (m_Data != nullptr)
+    {
+        ::UnmapViewOfFile(m_Data);
+        ::CloseHandle(m_Mapping);
+    }
+    ::CloseHandle(m_File);
+}
+
+#endif
+
+} // namespace armnnUtils
@@ -0,0 +1,40 @@
+//
+// Copyright © 2020 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace armnnUtils
+{
+
+/// Read-only view of the content of a file mapped into memory. Its pages are only read from the file once they are
+/// accessed, and are not counted as anonymous memory as the system can drop them and read them back from the file.
+class MemoryMappedFile
+{
+public:
+    /// @throws armnn::FileNotFoundException if the file can't be opened, armnn::RuntimeException if it can't be mapped.
+    explicit MemoryMappedFile(const char* fileName);
+    ~MemoryMappedFile();
+
+    MemoryMappedFile(const MemoryMappedFile&) = delete;
+    MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+
+    /// Returns the content of the file, or nullptr if the file is empty.
+    const uint8_t* GetData() const { return m_Data; }
+
+    size_t GetSize() const { return m_Size; }
+
+private:
+    const uint8_t* m_Data;
+    size_t m_Size;
+#if defined(_MSC_VER)
+    void* m_File;
+    void* m_Mapping;
+#endif
+};
+
+} // namespace armnnUtils
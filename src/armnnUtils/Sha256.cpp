@@ -0,0 +1,166 @@
+//
+// Copyright © 2020 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "Sha256.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace armnnUtils
+{
+
+namespace
+{
+
+constexpr uint32_t g_RoundConstants[64] =
+{
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+};
+
+inline uint32_t RotateRight(uint32_t value, unsigned int shift)
+{
+    return (value >> shift) | (value << (32 - shift));
+}
+
+} // anonymous namespace
+
+Sha256::Sha256()
+    : m_State{ { 0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19 } }
+    , m_Block{}
+    , m_BlockSize(0)
+    , m_MessageSize(0)
+{}
+
+void Sha256::Update(const void* data, size_t size)
+{
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    m_MessageSize += size;
+
+    // Whole blocks of the message are processed in place, only the bytes around them are buffered
+    if (m_BlockSize > 0)
+    {
+        const size_t count = std::min(size, m_Block.size() - m_BlockSize);
+        std::memcpy(m_Block.data() + m_BlockSize, bytes, count);
+        m_BlockSize += count;
+        bytes += count;
+        size -= count;
+        if (m_BlockSize < m_Block.size())
+        {
+            return;
+        }
+        ProcessBlock(m_Block.data());
+        m_BlockSize = 0;
+    }
+    for (; size >= m_Block.size(); bytes += m_Block.size(), size -= m_Block.size())
+    {
+        ProcessBlock(bytes);
+    }
+    if (size > 0)
+    {
+        std::memcpy(m_Block.data(), bytes, size);
+        m_BlockSize = size;
+    }
+}
+
+std::array<uint8_t, 32> Sha256::Finalize()
+{
+    // The message is padded with a 1 bit, then 0 bits up to the last 8 bytes of a block which hold its size in bits
+    const uint64_t messageBits = m_MessageSize * 8;
+    const uint8_t firstPadding = 0x80;
+    Update(&firstPadding, 1);
+    const uint8_t zero = 0;
+    while (m_BlockSize != m_Block.size() - 8)
+    {
+        Update(&zero, 1);
+    }
+    uint8_t sizeBytes[8];
+    for (unsigned int i = 0; i < 8; ++i)
+    {
+        sizeBytes[i] = static_cast<uint8_t>(messageBits >> (56 - 8 * i));
+    }
+    Update(sizeBytes, sizeof(sizeBytes));
+
+    std::array<uint8_t, 32> digest;
+    for (unsigned int i = 0; i < digest.size(); ++i)
+    {
+        digest[i] = static_cast<uint8_t>(m_State[i / 4] >> (24 - 8 * (i % 4)));
+    }
+    return digest;
+}
+
+std::string Sha256::FinalizeHex()
+{
+    static const char* const hexDigits = "0123456789abcdef";
+    std::string hex;
+    for (uint8_t byte : Finalize())
+    {
+        hex += hexDigits[byte >> 4];
+        hex += hexDigits[byte & 0xf];
+    }
+    return hex;
+}
+
+void Sha256::ProcessBlock(const uint8_t* block)
+{
+    uint32_t schedule[64];
+    for (unsigned int i = 0; i < 16; ++i)
+    {
+        schedule[i] = (uint32_t(block[4 * i]) << 24) | (uint32_t(block[4 * i + 1]) << 16) |
+                      (uint32_t(block[4 * i + 2]) << 8) | uint32_t(block[4 * i + 3]);
+    }
+    for (unsigned int i = 16; i < 64; ++i)
+    {
+        const uint32_t s0 = RotateRight(schedule[i - 15], 7) ^ RotateRight(schedule[i - 15], 18) ^
+                            (schedule[i - 15] >> 3);
+        const uint32_t s1 = RotateRight(schedule[i - 2], 17) ^ RotateRight(schedule[i - 2], 19) ^
+                            (schedule[i - 2] >> 10);
+        schedule[i] = schedule[i - 16] + s0 + schedule[i - 7] + s1;
+    }
+
+    uint32_t a = m_State[0];
+    uint32_t b = m_State[1];
+    uint32_t c = m_State[2];
+    uint32_t d = m_State[3];
+    uint32_t e = m_State[4];
+    uint32_t f = m_State[5];
+    uint32_t g = m_State[6];
+    uint32_t h = m_State[7];
+    for (unsigned int i = 0; i < 64; ++i)
+    {
+        const uint32_t s1 = RotateRight(e, 6) ^ RotateRight(e, 11) ^ RotateRight(e, 25);
+        const uint32_t choice = (e & f) ^ (~e & g);
+        const uint32_t temp1 = h + s1 + choice + g_RoundConstants[i] + schedule[i];
+        const uint32_t s0 = RotateRight(a, 2) ^ RotateRight(a, 13) ^ RotateRight(a, 22);
+        const uint32_t majority = (a & b) ^ (a & c) ^ (b & c);
+        const uint32_t temp2 = s0 + majority;
+
+        h = g;
+        g = f;
+        f = e;
+        e = d + temp1;
+        d = c;
+        c = b;
+        b = a;
+        a = temp1 + temp2;
+    }
+
+    m_State[0] += a;
+    m_State[1] += b;
+    m_State[2] += c;
+    m_State[3] += d;
+    m_State[4] += e;
+    m_State[5] += f;
+    m_State[6] += g;
+    m_State[7] += h;
+}
+
+} // namespace armnnUtils
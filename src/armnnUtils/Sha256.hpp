@@ -0,0 +1,40 @@
+//
+// Copyright © 2020 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace armnnUtils
+{
+
+/// Computes the SHA-256 digest (FIPS 180-4) of a message given in any number of parts.
+class Sha256
+{
+public:
+    Sha256();
+
+    /// Appends size bytes to the message.
+    void Update(const void* data, size_t size);
+
+    /// Completes the message and returns its digest. The object must not be updated afterwards.
+    std::array<uint8_t, 32> Finalize();
+
+    /// Completes the message and returns its digest as 64 lowercase hexadecimal digits.
+    std::string FinalizeHex();
+
+private:
+    void ProcessBlock(const uint8_t* block);
+
+    std::array<uint32_t, 8> m_State;
+    std::array<uint8_t, 64> m_Block;
+    size_t m_BlockSize;
+    uint64_t m_MessageSize;
+};
+
+} // namespace armnnUtils
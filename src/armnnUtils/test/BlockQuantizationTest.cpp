@@ -0,0 +1,74 @@
+//
+// Copyright © 2020 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include <BlockQuantization.hpp>
+
+#include <armnn/Exceptions.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <cmath>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(BlockQuantizationSuite)
+
+namespace
+{
+
+void CheckRoundTrip(unsigned int numBits)
+{
+    // The second block holds much smaller values than the first one and keeps its own precision
+    const std::vector<float> values = { 10.0f, -5.0f, 2.5f, 0.0f, 0.1f, -0.05f, 0.025f, 0.0f, -3.0f };
+    const unsigned int blockSize = 4;
+
+    armnnUtils::BlockQuantizedValues quantized =
+        armnnUtils::BlockQuantize(values.data(), values.size(), blockSize, numBits);
+    BOOST_TEST(quantized.m_Scales.size() == 3);
+    BOOST_TEST(quantized.m_Data.size() == (numBits == 8 ? 9 : 5));
+
+    std::vector<float> dequantized(values.size());
+    armnnUtils::BlockDequantize(quantized.m_Data.data(), quantized.m_Data.size(),
+                                quantized.m_Scales.data(), quantized.m_Scales.size(),
+                                blockSize, numBits, values.size(), dequantized.data());
+
+    for (size_t i = 0; i < values.size(); ++i)
+    {
+        const float tolerance = quantized.m_Scales[i / blockSize] / 2 + 1e-6f;
+        BOOST_TEST(std::abs(dequantized[i] - values[i]) <= tolerance);
+    }
+    BOOST_TEST(dequantized[0] == 10.0f);
+    BOOST_TEST(dequantized[8] == -3.0f);
+}
+
+} // anonymous namespace
+
+BOOST_AUTO_TEST_CASE(BlockQuantize8Bits)
+{
+    CheckRoundTrip(8);
+}
+
+BOOST_AUTO_TEST_CASE(BlockQuantize4Bits)
+{
+    CheckRoundTrip(4);
+}
+
+BOOST_AUTO_TEST_CASE(BlockQuantizeInvalidArguments)
+{
+    const std::vector<float> values = { 1.0f, 2.0f };
+    BOOST_CHECK_THROW(armnnUtils::BlockQuantize(values.data(), values.size(), 0, 8),
+                      armnn::InvalidArgumentException);
+    BOOST_CHECK_THROW(armnnUtils::BlockQuantize(values.data(), values.size(), 2, 2),
+                      armnn::InvalidArgumentException);
+
+    // The data doesn't hold as many values as requested
+    armnnUtils::BlockQuantizedValues quantized = armnnUtils::BlockQuantize(values.data(), values.size(), 2, 8);
+    std::vector<float> dequantized(4);
+    BOOST_CHECK_THROW(armnnUtils::BlockDequantize(quantized.m_Data.data(), quantized.m_Data.size(),
+                                                  quantized.m_Scales.data(), quantized.m_Scales.size(),
+                                                  2, 8, dequantized.size(), dequantized.data()),
+                      armnn::InvalidArgumentException);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,54 @@
+//
+// Copyright © 2020 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include <armnn/Exceptions.hpp>
+
+#include <Filesystem.hpp>
+#include <MemoryMappedFile.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <fstream>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(MemoryMappedFileSuite)
+
+BOOST_AUTO_TEST_CASE(MemoryMappedFileHoldsTheContentOfTheFile)
+{
+    fs::path fileName = armnnUtils::Filesystem::NamedTempFile("Armnn-MemoryMappedFileTest-TempFile");
+
+    std::vector<uint8_t> content(10000);
+    for (size_t i = 0; i < content.size(); ++i)
+    {
+        content[i] = static_cast<uint8_t>(i * 7);
+    }
+    {
+        std::ofstream file(fileName.string(), std::ios::binary);
+        file.write(reinterpret_cast<const char*>(content.data()), static_cast<std::streamsize>(content.size()));
+    }
+
+    {
+        armnnUtils::MemoryMappedFile mappedFile(fileName.string().c_str());
+        BOOST_TEST(mappedFile.GetSize() == content.size());
+        std::vector<uint8_t> mappedContent(mappedFile.GetData(), mappedFile.GetData() + mappedFile.GetSize());
+        BOOST_TEST(mappedContent == content, boost::test_tools::per_element());
+    }
+    fs::remove(fileName);
+
+    // Empty files have no content
+    {
+        std::ofstream file(fileName.string(), std::ios::binary);
+    }
+    {
+        armnnUtils::MemoryMappedFile mappedFile(fileName.string().c_str());
+        BOOST_TEST(mappedFile.GetSize() == 0);
+        BOOST_TEST(mappedFile.GetData() == nullptr);
+    }
+    fs::remove(fileName);
+
+    BOOST_CHECK_THROW(armnnUtils::MemoryMappedFile(fileName.string().c_str()), armnn::FileNotFoundException);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
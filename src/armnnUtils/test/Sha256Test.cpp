@@ -0,0 +1,69 @@
+//
+// Copyright © 2020 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include <Sha256.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(Sha256Suite)
+
+namespace
+{
+
+std::string GetHexDigest(const std::string& message)
+{
+    armnnUtils::Sha256 sha256;
+    sha256.Update(message.data(), message.size());
+    return sha256.FinalizeHex();
+}
+
+} // anonymous namespace
+
+BOOST_AUTO_TEST_CASE(Sha256MatchesTheStandardTestVectors)
+{
+    BOOST_TEST(GetHexDigest("") == "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855");
+    BOOST_TEST(GetHexDigest("abc") == "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad");
+    BOOST_TEST(GetHexDigest("abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq") ==
+               "248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1");
+
+    // One million times 'a' spans many blocks
+    BOOST_TEST(GetHexDigest(std::string(1000000, 'a')) ==
+               "cdc76e5c9914fb9281a1c7e284d73e67f1809a48a497200e046d39ccc7112cd0");
+}
+
+BOOST_AUTO_TEST_CASE(Sha256DoesNotDependOnHowTheMessageIsSplit)
+{
+    std::vector<uint8_t> message(1000);
+    for (size_t i = 0; i < message.size(); ++i)
+    {
+        message[i] = static_cast<uint8_t>(i * 31 + 7);
+    }
+
+    armnnUtils::Sha256 whole;
+    whole.Update(message.data(), message.size());
+    const std::string expected = whole.FinalizeHex();
+
+    for (size_t partSize : { 1u, 13u, 63u, 64u, 65u, 200u })
+    {
+        armnnUtils::Sha256 parts;
+        for (size_t offset = 0; offset < message.size(); offset += partSize)
+        {
+            parts.Update(message.data() + offset, std::min(partSize, message.size() - offset));
+        }
+        BOOST_TEST(parts.FinalizeHex() == expected);
+    }
+
+    // A single flipped bit changes the digest
+    message[500] ^= 0x80;
+    armnnUtils::Sha256 flipped;
+    flipped.Update(message.data(), message.size());
+    BOOST_TEST(flipped.FinalizeHex() != expected);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
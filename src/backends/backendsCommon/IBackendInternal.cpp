@@ -4,6 +4,7 @@
 //
 
 #include <armnn/BackendOptions.hpp>
+#include <armnn/Exceptions.hpp>
 #include <armnn/backends/IBackendInternal.hpp>
 
 namespace armnn
@@ -163,4 +164,14 @@ std::vector<ITensorHandleFactory::FactoryId> IBackendInternal::GetHandleFactoryP
     return std::vector<ITensorHandleFactory::FactoryId>();
 }
 
+std::vector<uint8_t> IBackendInternal::SerializePreCompiledObject(const PreCompiledLayer&) const
+{
+    throw Exception("The " + GetId().Get() + " backend can't serialize its precompiled layers");
+}
+
+void IBackendInternal::DeserializePreCompiledObject(PreCompiledLayer&, const std::vector<uint8_t>&) const
+{
+    throw Exception("The " + GetId().Get() + " backend can't deserialize its precompiled layers");
+}
+
 } // namespace armnn
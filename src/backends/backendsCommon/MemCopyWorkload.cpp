@@ -61,4 +61,19 @@ void CopyMemGenericWorkload::Execute() const
     }
 }
 
+void CopyMemGenericWorkload::ExecuteAsync(experimental::WorkingMemDescriptor& workingMemDescriptor)
+{
+    ARMNN_SCOPED_PROFILING_EVENT(Compute::Undefined, "CopyMemGeneric_Execute_WorkingMemDescriptor");
+
+    auto copyFunc = [](void* dst, const void* src, size_t size)
+        {
+            memcpy(dst, src, size);
+        };
+
+    for (unsigned int i = 0; i < workingMemDescriptor.m_Inputs.size(); ++i)
+    {
+        CopyTensorContentsGeneric(workingMemDescriptor.m_Inputs[i], workingMemDescriptor.m_Outputs[i], copyFunc);
+    }
+}
+
 } //namespace armnn
@@ -28,4 +28,13 @@ void ImportMemGenericWorkload::Execute() const
     m_TensorHandlePairs.first->Unmap();
 }
 
+void ImportMemGenericWorkload::ExecuteAsync(experimental::WorkingMemDescriptor& workingMemDescriptor)
+{
+    ARMNN_SCOPED_PROFILING_EVENT(Compute::Undefined, "ImportMemGeneric_Execute_WorkingMemDescriptor");
+
+    ITensorHandle* source = workingMemDescriptor.m_Inputs[0];
+    workingMemDescriptor.m_Outputs[0]->Import(const_cast<void*>(source->Map(true)), MemorySource::Malloc);
+    source->Unmap();
+}
+
 } //namespace armnn
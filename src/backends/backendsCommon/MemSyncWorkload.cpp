@@ -27,4 +27,12 @@ void SyncMemGenericWorkload::Execute() const
     m_TensorHandle->Unmap();
 }
 
+void SyncMemGenericWorkload::ExecuteAsync(experimental::WorkingMemDescriptor& workingMemDescriptor)
+{
+    ARMNN_SCOPED_PROFILING_EVENT(Compute::Undefined, "SyncMemGeneric_Execute_WorkingMemDescriptor");
+
+    workingMemDescriptor.m_Inputs[0]->Map(true);
+    workingMemDescriptor.m_Inputs[0]->Unmap();
+}
+
 } //namespace armnn
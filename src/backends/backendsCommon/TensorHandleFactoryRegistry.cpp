@@ -65,4 +65,14 @@ void TensorHandleFactoryRegistry::ReleaseMemory()
     }
 }
 
+size_t TensorHandleFactoryRegistry::GetPlannedPeakMemory() const
+{
+    size_t plannedPeakMemory = 0;
+    for (auto& mgr : m_MemoryManagers)
+    {
+        plannedPeakMemory += mgr->GetPlannedPeakMemory();
+    }
+    return plannedPeakMemory;
+}
+
 } // namespace armnn
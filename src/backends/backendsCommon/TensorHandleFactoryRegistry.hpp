@@ -41,6 +41,9 @@ public:
     /// Release memory required for inference
     void ReleaseMemory();
 
+    /// Returns the number of bytes of memory the memory managers planned to hold for inference
+    size_t GetPlannedPeakMemory() const;
+
 private:
     std::vector<std::unique_ptr<ITensorHandleFactory>> m_Factories;
     std::vector<std::shared_ptr<IMemoryManager>> m_MemoryManagers;
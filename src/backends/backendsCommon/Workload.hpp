@@ -8,10 +8,12 @@
 #include "WorkloadInfo.hpp"
 
 #include <armnn/backends/IWorkload.hpp>
+#include <armnn/backends/WorkingMemDescriptor.hpp>
 #include <Profiling.hpp>
 #include <ProfilingService.hpp>
 
 #include <algorithm>
+#include <mutex>
 
 namespace armnn
 {
@@ -36,6 +38,29 @@ public:
         m_Data.Validate(info);
     }
 
+    // Default implementation for workloads which read their tensor handles from m_Data.
+    // The handles of the given descriptor are swapped in for the duration of Execute(), so concurrent calls
+    // on the same workload are serialized. Workloads that can run re-entrantly should override this.
+    void ExecuteAsync(experimental::WorkingMemDescriptor& workingMemDescriptor) override
+    {
+        std::lock_guard<std::mutex> lockGuard(m_AsyncWorkloadMutex);
+
+        std::swap(m_Data.m_Inputs, workingMemDescriptor.m_Inputs);
+        std::swap(m_Data.m_Outputs, workingMemDescriptor.m_Outputs);
+        try
+        {
+            Execute();
+        }
+        catch (...)
+        {
+            std::swap(m_Data.m_Inputs, workingMemDescriptor.m_Inputs);
+            std::swap(m_Data.m_Outputs, workingMemDescriptor.m_Outputs);
+            throw;
+        }
+        std::swap(m_Data.m_Inputs, workingMemDescriptor.m_Inputs);
+        std::swap(m_Data.m_Outputs, workingMemDescriptor.m_Outputs);
+    }
+
     void PostAllocationConfigure() override {}
 
     const QueueDescriptor& GetData() const { return m_Data; }
@@ -43,8 +68,11 @@ public:
     profiling::ProfilingGuid GetGuid() const final { return m_Guid; }
 
 protected:
-    const QueueDescriptor m_Data;
+    QueueDescriptor m_Data;
     const profiling::ProfilingGuid m_Guid;
+
+private:
+    std::mutex m_AsyncWorkloadMutex;
 };
 
 // TypedWorkload used
@@ -8,17 +8,283 @@
 #include "RefWorkloadFactory.hpp"
 #include "RefLayerSupport.hpp"
 #include "RefTensorHandleFactory.hpp"
+#include "workloads/FusedElementwise.hpp"
+#include "workloads/RefThreadPool.hpp"
 
 #include <armnn/BackendRegistry.hpp>
+#include <armnn/Logging.hpp>
 #include <armnn/backends/IBackendContext.hpp>
 #include <armnn/backends/IMemoryManager.hpp>
+#include <armnn/backends/OptimizationViews.hpp>
 #include <armnn/utility/PolymorphicDowncast.hpp>
 
 #include <Optimizer.hpp>
 
+#include <algorithm>
+#include <map>
+#include <string>
+
 namespace armnn
 {
 
+namespace
+{
+
+SubgraphView::InputSlots GetInputSlots(Layer& layer)
+{
+    SubgraphView::InputSlots inputSlots;
+    for (auto it = layer.BeginInputSlots(); it != layer.EndInputSlots(); ++it)
+    {
+        inputSlots.push_back(&(*it));
+    }
+    return inputSlots;
+}
+
+SubgraphView::OutputSlots GetOutputSlots(Layer& layer)
+{
+    SubgraphView::OutputSlots outputSlots;
+    for (auto it = layer.BeginOutputSlots(); it != layer.EndOutputSlots(); ++it)
+    {
+        outputSlots.push_back(&(*it));
+    }
+    return outputSlots;
+}
+
+/// Returns whether applying an activation to the float values computed by the kernel of the layer producing its
+/// input, before they are encoded in the output tensor, gives the same results as running the activation on its own.
+bool CanFuseActivation(const Layer& baseLayer, const ActivationLayer& activationLayer)
+{
+    const TensorInfo& baseInfo       = baseLayer.GetOutputSlot(0).GetTensorInfo();
+    const TensorInfo& activationInfo = activationLayer.GetOutputSlot(0).GetTensorInfo();
+    if (baseInfo != activationInfo)
+    {
+        return false;
+    }
+
+    // Other data types are rounded between the two layers, which only leaves clamping activations unaffected
+    const ActivationFunction function = activationLayer.GetParameters().m_Function;
+    return baseInfo.GetDataType() == DataType::Float32 ||
+           function == ActivationFunction::ReLu ||
+           function == ActivationFunction::BoundedReLu;
+}
+
+/// Substitutes a layer with weights and biases and the activation consuming its output with a copy of the layer
+/// carrying the ActivationDescriptor, which its workload applies as it writes the outputs.
+template <typename LayerType>
+void FuseActivation(OptimizationViews& optimizationViews, LayerType& baseLayer, ActivationLayer& activationLayer)
+{
+    const std::string name = std::string("fused-") + activationLayer.GetName() + "-into-" + baseLayer.GetName();
+
+    LayerType* replacementLayer =
+        optimizationViews.GetGraph().AddLayer<LayerType>(baseLayer.GetParameters(), name.c_str());
+    replacementLayer->m_Weight = std::move(baseLayer.m_Weight);
+    replacementLayer->m_Bias   = std::move(baseLayer.m_Bias);
+    replacementLayer->SetAdditionalInfoForObject(
+        std::make_shared<ActivationDescriptor>(activationLayer.GetParameters()));
+
+    SubgraphView substitutableSubgraph(GetInputSlots(baseLayer),
+                                       GetOutputSlots(activationLayer),
+                                       {&baseLayer, &activationLayer});
+    optimizationViews.AddSubstitution({substitutableSubgraph, SubgraphView(replacementLayer)});
+}
+
+/// Returns whether a layer computes each element of its Float32 output from the elements at the same index of its
+/// Float32 inputs, which have the rank of the output and are broadcast along their dimensions of size one.
+bool IsFusableElementwise(const Layer& layer)
+{
+    switch (layer.GetType())
+    {
+        case LayerType::Addition:
+        case LayerType::Subtraction:
+        case LayerType::Multiplication:
+        case LayerType::Division:
+        case LayerType::Maximum:
+        case LayerType::Minimum:
+        case LayerType::Activation:
+            break;
+        case LayerType::ElementwiseUnary:
+        {
+            const UnaryOperation operation =
+                PolymorphicDowncast<const ElementwiseUnaryLayer*>(&layer)->GetParameters().m_Operation;
+            if (operation == UnaryOperation::LogicalNot)
+            {
+                return false;
+            }
+            break;
+        }
+        default:
+            return false;
+    }
+
+    const TensorInfo& outputInfo = layer.GetOutputSlot(0).GetTensorInfo();
+    if (outputInfo.GetDataType() != DataType::Float32)
+    {
+        return false;
+    }
+    const TensorShape& outputShape = outputInfo.GetShape();
+    for (auto&& inputSlot : layer.GetInputSlots())
+    {
+        const OutputSlot* connectedSlot = inputSlot.GetConnectedOutputSlot();
+        if (connectedSlot == nullptr || connectedSlot->GetTensorInfo().GetDataType() != DataType::Float32)
+        {
+            return false;
+        }
+        const TensorShape& inputShape = connectedSlot->GetTensorInfo().GetShape();
+        if (inputShape.GetNumDimensions() != outputShape.GetNumDimensions())
+        {
+            return false;
+        }
+        for (unsigned int d = 0; d < inputShape.GetNumDimensions(); ++d)
+        {
+            if (inputShape[d] != outputShape[d] && inputShape[d] != 1)
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+/// Returns whether a layer of the subgraph is fused into the single layer consuming its output, which must be a
+/// fusable elementwise layer of the same output shape for the chain to compute one element per output element.
+bool IsFusedIntoConsumer(const Layer& layer, const std::map<LayerGuid, Layer*>& untouched)
+{
+    if (untouched.find(layer.GetGuid()) == untouched.end() || !IsFusableElementwise(layer) ||
+        layer.GetOutputSlot(0).GetNumConnections() != 1)
+    {
+        return false;
+    }
+    const Layer& consumer = layer.GetOutputSlot(0).GetConnection(0)->GetOwningLayer();
+    return untouched.find(consumer.GetGuid()) != untouched.end() && IsFusableElementwise(consumer) &&
+           consumer.GetOutputSlot(0).GetTensorInfo().GetShape() == layer.GetOutputSlot(0).GetTensorInfo().GetShape();
+}
+
+/// Collects the layers of the chain ending with a layer, each after the layers it consumes the output of, and the
+/// input slots reading the inputs of the chain, in the order the layers read them.
+void CollectElementwiseChain(Layer& layer,
+                             const std::map<LayerGuid, Layer*>& untouched,
+                             std::vector<Layer*>& layers,
+                             SubgraphView::InputSlots& inputSlots)
+{
+    for (unsigned int i = 0; i < layer.GetNumInputSlots(); ++i)
+    {
+        InputSlot& inputSlot = layer.GetInputSlot(i);
+        Layer& producer = inputSlot.GetConnectedOutputSlot()->GetOwningLayer();
+        if (IsFusedIntoConsumer(producer, untouched))
+        {
+            CollectElementwiseChain(producer, untouched, layers, inputSlots);
+        }
+        else
+        {
+            inputSlots.push_back(&inputSlot);
+        }
+    }
+    layers.push_back(&layer);
+}
+
+FusedElementwiseProgram::Instruction MakeInstruction(const Layer& layer)
+{
+    using OpCode = FusedElementwiseProgram::OpCode;
+
+    FusedElementwiseProgram::Instruction instruction{};
+    switch (layer.GetType())
+    {
+        case LayerType::Addition:
+            instruction.m_OpCode = OpCode::Add;
+            break;
+        case LayerType::Subtraction:
+            instruction.m_OpCode = OpCode::Sub;
+            break;
+        case LayerType::Multiplication:
+            instruction.m_OpCode = OpCode::Mul;
+            break;
+        case LayerType::Division:
+            instruction.m_OpCode = OpCode::Div;
+            break;
+        case LayerType::Maximum:
+            instruction.m_OpCode = OpCode::Max;
+            break;
+        case LayerType::Minimum:
+            instruction.m_OpCode = OpCode::Min;
+            break;
+        case LayerType::Activation:
+            instruction.m_OpCode = OpCode::Activation;
+            instruction.m_Activation = PolymorphicDowncast<const ActivationLayer*>(&layer)->GetParameters();
+            break;
+        default:
+            instruction.m_OpCode = OpCode::Unary;
+            instruction.m_UnaryOperation =
+                PolymorphicDowncast<const ElementwiseUnaryLayer*>(&layer)->GetParameters().m_Operation;
+            break;
+    }
+    return instruction;
+}
+
+void SetFusedElementwiseProgram(PreCompiledLayer& layer, FusedElementwiseProgram program)
+{
+    layer.SetPreCompiledObject(PreCompiledObjectPtr(new FusedElementwiseProgram(std::move(program)),
+        [](const void* object)
+        {
+            delete static_cast<const FusedElementwiseProgram*>(object);
+        }));
+}
+
+/// Substitutes the chain of fusable elementwise layers ending with a layer with a PreCompiledLayer holding the
+/// FusedElementwiseProgram of the chain, so that RefFusedElementwiseWorkload computes its output in a single pass
+/// over memory rather than every layer reading and writing a whole tensor. Returns the layers of the chain, or no
+/// layer if the chain is too short to be worth fusing.
+std::vector<Layer*> FuseElementwiseChain(OptimizationViews& optimizationViews,
+                                         Layer& lastLayer,
+                                         const std::map<LayerGuid, Layer*>& untouched)
+{
+    std::vector<Layer*> layers;
+    SubgraphView::InputSlots inputSlots;
+    CollectElementwiseChain(lastLayer, untouched, layers, inputSlots);
+    if (layers.size() < 2)
+    {
+        return {};
+    }
+
+    FusedElementwiseProgram program;
+    program.m_NumInputs = static_cast<unsigned int>(inputSlots.size());
+
+    std::map<const Layer*, unsigned int> resultRegisters;
+    auto getOperand = [&](InputSlot& inputSlot)
+    {
+        auto input = std::find(inputSlots.begin(), inputSlots.end(), &inputSlot);
+        if (input != inputSlots.end())
+        {
+            return static_cast<unsigned int>(std::distance(inputSlots.begin(), input));
+        }
+        return resultRegisters.at(&inputSlot.GetConnectedOutputSlot()->GetOwningLayer());
+    };
+
+    for (Layer* layer : layers)
+    {
+        FusedElementwiseProgram::Instruction instruction = MakeInstruction(*layer);
+        instruction.m_Operand0 = getOperand(layer->GetInputSlot(0));
+        instruction.m_Operand1 =
+            layer->GetNumInputSlots() > 1 ? getOperand(layer->GetInputSlot(1)) : instruction.m_Operand0;
+
+        resultRegisters[layer] = program.GetNumRegisters();
+        program.m_Instructions.push_back(instruction);
+    }
+
+    const std::string name = std::string("fused-elementwise-") + lastLayer.GetName();
+    PreCompiledLayer* fusedLayer = optimizationViews.GetGraph().AddLayer<PreCompiledLayer>(
+        PreCompiledDescriptor(program.m_NumInputs, 1), name.c_str());
+    SetFusedElementwiseProgram(*fusedLayer, std::move(program));
+    fusedLayer->GetOutputSlot(0).SetTensorInfo(lastLayer.GetOutputSlot(0).GetTensorInfo());
+
+    SubgraphView substitutableSubgraph(std::move(inputSlots),
+                                       { &lastLayer.GetOutputSlot(0) },
+                                       SubgraphView::Layers(layers.begin(), layers.end()));
+    optimizationViews.AddSubstitution({substitutableSubgraph, SubgraphView(fusedLayer)});
+    return layers;
+}
+
+} // anonymous namespace
+
 const BackendId& RefBackend::GetIdStatic()
 {
     static const BackendId s_Id{RefBackendId()};
@@ -42,8 +308,31 @@ IBackendInternal::IWorkloadFactoryPtr RefBackend::CreateWorkloadFactory(
     return std::make_unique<RefWorkloadFactory>(PolymorphicPointerDowncast<RefMemoryManager>(memoryManager));
 }
 
-IBackendInternal::IBackendContextPtr RefBackend::CreateBackendContext(const IRuntime::CreationOptions&) const
+IBackendInternal::IBackendContextPtr RefBackend::CreateBackendContext(
+    const IRuntime::CreationOptions& options) const
 {
+    // The thread pool is shared by every CpuRef workload of the process, the last runtime created sets its size
+    // for all the runtimes, which is worth a warning when it overrides the size set by another runtime
+    ParseOptions(options.m_BackendOptions, GetIdStatic(), [](std::string name, const BackendOptions::Var& value)
+        {
+            if (name == "NumberOfThreads")
+            {
+                if (!value.IsInt() || value.AsInt() < 1)
+                {
+                    throw InvalidArgumentException("CpuRef: NumberOfThreads must be a positive integer");
+                }
+                const unsigned int numThreads = static_cast<unsigned int>(value.AsInt());
+                RefThreadPool& threadPool = RefThreadPool::GetInstance();
+                const unsigned int previousNumThreads = threadPool.GetNumberOfThreads();
+                if (previousNumThreads != 1 && previousNumThreads != numThreads)
+                {
+                    ARMNN_LOG(warning) << "CpuRef: NumberOfThreads changed from " << previousNumThreads << " to "
+                                       << numThreads << " for every runtime of the process";
+                }
+                threadPool.SetNumberOfThreads(numThreads);
+            }
+        });
+
     return IBackendContextPtr{};
 }
 
@@ -73,7 +362,86 @@ OptimizationViews RefBackend::OptimizeSubgraphView(const SubgraphView& subgraph)
 {
     OptimizationViews optimizationViews;
 
-    optimizationViews.AddUntouchedSubgraph(SubgraphView(subgraph));
+    std::map<LayerGuid, Layer*> untouched;
+    for (Layer* layer : subgraph)
+    {
+        untouched.insert({ layer->GetGuid(), layer });
+    }
+
+    // Activations consuming the single output of a Convolution2d, DepthwiseConvolution2d or FullyConnected layer
+    // are fused into it, which saves writing and reading back the intermediate tensor
+    for (Layer* layer : subgraph)
+    {
+        Layer& base = *layer;
+        if ((base.GetType() != LayerType::Convolution2d &&
+             base.GetType() != LayerType::DepthwiseConvolution2d &&
+             base.GetType() != LayerType::FullyConnected) ||
+            base.GetAdditionalInformation<ActivationDescriptor>() != nullptr ||
+            base.GetOutputSlot(0).GetNumConnections() != 1)
+        {
+            continue;
+        }
+
+        Layer& child = base.GetOutputSlot(0).GetConnection(0)->GetOwningLayer();
+        if (child.GetType() != LayerType::Activation || untouched.find(child.GetGuid()) == untouched.end())
+        {
+            continue;
+        }
+
+        auto& activationLayer = *PolymorphicDowncast<ActivationLayer*>(&child);
+        if (!CanFuseActivation(base, activationLayer))
+        {
+            continue;
+        }
+
+        switch (base.GetType())
+        {
+            case LayerType::Convolution2d:
+                FuseActivation(optimizationViews, *PolymorphicDowncast<Convolution2dLayer*>(&base), activationLayer);
+                break;
+            case LayerType::DepthwiseConvolution2d:
+                FuseActivation(optimizationViews,
+                               *PolymorphicDowncast<DepthwiseConvolution2dLayer*>(&base),
+                               activationLayer);
+                break;
+            default:
+                FuseActivation(optimizationViews, *PolymorphicDowncast<FullyConnectedLayer*>(&base), activationLayer);
+                break;
+        }
+        untouched.erase(base.GetGuid());
+        untouched.erase(child.GetGuid());
+    }
+
+    // Chains of elementwise layers whose intermediate results are only read within the chain are fused, from the
+    // last layer of each chain
+    std::vector<Layer*> lastLayers;
+    for (Layer* layer : subgraph)
+    {
+        if (untouched.find(layer->GetGuid()) != untouched.end() && IsFusableElementwise(*layer) &&
+            !IsFusedIntoConsumer(*layer, untouched))
+        {
+            lastLayers.push_back(layer);
+        }
+    }
+    for (Layer* lastLayer : lastLayers)
+    {
+        for (Layer* fusedLayer : FuseElementwiseChain(optimizationViews, *lastLayer, untouched))
+        {
+            untouched.erase(fusedLayer->GetGuid());
+        }
+    }
+
+    if (optimizationViews.GetSubstitutions().empty())
+    {
+        optimizationViews.AddUntouchedSubgraph(SubgraphView(subgraph));
+        return optimizationViews;
+    }
+
+    for (const auto& pair : untouched)
+    {
+        Layer* layer = pair.second;
+        optimizationViews.AddUntouchedSubgraph(SubgraphView(GetInputSlots(*layer), GetOutputSlots(*layer), {layer}));
+    }
 
     return optimizationViews;
 }
@@ -91,4 +459,20 @@ void RefBackend::RegisterTensorHandleFactories(class TensorHandleFactoryRegistry
     registry.RegisterFactory(std::make_unique<RefTensorHandleFactory>(memoryManager));
 }
 
+std::vector<uint8_t> RefBackend::SerializePreCompiledObject(const PreCompiledLayer& layer) const
+{
+    // The only layers the reference backend precompiles are the fused elementwise chains
+    auto program = static_cast<const FusedElementwiseProgram*>(layer.GetPreCompiledObject());
+    if (program == nullptr)
+    {
+        throw InvalidArgumentException(std::string("The precompiled layer ") + layer.GetName() + " has no program");
+    }
+    return SerializeFusedElementwiseProgram(*program);
+}
+
+void RefBackend::DeserializePreCompiledObject(PreCompiledLayer& layer, const std::vector<uint8_t>& data) const
+{
+    SetFusedElementwiseProgram(layer, DeserializeFusedElementwiseProgram(data));
+}
+
 } // namespace armnn
@@ -39,6 +39,12 @@ public:
     std::vector<ITensorHandleFactory::FactoryId> GetHandleFactoryPreferences() const override;
 
     void RegisterTensorHandleFactories(class TensorHandleFactoryRegistry& registry) override;
+
+    bool SupportsAsyncExecution() const override { return true; }
+
+    std::vector<uint8_t> SerializePreCompiledObject(const PreCompiledLayer& layer) const override;
+
+    void DeserializePreCompiledObject(PreCompiledLayer& layer, const std::vector<uint8_t>& data) const override;
 };
 
 } // namespace armnn
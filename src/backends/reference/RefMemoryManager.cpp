@@ -4,98 +4,218 @@
 //
 #include "RefMemoryManager.hpp"
 
+#include <armnn/Logging.hpp>
 #include <armnn/utility/Assert.hpp>
 
 #include <algorithm>
+#include <iterator>
+#include <limits>
 
 namespace armnn
 {
 
+namespace
+{
+
+constexpr unsigned int EndOfNetwork = std::numeric_limits<unsigned int>::max();
+
+size_t AlignUp(size_t value, size_t alignment)
+{
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+} // anonymous namespace
+
 RefMemoryManager::RefMemoryManager()
+    : m_Time(0),
+      m_IsPlanned(false),
+      m_SlabSize(0),
+      m_Slab(nullptr),
+      m_AlignedSlab(nullptr)
 {}
 
 RefMemoryManager::~RefMemoryManager()
-{}
-
-RefMemoryManager::Pool* RefMemoryManager::Manage(unsigned int numBytes)
 {
-    if (!m_FreePools.empty())
-    {
-        Pool* res = m_FreePools.back();
-        m_FreePools.pop_back();
-        res->Reserve(numBytes);
-        return res;
-    }
-    else
+    if (m_Slab)
     {
-        m_Pools.push_front(Pool(numBytes));
-        return &m_Pools.front();
+        Release();
     }
 }
 
+RefMemoryManager::Pool* RefMemoryManager::Manage(unsigned int numBytes)
+{
+    ARMNN_ASSERT_MSG(!m_Slab, "RefMemoryManager::Manage() cannot be called after memory acquired");
+    m_Pools.push_front(Pool(numBytes, m_Time++));
+    m_IsPlanned = false;
+    return &m_Pools.front();
+}
+
 void RefMemoryManager::Allocate(RefMemoryManager::Pool* pool)
 {
     ARMNN_ASSERT(pool);
-    m_FreePools.push_back(pool);
+    pool->m_End = m_Time++;
+}
+
+void RefMemoryManager::AllowInPlace(Pool* output, Pool* input)
+{
+    ARMNN_ASSERT(output && input);
+    output->m_InPlaceInputs.push_back(input);
+    m_IsPlanned = false;
 }
 
 void* RefMemoryManager::GetPointer(RefMemoryManager::Pool* pool)
 {
-    return pool->GetPointer();
+    ARMNN_ASSERT_MSG(m_AlignedSlab, "RefMemoryManager::GetPointer() called when memory not acquired");
+    return m_AlignedSlab + pool->m_Offset;
 }
 
 void RefMemoryManager::Acquire()
 {
-    for (Pool &pool: m_Pools)
+    ARMNN_ASSERT_MSG(!m_Slab, "RefMemoryManager::Acquire() called when memory already acquired");
+    if (!m_IsPlanned)
     {
-         pool.Acquire();
+        PlanOffsets();
     }
+
+    // A single allocation for all the tensors, with room to align its start
+    m_Slab = ::operator new(m_SlabSize + Alignment);
+    const size_t address = reinterpret_cast<size_t>(m_Slab);
+    m_AlignedSlab = static_cast<char*>(m_Slab) + (AlignUp(address, Alignment) - address);
 }
 
 void RefMemoryManager::Release()
 {
-    for (Pool &pool: m_Pools)
+    ARMNN_ASSERT_MSG(m_Slab, "RefMemoryManager::Release() called when memory not acquired");
+    ::operator delete(m_Slab);
+    m_Slab = nullptr;
+    m_AlignedSlab = nullptr;
+}
+
+void RefMemoryManager::PlanOffsets()
+{
+    std::vector<Pool*> pools;
+    for (Pool& pool : m_Pools)
     {
-         pool.Release();
+        pools.push_back(&pool);
+    }
+    std::sort(pools.begin(), pools.end(), [](const Pool* lhs, const Pool* rhs)
+    {
+        return lhs->m_Start < rhs->m_Start;
+    });
+    std::vector<unsigned int> starts;
+    for (const Pool* pool : pools)
+    {
+        starts.push_back(pool->m_Start);
     }
-}
 
-RefMemoryManager::Pool::Pool(unsigned int numBytes)
-    : m_Size(numBytes),
-      m_Pointer(nullptr)
-{}
+    // A pool runs in place of an input whose lifetime ends before any other tensor is managed after the pool,
+    // i.e. when the layer producing the pool is the last one reading the input
+    auto CanShare = [&starts](const Pool& output, const Pool& input)
+    {
+        if (input.m_End == EndOfNetwork || input.m_End < output.m_Start)
+        {
+            return false;
+        }
+        auto nextStart = std::upper_bound(starts.begin(), starts.end(), output.m_Start);
+        return nextStart == starts.end() || *nextStart > input.m_End;
+    };
+
+    std::vector<Pool*> blocks;
+    unsigned int numInPlace = 0;
+    for (Pool* pool : pools)
+    {
+        pool->m_Owner = pool;
+        pool->m_BlockSize = AlignUp(pool->m_Size, Alignment);
+        pool->m_BlockEnd = pool->m_End;
+        for (Pool* input : pool->m_InPlaceInputs)
+        {
+            if (CanShare(*pool, *input))
+            {
+                Pool* owner = input->m_Owner;
+                owner->m_BlockSize = std::max(owner->m_BlockSize, pool->m_BlockSize);
+                owner->m_BlockEnd = std::max(owner->m_BlockEnd, pool->m_End);
+                pool->m_Owner = owner;
+                ++numInPlace;
+                break;
+            }
+        }
+        if (pool->m_Owner == pool)
+        {
+            blocks.push_back(pool);
+        }
+    }
 
-RefMemoryManager::Pool::~Pool()
-{
-    if (m_Pointer)
+    // Greedy by size: the largest blocks are placed first, each one in the smallest gap left between the blocks
+    // already placed whose lifetimes overlap with its own, or after all of them if no gap is large enough
+    std::stable_sort(blocks.begin(), blocks.end(), [](const Pool* lhs, const Pool* rhs)
     {
-        Release();
+        return lhs->m_BlockSize > rhs->m_BlockSize;
+    });
+
+    std::vector<const Pool*> placed;
+    std::vector<const Pool*> overlapping;
+    size_t slabSize = 0;
+    size_t totalSize = 0;
+    for (Pool* block : blocks)
+    {
+        const size_t size = block->m_BlockSize;
+
+        overlapping.clear();
+        std::copy_if(placed.begin(), placed.end(), std::back_inserter(overlapping),
+                     [block](const Pool* other) { return block->IsAliveWith(*other); });
+        std::sort(overlapping.begin(), overlapping.end(), [](const Pool* lhs, const Pool* rhs)
+        {
+            return lhs->m_Offset < rhs->m_Offset;
+        });
+
+        size_t bestOffset = 0;
+        size_t bestGap = std::numeric_limits<size_t>::max();
+        size_t gapStart = 0;
+        for (const Pool* other : overlapping)
+        {
+            if (other->m_Offset >= gapStart + size && other->m_Offset - gapStart < bestGap)
+            {
+                bestOffset = gapStart;
+                bestGap = other->m_Offset - gapStart;
+            }
+            gapStart = std::max(gapStart, other->m_Offset + other->m_BlockSize);
+        }
+        if (bestGap == std::numeric_limits<size_t>::max())
+        {
+            bestOffset = gapStart;
+        }
+
+        block->m_Offset = bestOffset;
+        slabSize = std::max(slabSize, bestOffset + size);
+        placed.push_back(block);
     }
-}
 
-void* RefMemoryManager::Pool::GetPointer()
-{
-    ARMNN_ASSERT_MSG(m_Pointer, "RefMemoryManager::Pool::GetPointer() called when memory not acquired");
-    return m_Pointer;
-}
+    for (Pool* pool : pools)
+    {
+        pool->m_Offset = pool->m_Owner->m_Offset;
+        totalSize += AlignUp(pool->m_Size, Alignment);
+    }
 
-void RefMemoryManager::Pool::Reserve(unsigned int numBytes)
-{
-    ARMNN_ASSERT_MSG(!m_Pointer, "RefMemoryManager::Pool::Reserve() cannot be called after memory acquired");
-    m_Size = std::max(m_Size, numBytes);
-}
+    m_SlabSize = slabSize;
+    m_IsPlanned = true;
 
-void RefMemoryManager::Pool::Acquire()
-{
-    ARMNN_ASSERT_MSG(!m_Pointer, "RefMemoryManager::Pool::Acquire() called when memory already acquired");
-    m_Pointer = ::operator new(size_t(m_Size));
+    ARMNN_LOG(debug) << "RefMemoryManager: " << pools.size() << " tensors of " << totalSize
+                     << " bytes planned into " << slabSize << " bytes, " << numInPlace << " of them in place";
 }
 
-void RefMemoryManager::Pool::Release()
+RefMemoryManager::Pool::Pool(unsigned int numBytes, unsigned int start)
+    : m_Size(numBytes),
+      m_Offset(0),
+      m_Start(start),
+      m_End(EndOfNetwork),
+      m_Owner(nullptr),
+      m_BlockSize(0),
+      m_BlockEnd(EndOfNetwork)
+{}
+
+bool RefMemoryManager::Pool::IsAliveWith(const Pool& other) const
 {
-    ARMNN_ASSERT_MSG(m_Pointer, "RefMemoryManager::Pool::Release() called when memory not acquired");
-    ::operator delete(m_Pointer);
-    m_Pointer = nullptr;
+    return m_Start < other.m_BlockEnd && other.m_Start < m_BlockEnd;
 }
 
 }
@@ -6,13 +6,19 @@
 
 #include <armnn/backends/IMemoryManager.hpp>
 
+#include <cstddef>
 #include <forward_list>
 #include <vector>
 
 namespace armnn
 {
 
-// An implementation of IMemoryManager to be used with RefTensorHandle
+// An implementation of IMemoryManager to be used with RefTensorHandle.
+//
+// The lifetime of each managed tensor spans from its call to Manage() to its call to Allocate(), which the graph
+// makes in topological order. On Acquire() the tensors are packed into a single slab: tensors whose lifetimes
+// do not overlap share memory, with offsets planned greedily from the largest tensor to the smallest. The output
+// of a workload running in place shares the memory of its input when the workload is the last one reading it.
 class RefMemoryManager : public IMemoryManager
 {
 public:
@@ -21,39 +27,73 @@ public:
 
     class Pool;
 
+    /// Starts the lifetime of a tensor of numBytes bytes.
     Pool* Manage(unsigned int numBytes);
 
+    /// Ends the lifetime of the tensor of the given pool, its memory can then be reused by tensors managed later.
     void Allocate(Pool *pool);
 
+    /// Lets the tensor of output reuse the memory of the tensor of input, for workloads which can run in place.
+    /// The memory is only shared if the lifetime of input ends at the layer producing output, which the planner
+    /// checks once the lifetimes of all the tensors are known.
+    void AllowInPlace(Pool* output, Pool* input);
+
     void* GetPointer(Pool *pool);
 
     void Acquire() override;
     void Release() override;
 
+    /// Returns the size of the slab holding all the managed tensors, as planned by the last call to Acquire().
+    size_t GetPlannedPeakMemory() const override { return m_SlabSize; }
+
+    /// Alignment of the memory of each managed tensor.
+    static constexpr size_t Alignment = 64;
+
     class Pool
     {
     public:
-        Pool(unsigned int numBytes);
-        ~Pool();
+        Pool(unsigned int numBytes, unsigned int start);
 
-        void Acquire();
-        void Release();
+        unsigned int GetSize() const { return m_Size; }
+        size_t GetOffset() const { return m_Offset; }
 
-        void* GetPointer();
+    private:
+        friend class RefMemoryManager;
 
-        void Reserve(unsigned int numBytes);
+        /// Returns whether the memory blocks of this and the other pool are in use at the same time
+        bool IsAliveWith(const Pool& other) const;
 
-    private:
         unsigned int m_Size;
-        void* m_Pointer;
+        size_t m_Offset;
+
+        /// Lifetime of the tensor, as [m_Start, m_End) in the order of the calls to Manage() and Allocate()
+        unsigned int m_Start;
+        unsigned int m_End;
+
+        /// Pools whose memory this one may reuse, see AllowInPlace()
+        std::vector<Pool*> m_InPlaceInputs;
+
+        /// Pool owning the memory block this one is placed in, itself unless it runs in place. The owner's block
+        /// covers the lifetimes and sizes of all the pools sharing it.
+        Pool* m_Owner;
+        size_t m_BlockSize;
+        unsigned int m_BlockEnd;
     };
-    
+
 private:
     RefMemoryManager(const RefMemoryManager&) = delete; // Noncopyable
     RefMemoryManager& operator=(const RefMemoryManager&) = delete; // Noncopyable
 
+    /// Assigns the offsets of the pools in the slab and sets m_SlabSize
+    void PlanOffsets();
+
     std::forward_list<Pool> m_Pools;
-    std::vector<Pool*> m_FreePools;
+    unsigned int m_Time;
+    bool m_IsPlanned;
+
+    size_t m_SlabSize;
+    void* m_Slab;
+    char* m_AlignedSlab;
 };
 
 }
@@ -51,6 +51,26 @@ void RefTensorHandle::Manage()
         ARMNN_ASSERT_MSG(!m_UnmanagedMemory, "RefTensorHandle::Manage() called after Allocate()");
 
         m_Pool = m_MemoryManager->Manage(m_TensorInfo.GetNumBytes());
+
+        for (RefTensorHandle* input : m_InPlaceInputs)
+        {
+            // Inputs not managed by the same memory manager, e.g. constants or imported tensors, keep their memory
+            if (input->m_Pool && input->m_MemoryManager == m_MemoryManager)
+            {
+                m_MemoryManager->AllowInPlace(m_Pool, input->m_Pool);
+            }
+        }
+    }
+}
+
+void RefTensorHandle::AddInPlaceInput(RefTensorHandle* input)
+{
+    ARMNN_ASSERT_MSG(!m_Pool, "RefTensorHandle::AddInPlaceInput() called after Manage()");
+    if (input != this &&
+        input->GetTensorInfo().GetShape() == m_TensorInfo.GetShape() &&
+        input->GetTensorInfo().GetDataType() == m_TensorInfo.GetDataType())
+    {
+        m_InPlaceInputs.push_back(input);
     }
 }
 
@@ -8,6 +8,8 @@
 
 #include "RefMemoryManager.hpp"
 
+#include <vector>
+
 namespace armnn
 {
 
@@ -58,6 +60,10 @@ public:
 
     virtual bool Import(void* memory, MemorySource source) override;
 
+    /// Lets this tensor, the output of a workload able to run in place, reuse the memory of one of its inputs of the
+    /// same shape and data type, when the workload is the last one reading it. Must be called before Manage().
+    void AddInPlaceInput(RefTensorHandle* input);
+
 private:
     // Only used for testing
     void CopyOutTo(void*) const override;
@@ -72,6 +78,7 @@ private:
 
     std::shared_ptr<RefMemoryManager> m_MemoryManager;
     RefMemoryManager::Pool* m_Pool;
+    std::vector<RefTensorHandle*> m_InPlaceInputs;
     mutable void* m_UnmanagedMemory;
     MemorySourceFlags m_ImportFlags;
     bool m_Imported;
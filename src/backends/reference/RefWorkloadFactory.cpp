@@ -81,6 +81,34 @@ bool IsQAsymmU8(const WorkloadInfo& info)
     return IsDataType<DataType::QAsymmU8>(info);
 }
 
+namespace
+{
+
+/// Lets the output of a workload whose kernel can run in place reuse the memory of one of its inputs,
+/// see RefTensorHandle::AddInPlaceInput(). Tensors of other backends keep their own memory.
+void AllowInPlace(const QueueDescriptor& descriptor)
+{
+    if (descriptor.m_Outputs.size() != 1)
+    {
+        return;
+    }
+    RefTensorHandle* output = dynamic_cast<RefTensorHandle*>(descriptor.m_Outputs[0]);
+    if (!output)
+    {
+        return;
+    }
+    for (ITensorHandle* input : descriptor.m_Inputs)
+    {
+        RefTensorHandle* refInput = dynamic_cast<RefTensorHandle*>(input);
+        if (refInput)
+        {
+            output->AddInPlaceInput(refInput);
+        }
+    }
+}
+
+} // anonymous namespace
+
 RefWorkloadFactory::RefWorkloadFactory(const std::shared_ptr<RefMemoryManager>& memoryManager)
     : m_MemoryManager(memoryManager)
 {
@@ -143,12 +171,14 @@ std::unique_ptr<IWorkload> RefWorkloadFactory::CreateAbs(const AbsQueueDescripto
 std::unique_ptr<IWorkload> RefWorkloadFactory::CreateActivation(const ActivationQueueDescriptor& descriptor,
                                                                 const WorkloadInfo& info) const
 {
+    AllowInPlace(descriptor);
     return std::make_unique<RefActivationWorkload>(descriptor, info);
 }
 
 std::unique_ptr<IWorkload> RefWorkloadFactory::CreateAddition(const AdditionQueueDescriptor& descriptor,
                                                               const WorkloadInfo& info) const
 {
+    AllowInPlace(descriptor);
     if (info.m_InputTensorInfos[0].GetDataType() == armnn::DataType::Signed32)
     {
         return std::make_unique<RefAdditionWorkload<int32_t>>(descriptor, info);
@@ -294,6 +324,7 @@ std::unique_ptr<IWorkload> RefWorkloadFactory::CreateDetectionPostProcess(
 std::unique_ptr<IWorkload> RefWorkloadFactory::CreateDivision(const DivisionQueueDescriptor& descriptor,
                                                               const WorkloadInfo& info) const
 {
+    AllowInPlace(descriptor);
     if (info.m_InputTensorInfos[0].GetDataType() == armnn::DataType::Signed32)
     {
         return std::make_unique<RefDivisionWorkload<int32_t>>(descriptor, info);
@@ -311,6 +342,7 @@ std::unique_ptr<IWorkload> RefWorkloadFactory::CreateElementwiseUnary(const Elem
     {
         return std::make_unique<RefLogicalUnaryWorkload>(descriptor, info);
     }
+    AllowInPlace(descriptor);
     return std::make_unique<RefElementwiseUnaryWorkload>(descriptor, info);
 }
 
@@ -426,6 +458,7 @@ std::unique_ptr<IWorkload> RefWorkloadFactory::CreateLstm(const LstmQueueDescrip
 std::unique_ptr<IWorkload> RefWorkloadFactory::CreateMaximum(const MaximumQueueDescriptor& descriptor,
                                                              const WorkloadInfo& info) const
 {
+    AllowInPlace(descriptor);
     if (info.m_InputTensorInfos[0].GetDataType() == armnn::DataType::Signed32)
     {
         return std::make_unique<RefMaximumWorkload<int32_t>>(descriptor, info);
@@ -471,6 +504,7 @@ std::unique_ptr<IWorkload> RefWorkloadFactory::CreateMerger(const MergerQueueDes
 std::unique_ptr<IWorkload> RefWorkloadFactory::CreateMinimum(const MinimumQueueDescriptor& descriptor,
                                                              const WorkloadInfo& info) const
 {
+    AllowInPlace(descriptor);
     if (info.m_InputTensorInfos[0].GetDataType() == armnn::DataType::Signed32)
     {
         return std::make_unique<RefMinimumWorkload<int32_t>>(descriptor, info);
@@ -484,6 +518,7 @@ std::unique_ptr<IWorkload> RefWorkloadFactory::CreateMinimum(const MinimumQueueD
 std::unique_ptr<IWorkload> RefWorkloadFactory::CreateMultiplication(const MultiplicationQueueDescriptor& descriptor,
                                                                     const WorkloadInfo& info) const
 {
+    AllowInPlace(descriptor);
     if (info.m_InputTensorInfos[0].GetDataType() == armnn::DataType::Signed32)
     {
         return std::make_unique<RefMultiplicationWorkload<int32_t>>(descriptor, info);
@@ -550,10 +585,16 @@ std::unique_ptr<IWorkload> RefWorkloadFactory::CreatePooling2d(const Pooling2dQu
     return std::make_unique<RefPooling2dWorkload>(descriptor, info);
 }
 
-std::unique_ptr<IWorkload> RefWorkloadFactory::CreatePreCompiled(const PreCompiledQueueDescriptor& /*descriptor*/,
-                                                                 const WorkloadInfo& /*info*/) const
+std::unique_ptr<IWorkload> RefWorkloadFactory::CreatePreCompiled(const PreCompiledQueueDescriptor& descriptor,
+                                                                 const WorkloadInfo& info) const
 {
-    return nullptr;
+    // The only PreCompiledLayers assigned to CpuRef are the elementwise chains fused by RefBackend
+    if (descriptor.m_PreCompiledObject == nullptr)
+    {
+        return nullptr;
+    }
+    AllowInPlace(descriptor);
+    return std::make_unique<RefFusedElementwiseWorkload>(descriptor, info);
 }
 
 std::unique_ptr<IWorkload> RefWorkloadFactory::CreatePrelu(const PreluQueueDescriptor& descriptor,
@@ -623,6 +664,7 @@ std::unique_ptr<IWorkload> RefWorkloadFactory::CreateSlice(const SliceQueueDescr
 std::unique_ptr<IWorkload> RefWorkloadFactory::CreateSoftmax(const SoftmaxQueueDescriptor& descriptor,
                                                              const WorkloadInfo& info) const
 {
+    AllowInPlace(descriptor);
     return std::make_unique<RefSoftmaxWorkload>(descriptor, info);
 }
 
@@ -659,6 +701,7 @@ std::unique_ptr<IWorkload> RefWorkloadFactory::CreateStridedSlice(const StridedS
 std::unique_ptr<IWorkload> RefWorkloadFactory::CreateSubtraction(const SubtractionQueueDescriptor& descriptor,
                                                                  const WorkloadInfo& info) const
 {
+    AllowInPlace(descriptor);
     if (info.m_InputTensorInfos[0].GetDataType() == armnn::DataType::Signed32)
     {
         return std::make_unique<RefSubtractionWorkload<int32_t>>(descriptor, info);
@@ -34,7 +34,9 @@ BACKEND_SOURCES := \
         workloads/ElementwiseFunction.cpp \
         workloads/Fill.cpp \
         workloads/FullyConnected.cpp \
+        workloads/FusedElementwise.cpp \
         workloads/Gather.cpp \
+        workloads/GemmConvolution.cpp \
         workloads/InstanceNorm.cpp \
         workloads/LogSoftmax.cpp \
         workloads/LstmUtils.cpp \
@@ -43,6 +45,7 @@ BACKEND_SOURCES := \
         workloads/Pad.cpp \
         workloads/Pooling2d.cpp \
         workloads/PreluImpl.cpp \
+        workloads/QuantizedConvolution.cpp \
         workloads/RefActivationWorkload.cpp \
         workloads/RefArgMinMaxWorkload.cpp \
         workloads/RefBatchNormalizationWorkload.cpp \
@@ -66,6 +69,7 @@ BACKEND_SOURCES := \
         workloads/RefFillWorkload.cpp \
         workloads/RefFloorWorkload.cpp \
         workloads/RefFullyConnectedWorkload.cpp \
+        workloads/RefFusedElementwiseWorkload.cpp \
         workloads/RefGatherWorkload.cpp \
         workloads/RefInstanceNormalizationWorkload.cpp \
         workloads/RefL2NormalizationWorkload.cpp \
@@ -90,6 +94,7 @@ BACKEND_SOURCES := \
         workloads/RefSpaceToDepthWorkload.cpp \
         workloads/RefStackWorkload.cpp \
         workloads/RefStridedSliceWorkload.cpp \
+        workloads/RefThreadPool.cpp \
         workloads/RefSplitterWorkload.cpp \
         workloads/RefTransposeConvolution2dWorkload.cpp \
         workloads/RefTransposeWorkload.cpp \
@@ -102,7 +107,9 @@ BACKEND_SOURCES := \
         workloads/StringMapping.cpp \
         workloads/Softmax.cpp \
         workloads/Splitter.cpp \
-        workloads/TransposeConvolution2d.cpp
+        workloads/TransposeConvolution2d.cpp \
+        workloads/TypedConversion.cpp \
+        workloads/WinogradConvolution.cpp
 else
 
 # ARMNN_REF_ENABLED == 0
@@ -124,6 +131,7 @@ ifeq ($(ARMNN_REF_ENABLED),1)
 
 BACKEND_TEST_SOURCES := \
         test/ArgMinMaxTests.cpp \
+        test/RefConvolutionTests.cpp \
         test/RefCreateWorkloadTests.cpp \
         test/RefDetectionPostProcessTests.cpp \
         test/RefEndToEndTests.cpp \
@@ -133,7 +141,8 @@ BACKEND_TEST_SOURCES := \
         test/RefMemoryManagerTests.cpp \
         test/RefOptimizedNetworkTests.cpp \
         test/RefRuntimeTests.cpp \
-        test/RefTensorHandleTests.cpp
+        test/RefTensorHandleTests.cpp \
+        test/RefTypedKernelTests.cpp
 else
 
 # ARMNN_REF_ENABLED == 0
@@ -0,0 +1,492 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include <reference/workloads/ConvImpl.hpp>
+#include <reference/workloads/FullyConnected.hpp>
+#include <reference/workloads/GemmConvolution.hpp>
+#include <reference/workloads/QuantizedConvolution.hpp>
+#include <reference/workloads/TransposeConvolution2d.hpp>
+#include <reference/workloads/WinogradConvolution.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <cmath>
+#include <type_traits>
+#include <vector>
+
+namespace
+{
+
+using namespace armnn;
+
+std::vector<float> MakeValues(unsigned int size, unsigned int seed)
+{
+    std::vector<float> values(size);
+    for (unsigned int i = 0; i < size; ++i)
+    {
+        values[i] = static_cast<float>(static_cast<int>((i * 7919u + seed) % 23u) - 11) / 11.0f;
+    }
+    return values;
+}
+
+TensorShape MakeShape(DataLayout dataLayout, unsigned int n, unsigned int c, unsigned int h, unsigned int w)
+{
+    return dataLayout == DataLayout::NHWC ? TensorShape({ n, h, w, c }) : TensorShape({ n, c, h, w });
+}
+
+void CheckClose(const std::vector<float>& actual, const std::vector<float>& expected, float tolerance = 1e-4f)
+{
+    BOOST_TEST(actual.size() == expected.size());
+    for (unsigned int i = 0; i < actual.size(); ++i)
+    {
+        BOOST_TEST(std::abs(actual[i] - expected[i]) <= tolerance, "element " << i << ": " << actual[i] << " != "
+                                                                            << expected[i]);
+    }
+}
+
+/// Compares GemmConvolve(), or WinogradConvolve() if winogradTileSize is not 0, against the direct loops of
+/// Convolve() on the same convolution
+void CompareConvolution(const Convolution2dDescriptor& descriptor,
+                        unsigned int batchSize,
+                        unsigned int inputChannels,
+                        unsigned int inputHeight,
+                        unsigned int inputWidth,
+                        unsigned int outputChannels,
+                        unsigned int filterSize,
+                        unsigned int winogradTileSize = 0)
+{
+    const DataLayout dataLayout = descriptor.m_DataLayout;
+    const unsigned int dilatedFilterHeight = (filterSize - 1) * descriptor.m_DilationY + 1;
+    const unsigned int dilatedFilterWidth  = (filterSize - 1) * descriptor.m_DilationX + 1;
+    const unsigned int outputHeight =
+        (inputHeight + descriptor.m_PadTop + descriptor.m_PadBottom - dilatedFilterHeight) / descriptor.m_StrideY + 1;
+    const unsigned int outputWidth =
+        (inputWidth + descriptor.m_PadLeft + descriptor.m_PadRight - dilatedFilterWidth) / descriptor.m_StrideX + 1;
+
+    const TensorInfo inputInfo(MakeShape(dataLayout, batchSize, inputChannels, inputHeight, inputWidth),
+                               DataType::Float32);
+    const TensorInfo outputInfo(MakeShape(dataLayout, batchSize, outputChannels, outputHeight, outputWidth),
+                                DataType::Float32);
+    const TensorInfo weightsInfo(MakeShape(dataLayout, outputChannels, inputChannels, filterSize, filterSize),
+                                 DataType::Float32);
+    const TensorInfo biasesInfo({ outputChannels }, DataType::Float32);
+
+    std::vector<float> input   = MakeValues(inputInfo.GetNumElements(), 1);
+    std::vector<float> weights = MakeValues(weightsInfo.GetNumElements(), 2);
+    std::vector<float> biases  = MakeValues(biasesInfo.GetNumElements(), 3);
+
+    std::vector<float> expected(outputInfo.GetNumElements());
+    auto inputDecoder   = MakeDecoder<float>(inputInfo, input.data());
+    auto weightsDecoder = MakeDecoder<float>(weightsInfo, weights.data());
+    auto biasesDecoder  = MakeDecoder<float>(biasesInfo, biases.data());
+    auto outputEncoder  = MakeEncoder<float>(outputInfo, expected.data());
+    Convolve(inputInfo.GetShape(), *inputDecoder, outputInfo.GetShape(), *outputEncoder, weightsInfo.GetShape(),
+             *weightsDecoder, descriptor.m_BiasEnabled, biasesDecoder.get(), dataLayout, descriptor.m_PadTop,
+             descriptor.m_PadLeft, descriptor.m_StrideX, descriptor.m_StrideY, descriptor.m_DilationX,
+             descriptor.m_DilationY);
+
+    BOOST_TEST(IsGemmConvolutionSupported(inputInfo, weightsInfo, outputInfo));
+
+    std::vector<float> actual(outputInfo.GetNumElements());
+    if (winogradTileSize != 0)
+    {
+        BOOST_TEST(GetWinogradOutputTileSize(descriptor, weightsInfo.GetShape(), outputInfo.GetShape()) ==
+                   winogradTileSize);
+        WinogradConvolve(winogradTileSize, descriptor, inputInfo.GetShape(), input.data(), outputInfo.GetShape(),
+                         actual.data(),
+                         TransformWinogradWeights(winogradTileSize, weightsInfo.GetShape(), weights.data(),
+                                                  dataLayout),
+                         descriptor.m_BiasEnabled ? biases.data() : nullptr);
+
+        // The transforms do not accumulate in the same order and lose some precision
+        CheckClose(actual, expected, 1e-3f);
+        return;
+    }
+
+    GemmConvolve(descriptor, inputInfo.GetShape(), input.data(), outputInfo.GetShape(), actual.data(),
+                 weightsInfo.GetShape(), PackConvolution2dWeights(weightsInfo.GetShape(), weights.data(), dataLayout),
+                 descriptor.m_BiasEnabled ? biases.data() : nullptr);
+
+    CheckClose(actual, expected);
+}
+
+/// Compares GemmTransposeConvolve() against the direct loops of TransposeConvolution2dImpl()
+void CompareGemmTransposeConvolution(const TransposeConvolution2dDescriptor& descriptor,
+                                     unsigned int batchSize,
+                                     unsigned int inputChannels,
+                                     unsigned int inputHeight,
+                                     unsigned int inputWidth,
+                                     unsigned int outputChannels,
+                                     unsigned int weightsSize)
+{
+    const DataLayout dataLayout = descriptor.m_DataLayout;
+    const unsigned int outputHeight =
+        (inputHeight - 1) * descriptor.m_StrideY + weightsSize - descriptor.m_PadTop - descriptor.m_PadBottom;
+    const unsigned int outputWidth =
+        (inputWidth - 1) * descriptor.m_StrideX + weightsSize - descriptor.m_PadLeft - descriptor.m_PadRight;
+
+    const TensorInfo inputInfo(MakeShape(dataLayout, batchSize, inputChannels, inputHeight, inputWidth),
+                               DataType::Float32);
+    const TensorInfo outputInfo(MakeShape(dataLayout, batchSize, outputChannels, outputHeight, outputWidth),
+                                DataType::Float32);
+    const TensorInfo weightsInfo(MakeShape(dataLayout, outputChannels, inputChannels, weightsSize, weightsSize),
+                                 DataType::Float32);
+    const TensorInfo biasesInfo({ outputChannels }, DataType::Float32);
+
+    std::vector<float> input   = MakeValues(inputInfo.GetNumElements(), 4);
+    std::vector<float> weights = MakeValues(weightsInfo.GetNumElements(), 5);
+    std::vector<float> biases  = MakeValues(biasesInfo.GetNumElements(), 6);
+
+    std::vector<float> expected(outputInfo.GetNumElements());
+    auto inputDecoder   = MakeDecoder<float>(inputInfo, input.data());
+    auto weightsDecoder = MakeDecoder<float>(weightsInfo, weights.data());
+    auto biasesDecoder  = MakeDecoder<float>(biasesInfo, biases.data());
+    auto outputEncoder  = MakeEncoder<float>(outputInfo, expected.data());
+    TransposeConvolution2dImpl(descriptor, inputInfo.GetShape(), *inputDecoder, outputInfo.GetShape(),
+                               *outputEncoder, weightsInfo.GetShape(), *weightsDecoder,
+                               descriptor.m_BiasEnabled ? biasesDecoder.get() : nullptr);
+
+    std::vector<float> actual(outputInfo.GetNumElements());
+    GemmTransposeConvolve(descriptor, inputInfo.GetShape(), input.data(), outputInfo.GetShape(), actual.data(),
+                          weightsInfo.GetShape(),
+                          PackTransposeConvolution2dWeights(weightsInfo.GetShape(), weights.data(), dataLayout),
+                          descriptor.m_BiasEnabled ? biases.data() : nullptr);
+
+    CheckClose(actual, expected);
+}
+
+
+/// Returns quantized values spread over -100 to 100 around the zero point of the tensor
+template <typename T>
+std::vector<T> MakeQuantizedValues(const TensorInfo& info, unsigned int seed)
+{
+    const std::vector<float> values = MakeValues(info.GetNumElements(), seed);
+    std::vector<T> quantized(values.size());
+    for (unsigned int i = 0; i < values.size(); ++i)
+    {
+        quantized[i] = static_cast<T>(std::round(values[i] * 100.0f) +
+                                      static_cast<float>(info.GetQuantizationOffset()));
+    }
+    return quantized;
+}
+
+/// Compares QuantizedConvolve() against Convolve() on the decoded values of the same quantized tensors, quantizing
+/// its float results to the output type. Per-axis weights are QSymmS8, per-tensor weights QAsymmU8.
+void CompareQuantizedConvolution(const Convolution2dDescriptor& descriptor,
+                                 bool depthwise,
+                                 bool perAxis,
+                                 unsigned int inputChannels,
+                                 unsigned int inputHeight,
+                                 unsigned int inputWidth,
+                                 unsigned int channelsPerInput,
+                                 unsigned int filterSize,
+                                 const ActivationDescriptor* activation = nullptr)
+{
+    const DataLayout dataLayout = descriptor.m_DataLayout;
+    const unsigned int outputChannels = depthwise ? inputChannels * channelsPerInput : channelsPerInput;
+    const unsigned int outputHeight =
+        (inputHeight + descriptor.m_PadTop + descriptor.m_PadBottom - filterSize) / descriptor.m_StrideY + 1;
+    const unsigned int outputWidth =
+        (inputWidth + descriptor.m_PadLeft + descriptor.m_PadRight - filterSize) / descriptor.m_StrideX + 1;
+
+    const TensorInfo inputInfo(MakeShape(dataLayout, 1, inputChannels, inputHeight, inputWidth),
+                               DataType::QAsymmU8, 0.01f, 120);
+    const TensorInfo outputInfo(MakeShape(dataLayout, 1, outputChannels, outputHeight, outputWidth),
+                                DataType::QAsymmU8, 0.1f, 100);
+    const TensorShape weightsShape = depthwise ?
+        TensorShape({ channelsPerInput, inputChannels, filterSize, filterSize }) :
+        MakeShape(dataLayout, outputChannels, inputChannels, filterSize, filterSize);
+
+    std::vector<float> weightScales(outputChannels);
+    std::vector<float> biasScales(outputChannels);
+    for (unsigned int channel = 0; channel < outputChannels; ++channel)
+    {
+        weightScales[channel] = 0.005f + 0.001f * static_cast<float>(channel);
+        biasScales[channel] = inputInfo.GetQuantizationScale() * weightScales[channel];
+    }
+    const TensorInfo weightsInfo = perAxis ? TensorInfo(weightsShape, DataType::QSymmS8, weightScales, 0)
+                                           : TensorInfo(weightsShape, DataType::QAsymmU8, 0.006f, 110);
+    const TensorInfo biasesInfo = perAxis ?
+        TensorInfo(TensorShape({ outputChannels }), DataType::Signed32, biasScales, 0) :
+        TensorInfo(TensorShape({ outputChannels }), DataType::Signed32, 0.006f * inputInfo.GetQuantizationScale(), 0);
+
+    std::vector<uint8_t> input = MakeQuantizedValues<uint8_t>(inputInfo, 7);
+    std::vector<int32_t> biases(outputChannels);
+    for (unsigned int channel = 0; channel < outputChannels; ++channel)
+    {
+        biases[channel] = static_cast<int32_t>(channel * 1000) - 2000;
+    }
+
+    std::vector<uint8_t> unsignedWeights = MakeQuantizedValues<uint8_t>(weightsInfo, 8);
+    std::vector<int8_t> signedWeights    = MakeQuantizedValues<int8_t>(weightsInfo, 8);
+    const void* weights = perAxis ? static_cast<const void*>(signedWeights.data())
+                                  : static_cast<const void*>(unsignedWeights.data());
+
+    std::vector<float> decodedInput = MakeDecoder<float>(inputInfo, input.data())->DecodeTensor(inputInfo.GetShape());
+    std::vector<float> decodedWeights =
+        MakeDecoder<float>(weightsInfo, weights)->DecodeTensor(weightsShape, depthwise ? channelsPerInput : 1, depthwise);
+    std::vector<float> decodedBiases =
+        MakeDecoder<float>(biasesInfo, biases.data())->DecodeTensor(biasesInfo.GetShape());
+
+    std::vector<float> floatOutput(outputInfo.GetNumElements());
+    Convolve(inputInfo.GetShape(), decodedInput.data(), outputInfo.GetShape(), floatOutput.data(), weightsShape,
+             decodedWeights.data(), true, decodedBiases.data(), dataLayout, descriptor.m_PadTop,
+             descriptor.m_PadLeft, descriptor.m_StrideX, descriptor.m_StrideY, 1, 1, depthwise, activation);
+    std::vector<uint8_t> expected(outputInfo.GetNumElements());
+    auto outputEncoder = MakeEncoder<float>(outputInfo, expected.data());
+    for (unsigned int i = 0; i < floatOutput.size(); ++i)
+    {
+        (*outputEncoder)[i];
+        outputEncoder->Set(floatOutput[i]);
+    }
+
+    const ScopedCpuTensorHandle weightsHandle(ConstTensor(weightsInfo, weights));
+    const ScopedCpuTensorHandle biasesHandle(ConstTensor(biasesInfo, biases.data()));
+    auto params = CreateQuantizedKernelParameters(inputInfo, weightsHandle, &biasesHandle, outputInfo, activation,
+                                                  outputChannels);
+    BOOST_TEST_REQUIRE(params.get() != nullptr);
+
+    std::vector<uint8_t> actual(outputInfo.GetNumElements());
+    QuantizedConvolve(*params, inputInfo.GetShape(), input.data(), outputInfo.GetShape(), actual.data(),
+                      weightsShape, dataLayout, descriptor.m_PadTop, descriptor.m_PadLeft, descriptor.m_StrideX,
+                      descriptor.m_StrideY, 1, 1, depthwise);
+
+    // Fixed point requantization may round the other way than the float path
+    for (unsigned int i = 0; i < actual.size(); ++i)
+    {
+        BOOST_TEST(std::abs(static_cast<int>(actual[i]) - static_cast<int>(expected[i])) <= 1,
+                   "element " << i << ": " << static_cast<int>(actual[i]) << " != " << static_cast<int>(expected[i]));
+    }
+}
+
+/// Compares QuantizedFullyConnected() against FullyConnected() on the decoded values of the same quantized tensors,
+/// quantizing its float results to the output type. The input, weights and output are all of type T, which is
+/// uint8_t for QAsymmU8 and int8_t for QAsymmS8.
+template <typename T>
+void CompareQuantizedFullyConnected(bool transposeWeights,
+                                    unsigned int batchSize,
+                                    unsigned int inputSize,
+                                    unsigned int outputSize,
+                                    const ActivationDescriptor* activation = nullptr)
+{
+    const bool isSigned = std::is_signed<T>::value;
+    const DataType dataType = isSigned ? DataType::QAsymmS8 : DataType::QAsymmU8;
+    const TensorInfo inputInfo(TensorShape({ batchSize, inputSize }), dataType, 0.01f, isSigned ? 10 : 120);
+    const TensorInfo outputInfo(TensorShape({ batchSize, outputSize }), dataType, 0.1f, isSigned ? -5 : 100);
+    const TensorShape weightsShape = transposeWeights ? TensorShape({ outputSize, inputSize })
+                                                      : TensorShape({ inputSize, outputSize });
+    const TensorInfo weightsInfo(weightsShape, dataType, 0.006f, isSigned ? -7 : 110);
+    const TensorInfo biasesInfo(TensorShape({ outputSize }), DataType::Signed32,
+                                inputInfo.GetQuantizationScale() * weightsInfo.GetQuantizationScale(), 0);
+
+    std::vector<T> input   = MakeQuantizedValues<T>(inputInfo, 3);
+    std::vector<T> weights = MakeQuantizedValues<T>(weightsInfo, 4);
+    std::vector<int32_t> biases(outputSize);
+    for (unsigned int channel = 0; channel < outputSize; ++channel)
+    {
+        biases[channel] = static_cast<int32_t>(channel * 700) - 3000;
+    }
+
+    std::vector<float> decodedInput = MakeDecoder<float>(inputInfo, input.data())->DecodeTensor(inputInfo.GetShape());
+    std::vector<float> decodedWeights = MakeDecoder<float>(weightsInfo, weights.data())->DecodeTensor(weightsShape);
+    std::vector<float> decodedBiases =
+        MakeDecoder<float>(biasesInfo, biases.data())->DecodeTensor(biasesInfo.GetShape());
+
+    std::vector<float> floatOutput(outputInfo.GetNumElements());
+    FullyConnected(inputInfo.GetShape(), decodedInput.data(), outputInfo.GetShape(), floatOutput.data(),
+                   decodedWeights.data(), decodedBiases.data(), inputSize, transposeWeights, activation);
+    std::vector<T> expected(outputInfo.GetNumElements());
+    auto outputEncoder = MakeEncoder<float>(outputInfo, expected.data());
+    for (unsigned int i = 0; i < floatOutput.size(); ++i)
+    {
+        (*outputEncoder)[i];
+        outputEncoder->Set(floatOutput[i]);
+    }
+
+    const ScopedCpuTensorHandle weightsHandle(ConstTensor(weightsInfo, weights.data()));
+    const ScopedCpuTensorHandle biasesHandle(ConstTensor(biasesInfo, biases.data()));
+    auto params = CreateQuantizedKernelParameters(inputInfo, weightsHandle, &biasesHandle, outputInfo, activation,
+                                                  outputSize);
+    BOOST_TEST_REQUIRE(params.get() != nullptr);
+
+    std::vector<T> actual(outputInfo.GetNumElements());
+    QuantizedFullyConnected(*params, inputInfo.GetShape(), input.data(), outputInfo.GetShape(), actual.data(),
+                            inputSize, transposeWeights);
+
+    // Fixed point requantization may round the other way than the float path
+    for (unsigned int i = 0; i < actual.size(); ++i)
+    {
+        BOOST_TEST(std::abs(static_cast<int>(actual[i]) - static_cast<int>(expected[i])) <= 1,
+                   "element " << i << ": " << static_cast<int>(actual[i]) << " != " << static_cast<int>(expected[i]));
+    }
+}
+
+} // anonymous namespace
+
+BOOST_AUTO_TEST_SUITE(RefConvolution)
+
+BOOST_AUTO_TEST_CASE(GemmConvolutionMatchesDirectConvolution)
+{
+    for (DataLayout dataLayout : { DataLayout::NHWC, DataLayout::NCHW })
+    {
+        Convolution2dDescriptor descriptor;
+        descriptor.m_DataLayout = dataLayout;
+        descriptor.m_BiasEnabled = true;
+        descriptor.m_PadLeft = descriptor.m_PadRight = descriptor.m_PadTop = descriptor.m_PadBottom = 1;
+        descriptor.m_StrideX = descriptor.m_StrideY = 1;
+
+        // Several blocks of output pixels per batch
+        CompareConvolution(descriptor, 2, 8, 40, 36, 5, 3);
+
+        // Strided, asymmetric padding and no bias
+        descriptor.m_BiasEnabled = false;
+        descriptor.m_StrideX = 2;
+        descriptor.m_StrideY = 3;
+        descriptor.m_PadRight = 0;
+        descriptor.m_PadBottom = 2;
+        CompareConvolution(descriptor, 1, 3, 17, 19, 4, 3);
+
+        // Dilated
+        descriptor.m_StrideX = descriptor.m_StrideY = 1;
+        descriptor.m_DilationX = 2;
+        descriptor.m_DilationY = 3;
+        CompareConvolution(descriptor, 1, 4, 15, 13, 6, 3);
+
+        // Pointwise
+        Convolution2dDescriptor pointwise;
+        pointwise.m_DataLayout = dataLayout;
+        pointwise.m_StrideX = pointwise.m_StrideY = 1;
+        CompareConvolution(pointwise, 2, 16, 7, 9, 8, 1);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(WinogradConvolutionMatchesDirectConvolution)
+{
+    for (DataLayout dataLayout : { DataLayout::NHWC, DataLayout::NCHW })
+    {
+        Convolution2dDescriptor descriptor;
+        descriptor.m_DataLayout = dataLayout;
+        descriptor.m_BiasEnabled = true;
+        descriptor.m_StrideX = descriptor.m_StrideY = 1;
+        descriptor.m_PadLeft = descriptor.m_PadRight = descriptor.m_PadTop = descriptor.m_PadBottom = 1;
+
+        // F(4x4, 3x3), with partial tiles on the edges and several blocks of tiles per batch
+        CompareConvolution(descriptor, 2, 16, 96, 90, 24, 3, 4);
+
+        // F(2x2, 3x3) on small outputs, without padding
+        descriptor.m_PadLeft = descriptor.m_PadRight = descriptor.m_PadTop = descriptor.m_PadBottom = 0;
+        CompareConvolution(descriptor, 1, 5, 8, 7, 3, 3, 2);
+
+        // Asymmetric padding without bias
+        descriptor.m_BiasEnabled = false;
+        descriptor.m_PadLeft = 2;
+        descriptor.m_PadBottom = 1;
+        CompareConvolution(descriptor, 1, 3, 12, 11, 4, 3, 4);
+    }
+
+    // Only 3x3 stride 1 convolutions without dilation go through the Winograd algorithm
+    Convolution2dDescriptor strided;
+    strided.m_StrideX = 2;
+    strided.m_StrideY = 1;
+    BOOST_TEST(GetWinogradOutputTileSize(strided, TensorShape({ 4, 3, 3, 2 }), TensorShape({ 1, 8, 8, 4 })) == 0);
+}
+
+BOOST_AUTO_TEST_CASE(GemmTransposeConvolutionMatchesDirectTransposeConvolution)
+{
+    for (DataLayout dataLayout : { DataLayout::NHWC, DataLayout::NCHW })
+    {
+        TransposeConvolution2dDescriptor descriptor;
+        descriptor.m_DataLayout = dataLayout;
+        descriptor.m_BiasEnabled = true;
+        descriptor.m_StrideX = descriptor.m_StrideY = 2;
+        CompareGemmTransposeConvolution(descriptor, 2, 6, 9, 7, 5, 3);
+
+        descriptor.m_BiasEnabled = false;
+        descriptor.m_StrideX = 3;
+        descriptor.m_StrideY = 1;
+        descriptor.m_PadLeft = descriptor.m_PadTop = 1;
+        descriptor.m_PadRight = 2;
+        CompareGemmTransposeConvolution(descriptor, 1, 3, 8, 10, 4, 4);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(QuantizedConvolutionMatchesFloatConvolution)
+{
+    ActivationDescriptor relu;
+    relu.m_Function = ActivationFunction::BoundedReLu;
+    relu.m_A = 4.0f;
+    relu.m_B = -1.0f;
+
+    for (DataLayout dataLayout : { DataLayout::NHWC, DataLayout::NCHW })
+    {
+        Convolution2dDescriptor descriptor;
+        descriptor.m_DataLayout = dataLayout;
+        descriptor.m_BiasEnabled = true;
+        descriptor.m_PadLeft = descriptor.m_PadRight = descriptor.m_PadTop = descriptor.m_PadBottom = 1;
+        descriptor.m_StrideX = descriptor.m_StrideY = 1;
+
+        CompareQuantizedConvolution(descriptor, false, false, 6, 9, 8, 5, 3);
+        CompareQuantizedConvolution(descriptor, false, true, 6, 9, 8, 5, 3, &relu);
+        CompareQuantizedConvolution(descriptor, true, false, 3, 7, 9, 2, 3);
+
+        descriptor.m_StrideX = 2;
+        descriptor.m_PadRight = 0;
+        CompareQuantizedConvolution(descriptor, true, true, 5, 8, 11, 1, 3, &relu);
+    }
+
+    // Activations other than ReLu and BoundedReLu are left to the float path
+    ActivationDescriptor sigmoid;
+    sigmoid.m_Function = ActivationFunction::Sigmoid;
+    const TensorInfo info({ 1, 4, 4, 2 }, DataType::QAsymmU8, 0.1f, 128);
+    const TensorInfo weightsInfo({ 2, 1, 1, 2 }, DataType::QAsymmU8, 0.1f, 128);
+    std::vector<uint8_t> weights(weightsInfo.GetNumElements(), 130);
+    const ScopedCpuTensorHandle weightsHandle(ConstTensor(weightsInfo, weights.data()));
+    BOOST_TEST(CreateQuantizedKernelParameters(info, weightsHandle, nullptr, info, nullptr, 2).get() != nullptr);
+    BOOST_TEST(CreateQuantizedKernelParameters(info, weightsHandle, nullptr, info, &sigmoid, 2).get() == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(QuantizedFullyConnectedMatchesFloatFullyConnected)
+{
+    ActivationDescriptor relu;
+    relu.m_Function = ActivationFunction::BoundedReLu;
+    relu.m_A = 4.0f;
+    relu.m_B = -1.0f;
+
+    for (bool transposeWeights : { false, true })
+    {
+        CompareQuantizedFullyConnected<uint8_t>(transposeWeights, 3, 37, 11);
+        CompareQuantizedFullyConnected<uint8_t>(transposeWeights, 2, 20, 9, &relu);
+        CompareQuantizedFullyConnected<int8_t>(transposeWeights, 3, 29, 7);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(QuantizedKernelRejectsAccumulatorOverflow)
+{
+    // 32000 products of 255 by 255 fit in an int32 accumulator, but not together with a bias of 10^8
+    constexpr unsigned int inputSize = 32000;
+    const TensorInfo inputInfo(TensorShape({ 1, inputSize }), DataType::QAsymmU8, 0.01f, 0);
+    const TensorInfo outputInfo(TensorShape({ 1, 1 }), DataType::QAsymmU8, 1.0f, 0);
+    const TensorInfo weightsInfo(TensorShape({ inputSize, 1 }), DataType::QAsymmU8, 0.01f, 0);
+    const TensorInfo biasesInfo(TensorShape({ 1 }), DataType::Signed32, 0.0001f, 0);
+
+    std::vector<uint8_t> weights(inputSize, 255);
+    const ScopedCpuTensorHandle weightsHandle(ConstTensor(weightsInfo, weights.data()));
+    std::vector<int32_t> smallBias = { 1000 };
+    const ScopedCpuTensorHandle smallBiasHandle(ConstTensor(biasesInfo, smallBias.data()));
+    std::vector<int32_t> largeBias = { 100000000 };
+    const ScopedCpuTensorHandle largeBiasHandle(ConstTensor(biasesInfo, largeBias.data()));
+
+    BOOST_TEST(CreateQuantizedKernelParameters(inputInfo, weightsHandle, &smallBiasHandle, outputInfo, nullptr, 1)
+               .get() != nullptr);
+    BOOST_TEST(CreateQuantizedKernelParameters(inputInfo, weightsHandle, &largeBiasHandle, outputInfo, nullptr, 1)
+               .get() == nullptr);
+
+    // Zero points away from the middle of the range widen the centered inputs and weights
+    const TensorInfo offsetInputInfo(TensorShape({ 1, inputSize }), DataType::QAsymmU8, 0.01f, -100);
+    BOOST_TEST(CreateQuantizedKernelParameters(offsetInputInfo, weightsHandle, &smallBiasHandle, outputInfo, nullptr,
+                                               1).get() == nullptr);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -48,4 +48,70 @@ BOOST_AUTO_TEST_CASE(ManageTwoThings)
     memoryManager.Release();
 }
 
+BOOST_AUTO_TEST_CASE(ReuseMemoryOfEndedLifetimes)
+{
+    RefMemoryManager memoryManager;
+
+    // A chain of layers, where each output is consumed by the next layer only: 1 -> 2 -> 3 -> 4
+    Pool* pool1 = memoryManager.Manage(1000);
+    Pool* pool2 = memoryManager.Manage(300);
+    memoryManager.Allocate(pool1);
+    Pool* pool3 = memoryManager.Manage(1000);
+    memoryManager.Allocate(pool2);
+    Pool* pool4 = memoryManager.Manage(200);
+    memoryManager.Allocate(pool3);
+    memoryManager.Allocate(pool4);
+
+    memoryManager.Acquire();
+
+    // Only two consecutive tensors are alive at any time, so the largest two pairs bound the memory used
+    BOOST_CHECK_EQUAL(memoryManager.GetPlannedPeakMemory(), 1024u + 320u);
+    BOOST_CHECK(memoryManager.GetPointer(pool1) == memoryManager.GetPointer(pool3));
+
+    for (Pool* pool : { pool1, pool2, pool3, pool4 })
+    {
+        BOOST_CHECK(reinterpret_cast<size_t>(memoryManager.GetPointer(pool)) % RefMemoryManager::Alignment == 0);
+    }
+
+    // Tensors alive at the same time do not overlap
+    auto Overlap = [&](Pool* lhs, Pool* rhs)
+    {
+        const char* lhsBegin = static_cast<const char*>(memoryManager.GetPointer(lhs));
+        const char* rhsBegin = static_cast<const char*>(memoryManager.GetPointer(rhs));
+        return lhsBegin < rhsBegin + rhs->GetSize() && rhsBegin < lhsBegin + lhs->GetSize();
+    };
+    BOOST_CHECK(!Overlap(pool1, pool2));
+    BOOST_CHECK(!Overlap(pool2, pool3));
+    BOOST_CHECK(!Overlap(pool3, pool4));
+
+    memoryManager.Release();
+}
+
+BOOST_AUTO_TEST_CASE(InPlaceOutputSharesMemoryOfEndedInput)
+{
+    RefMemoryManager memoryManager;
+
+    // Tensors 2, 3 and 4 are produced in place of tensors 1, 2 and 3, but tensors 1 and 2 are still read after
+    // tensors 3 and 4 are produced. Only tensor 4 can share the memory of its input.
+    Pool* pool1 = memoryManager.Manage(100);
+    Pool* pool2 = memoryManager.Manage(100);
+    memoryManager.AllowInPlace(pool2, pool1);
+    Pool* pool3 = memoryManager.Manage(100);
+    memoryManager.AllowInPlace(pool3, pool2);
+    memoryManager.Allocate(pool1);
+    Pool* pool4 = memoryManager.Manage(100);
+    memoryManager.AllowInPlace(pool4, pool3);
+    memoryManager.Allocate(pool2);
+    memoryManager.Allocate(pool3);
+    memoryManager.Allocate(pool4);
+
+    memoryManager.Acquire();
+
+    BOOST_CHECK(memoryManager.GetPointer(pool1) != memoryManager.GetPointer(pool2));
+    BOOST_CHECK(memoryManager.GetPointer(pool2) != memoryManager.GetPointer(pool3));
+    BOOST_CHECK(memoryManager.GetPointer(pool3) == memoryManager.GetPointer(pool4));
+
+    memoryManager.Release();
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -6,11 +6,16 @@
 #include <Graph.hpp>
 #include <Network.hpp>
 
+#include <reference/RefBackend.hpp>
 #include <reference/RefWorkloadFactory.hpp>
 
+#include <armnn/utility/PolymorphicDowncast.hpp>
+
 #include <boost/test/unit_test.hpp>
 #include <test/GraphUtils.hpp>
 
+#include <cstring>
+
 BOOST_AUTO_TEST_SUITE(RefOptimizedNetwork)
 
 BOOST_AUTO_TEST_CASE(OptimizeValidateCpuRefWorkloads)
@@ -193,4 +198,203 @@ BOOST_AUTO_TEST_CASE(DebugTestOnCpuRef)
     BOOST_TEST(GraphHasNamedLayer(graph, "OutputLayer"));
 }
 
+BOOST_AUTO_TEST_CASE(FuseActivationIntoConvolution2dOnCpuRef)
+{
+    using namespace armnn;
+
+    IRuntime::CreationOptions options;
+    IRuntimePtr runtime(IRuntime::Create(options));
+
+    INetworkPtr net(INetwork::Create());
+
+    Convolution2dDescriptor convolutionDescriptor;
+    convolutionDescriptor.m_StrideX    = 1;
+    convolutionDescriptor.m_StrideY    = 1;
+    convolutionDescriptor.m_DataLayout = DataLayout::NCHW;
+
+    std::vector<float> weightsData = { 1.0f, 2.0f, 3.0f, 4.0f };
+    ConstTensor weights(TensorInfo({ 1, 1, 2, 2 }, DataType::Float32), weightsData);
+
+    IConnectableLayer* input = net->AddInputLayer(0, "input");
+    IConnectableLayer* convolution =
+        net->AddConvolution2dLayer(convolutionDescriptor, weights, EmptyOptional(), "convolution");
+    IConnectableLayer* activation =
+        net->AddActivationLayer(ActivationDescriptor(ActivationFunction::BoundedReLu, 4.0f, -2.0f), "activation");
+    IConnectableLayer* output = net->AddOutputLayer(0, "output");
+
+    input->GetOutputSlot(0).Connect(convolution->GetInputSlot(0));
+    convolution->GetOutputSlot(0).Connect(activation->GetInputSlot(0));
+    activation->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+
+    input->GetOutputSlot(0).SetTensorInfo(TensorInfo({ 1, 1, 3, 3 }, DataType::Float32));
+    convolution->GetOutputSlot(0).SetTensorInfo(TensorInfo({ 1, 1, 2, 2 }, DataType::Float32));
+    activation->GetOutputSlot(0).SetTensorInfo(TensorInfo({ 1, 1, 2, 2 }, DataType::Float32));
+
+    std::vector<BackendId> backends = { Compute::CpuRef };
+    IOptimizedNetworkPtr optNet = Optimize(*net, backends, runtime->GetDeviceSpec());
+
+    // The activation is carried by the convolution which replaces both layers
+    const Graph& graph = static_cast<OptimizedNetwork*>(optNet.get())->GetGraph();
+    BOOST_TEST(graph.GetNumLayers() == 3);
+    BOOST_TEST(GraphHasNamedLayer(graph, "fused-activation-into-convolution"));
+    for (auto&& layer : graph)
+    {
+        BOOST_TEST((layer->GetType() != LayerType::Convolution2d ||
+                    layer->GetAdditionalInformation<ActivationDescriptor>() != nullptr));
+    }
+
+    NetworkId netId;
+    BOOST_TEST(runtime->LoadNetwork(netId, std::move(optNet)) == Status::Success);
+
+    // Without the activation the convolution gives { 5, -5, -5, 1 }
+    std::vector<float> inputData = { 1.0f, -2.0f, 3.0f, -4.0f, 5.0f, -6.0f, 7.0f, -8.0f, 8.0f };
+    std::vector<float> outputData(4);
+    std::vector<float> expectedOutput = { 4.0f, -2.0f, -2.0f, 1.0f };
+
+    InputTensors inputTensors
+    {
+        { 0, ConstTensor(runtime->GetInputTensorInfo(netId, 0), inputData.data()) }
+    };
+    OutputTensors outputTensors
+    {
+        { 0, Tensor(runtime->GetOutputTensorInfo(netId, 0), outputData.data()) }
+    };
+    BOOST_TEST(runtime->EnqueueWorkload(netId, inputTensors, outputTensors) == Status::Success);
+    BOOST_TEST(outputData == expectedOutput, boost::test_tools::per_element());
+}
+
+BOOST_AUTO_TEST_CASE(FuseElementwiseChainOnCpuRef)
+{
+    using namespace armnn;
+
+    IRuntime::CreationOptions options;
+    IRuntimePtr runtime(IRuntime::Create(options));
+
+    INetworkPtr net(INetwork::Create());
+
+    // relu(input0 * scale + input1), with the scale broadcast along the channels
+    IConnectableLayer* input0 = net->AddInputLayer(0, "input0");
+    IConnectableLayer* scale = net->AddInputLayer(1, "scale");
+    IConnectableLayer* input1 = net->AddInputLayer(2, "input1");
+    IConnectableLayer* multiplication = net->AddMultiplicationLayer("multiplication");
+    IConnectableLayer* addition = net->AddAdditionLayer("addition");
+    IConnectableLayer* activation = net->AddActivationLayer(ActivationDescriptor(ActivationFunction::ReLu), "activation");
+    IConnectableLayer* output = net->AddOutputLayer(0, "output");
+
+    input0->GetOutputSlot(0).Connect(multiplication->GetInputSlot(0));
+    scale->GetOutputSlot(0).Connect(multiplication->GetInputSlot(1));
+    multiplication->GetOutputSlot(0).Connect(addition->GetInputSlot(0));
+    input1->GetOutputSlot(0).Connect(addition->GetInputSlot(1));
+    addition->GetOutputSlot(0).Connect(activation->GetInputSlot(0));
+    activation->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+
+    const TensorInfo info({ 1, 2, 2, 2 }, DataType::Float32);
+    const TensorInfo scaleInfo({ 1, 2, 1, 1 }, DataType::Float32);
+    input0->GetOutputSlot(0).SetTensorInfo(info);
+    scale->GetOutputSlot(0).SetTensorInfo(scaleInfo);
+    input1->GetOutputSlot(0).SetTensorInfo(info);
+    multiplication->GetOutputSlot(0).SetTensorInfo(info);
+    addition->GetOutputSlot(0).SetTensorInfo(info);
+    activation->GetOutputSlot(0).SetTensorInfo(info);
+
+    std::vector<BackendId> backends = { Compute::CpuRef };
+    IOptimizedNetworkPtr optNet = Optimize(*net, backends, runtime->GetDeviceSpec());
+
+    // The three elementwise layers are replaced by a single layer
+    const Graph& graph = static_cast<OptimizedNetwork*>(optNet.get())->GetGraph();
+    BOOST_TEST(graph.GetNumLayers() == 5);
+    BOOST_TEST(GraphHasNamedLayer(graph, "fused-elementwise-activation"));
+
+    NetworkId netId;
+    BOOST_TEST(runtime->LoadNetwork(netId, std::move(optNet)) == Status::Success);
+
+    std::vector<float> input0Data = { 1.0f, -2.0f, 3.0f, -4.0f, 5.0f, -6.0f, 7.0f, -8.0f };
+    std::vector<float> scaleData = { 2.0f, -1.0f };
+    std::vector<float> input1Data = { 1.0f, 1.0f, 1.0f, 1.0f, -1.0f, -1.0f, -1.0f, -1.0f };
+    std::vector<float> outputData(8);
+    std::vector<float> expectedOutput = { 3.0f, 0.0f, 7.0f, 0.0f, 0.0f, 5.0f, 0.0f, 7.0f };
+
+    InputTensors inputTensors
+    {
+        { 0, ConstTensor(runtime->GetInputTensorInfo(netId, 0), input0Data.data()) },
+        { 1, ConstTensor(runtime->GetInputTensorInfo(netId, 1), scaleData.data()) },
+        { 2, ConstTensor(runtime->GetInputTensorInfo(netId, 2), input1Data.data()) }
+    };
+    OutputTensors outputTensors
+    {
+        { 0, Tensor(runtime->GetOutputTensorInfo(netId, 0), outputData.data()) }
+    };
+    BOOST_TEST(runtime->EnqueueWorkload(netId, inputTensors, outputTensors) == Status::Success);
+    BOOST_TEST(outputData == expectedOutput, boost::test_tools::per_element());
+}
+
+BOOST_AUTO_TEST_CASE(SerializeFusedElementwiseChainOnCpuRef)
+{
+    using namespace armnn;
+
+    IRuntime::CreationOptions options;
+    IRuntimePtr runtime(IRuntime::Create(options));
+
+    INetworkPtr net(INetwork::Create());
+
+    // sqrt(input0 + input1) * input0
+    IConnectableLayer* input0 = net->AddInputLayer(0, "input0");
+    IConnectableLayer* input1 = net->AddInputLayer(1, "input1");
+    IConnectableLayer* addition = net->AddAdditionLayer("addition");
+    IConnectableLayer* sqrt = net->AddElementwiseUnaryLayer(ElementwiseUnaryDescriptor(UnaryOperation::Sqrt), "sqrt");
+    IConnectableLayer* multiplication = net->AddMultiplicationLayer("multiplication");
+    IConnectableLayer* output = net->AddOutputLayer(0, "output");
+
+    input0->GetOutputSlot(0).Connect(addition->GetInputSlot(0));
+    input1->GetOutputSlot(0).Connect(addition->GetInputSlot(1));
+    addition->GetOutputSlot(0).Connect(sqrt->GetInputSlot(0));
+    sqrt->GetOutputSlot(0).Connect(multiplication->GetInputSlot(0));
+    input0->GetOutputSlot(0).Connect(multiplication->GetInputSlot(1));
+    multiplication->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+
+    const TensorInfo info({ 1, 4 }, DataType::Float32);
+    input0->GetOutputSlot(0).SetTensorInfo(info);
+    input1->GetOutputSlot(0).SetTensorInfo(info);
+    addition->GetOutputSlot(0).SetTensorInfo(info);
+    sqrt->GetOutputSlot(0).SetTensorInfo(info);
+    multiplication->GetOutputSlot(0).SetTensorInfo(info);
+
+    std::vector<BackendId> backends = { Compute::CpuRef };
+    IOptimizedNetworkPtr optNet = Optimize(*net, backends, runtime->GetDeviceSpec());
+
+    const Graph& graph = static_cast<OptimizedNetwork*>(optNet.get())->GetGraph();
+    const PreCompiledLayer* fusedLayer = nullptr;
+    for (const Layer* layer : graph)
+    {
+        if (layer->GetType() == LayerType::PreCompiled)
+        {
+            fusedLayer = PolymorphicDowncast<const PreCompiledLayer*>(layer);
+        }
+    }
+    BOOST_REQUIRE(fusedLayer != nullptr);
+
+    // The count of inputs and of instructions, then three instructions of seven words
+    RefBackend backend;
+    std::vector<uint8_t> data = backend.SerializePreCompiledObject(*fusedLayer);
+    BOOST_TEST(data.size() == (2 + 3 * 7) * sizeof(uint32_t));
+
+    Graph deserializedGraph;
+    PreCompiledLayer* deserializedLayer =
+        deserializedGraph.AddLayer<PreCompiledLayer>(PreCompiledDescriptor(3, 1), "deserialized");
+    backend.DeserializePreCompiledObject(*deserializedLayer, data);
+    BOOST_TEST(backend.SerializePreCompiledObject(*deserializedLayer) == data, boost::test_tools::per_element());
+
+    // Programs whose size doesn't match their number of instructions, or whose instructions read registers they
+    // don't follow, are rejected
+    std::vector<uint8_t> truncatedData(data.begin(), data.end() - 1);
+    BOOST_CHECK_THROW(backend.DeserializePreCompiledObject(*deserializedLayer, truncatedData),
+                      InvalidArgumentException);
+
+    std::vector<uint8_t> forwardReadData = data;
+    const uint32_t resultOfLastInstruction = 4;
+    std::memcpy(forwardReadData.data() + 3 * sizeof(uint32_t), &resultOfLastInstruction, sizeof(uint32_t));
+    BOOST_CHECK_THROW(backend.DeserializePreCompiledObject(*deserializedLayer, forwardReadData),
+                      InvalidArgumentException);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
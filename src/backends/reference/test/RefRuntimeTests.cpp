@@ -9,8 +9,121 @@
 
 #include <backendsCommon/test/RuntimeTestImpl.hpp>
 
+#include <reference/workloads/RefThreadPool.hpp>
+
+#include <armnn/INetwork.hpp>
+#include <armnn/IRuntime.hpp>
+
 #include <boost/test/unit_test.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <numeric>
+#include <vector>
+
+namespace
+{
+
+/// Runs Input -> Convolution2d -> Pooling2d -> Addition(Input) -> FullyConnected -> Softmax -> Output on CpuRef,
+/// large enough for every kernel to be split over the threads of the pool
+std::vector<float> RunThreadedReferenceNetwork(int numberOfThreads)
+{
+    using namespace armnn;
+
+    IRuntime::CreationOptions options;
+    options.m_BackendOptions.emplace_back(BackendOptions{ "CpuRef", { { "NumberOfThreads", numberOfThreads } } });
+    IRuntimePtr runtime(IRuntime::Create(options));
+
+    const unsigned int height   = 32;
+    const unsigned int width    = 32;
+    const unsigned int channels = 16;
+    const unsigned int classes  = 10;
+
+    TensorInfo imageInfo({ 1, height, width, channels }, DataType::Float32);
+    TensorInfo flatInfo({ 1, height * width * channels }, DataType::Float32);
+    TensorInfo outputInfo({ 1, classes }, DataType::Float32);
+
+    auto makeData = [](unsigned int size, float scale)
+    {
+        std::vector<float> data(size);
+        for (unsigned int i = 0; i < size; ++i)
+        {
+            data[i] = scale * static_cast<float>(static_cast<int>(i % 17) - 8);
+        }
+        return data;
+    };
+
+    std::vector<float> convWeights = makeData(channels * 3 * 3 * channels, 0.01f);
+    std::vector<float> fcWeights = makeData(height * width * channels * classes, 0.0001f);
+
+    INetworkPtr net(INetwork::Create());
+    IConnectableLayer* input = net->AddInputLayer(0);
+
+    Convolution2dDescriptor convDesc;
+    convDesc.m_PadLeft = convDesc.m_PadRight = convDesc.m_PadTop = convDesc.m_PadBottom = 1;
+    convDesc.m_StrideX = convDesc.m_StrideY = 1;
+    convDesc.m_DataLayout = DataLayout::NHWC;
+    IConnectableLayer* conv = net->AddConvolution2dLayer(
+        convDesc, ConstTensor(TensorInfo({ channels, 3, 3, channels }, DataType::Float32), convWeights),
+        EmptyOptional());
+
+    Pooling2dDescriptor poolDesc;
+    poolDesc.m_PoolType = PoolingAlgorithm::Average;
+    poolDesc.m_PoolWidth = poolDesc.m_PoolHeight = 3;
+    poolDesc.m_PadLeft = poolDesc.m_PadRight = poolDesc.m_PadTop = poolDesc.m_PadBottom = 1;
+    poolDesc.m_StrideX = poolDesc.m_StrideY = 1;
+    poolDesc.m_DataLayout = DataLayout::NHWC;
+    IConnectableLayer* pool = net->AddPooling2dLayer(poolDesc);
+
+    IConnectableLayer* add = net->AddAdditionLayer();
+    IConnectableLayer* reshape = net->AddReshapeLayer(ReshapeDescriptor(flatInfo.GetShape()));
+
+    IConnectableLayer* fc = net->AddFullyConnectedLayer(
+        FullyConnectedDescriptor(),
+        ConstTensor(TensorInfo({ height * width * channels, classes }, DataType::Float32), fcWeights),
+        EmptyOptional());
+
+    IConnectableLayer* softmax = net->AddSoftmaxLayer(SoftmaxDescriptor());
+    IConnectableLayer* output = net->AddOutputLayer(0);
+
+    input->GetOutputSlot(0).Connect(conv->GetInputSlot(0));
+    conv->GetOutputSlot(0).Connect(pool->GetInputSlot(0));
+    pool->GetOutputSlot(0).Connect(add->GetInputSlot(0));
+    input->GetOutputSlot(0).Connect(add->GetInputSlot(1));
+    add->GetOutputSlot(0).Connect(reshape->GetInputSlot(0));
+    reshape->GetOutputSlot(0).Connect(fc->GetInputSlot(0));
+    fc->GetOutputSlot(0).Connect(softmax->GetInputSlot(0));
+    softmax->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+
+    input->GetOutputSlot(0).SetTensorInfo(imageInfo);
+    conv->GetOutputSlot(0).SetTensorInfo(imageInfo);
+    pool->GetOutputSlot(0).SetTensorInfo(imageInfo);
+    add->GetOutputSlot(0).SetTensorInfo(imageInfo);
+    reshape->GetOutputSlot(0).SetTensorInfo(flatInfo);
+    fc->GetOutputSlot(0).SetTensorInfo(outputInfo);
+    softmax->GetOutputSlot(0).SetTensorInfo(outputInfo);
+
+    std::vector<BackendId> backends = { Compute::CpuRef };
+    NetworkId netId;
+    BOOST_TEST(runtime->LoadNetwork(netId, Optimize(*net, backends, runtime->GetDeviceSpec())) == Status::Success);
+
+    std::vector<float> inputData = makeData(imageInfo.GetNumElements(), 0.1f);
+    std::vector<float> outputData(outputInfo.GetNumElements());
+    InputTensors inputTensors
+    {
+        { 0, ConstTensor(runtime->GetInputTensorInfo(netId, 0), inputData.data()) }
+    };
+    OutputTensors outputTensors
+    {
+        { 0, Tensor(runtime->GetOutputTensorInfo(netId, 0), outputData.data()) }
+    };
+    BOOST_TEST(runtime->EnqueueWorkload(netId, inputTensors, outputTensors) == Status::Success);
+
+    return outputData;
+}
+
+} // anonymous namespace
+
 BOOST_AUTO_TEST_SUITE(RefRuntime)
 
 #ifdef ARMNN_LEAK_CHECKING_ENABLED
@@ -43,4 +156,117 @@ BOOST_AUTO_TEST_CASE(RuntimeMemoryLeaksCpuRef)
 }
 #endif
 
+BOOST_AUTO_TEST_CASE(RefThreadPoolProcessesEveryIndexOnce)
+{
+    armnn::RefThreadPool& threadPool = armnn::RefThreadPool::GetInstance();
+    threadPool.SetNumberOfThreads(4);
+
+    std::vector<std::atomic<unsigned int>> counts(1000);
+    threadPool.ParallelFor(3, 997, 7, [&](unsigned int begin, unsigned int end)
+        {
+            // Nested calls run on the calling thread
+            threadPool.ParallelFor(begin, end, 1, [&](unsigned int nestedBegin, unsigned int nestedEnd)
+                {
+                    for (unsigned int i = nestedBegin; i < nestedEnd; ++i)
+                    {
+                        ++counts[i];
+                    }
+                });
+        });
+
+    for (unsigned int i = 0; i < counts.size(); ++i)
+    {
+        BOOST_TEST(counts[i].load() == ((i >= 3 && i < 997) ? 1u : 0u));
+    }
+
+    BOOST_CHECK_THROW(threadPool.ParallelFor(0, 100, 1, [](unsigned int begin, unsigned int)
+        {
+            if (begin > 50)
+            {
+                throw armnn::Exception("Chunk failed");
+            }
+        }), armnn::Exception);
+
+    threadPool.SetNumberOfThreads(1);
+    BOOST_TEST(threadPool.GetNumberOfThreads() == 1);
+}
+
+BOOST_AUTO_TEST_CASE(RefNumberOfThreadsOption)
+{
+    // The kernels split over several threads compute exactly what they compute on a single thread
+    std::vector<float> singleThreadOutput = RunThreadedReferenceNetwork(1);
+    std::vector<float> multiThreadOutput = RunThreadedReferenceNetwork(4);
+    BOOST_TEST(armnn::RefThreadPool::GetInstance().GetNumberOfThreads() == 4);
+    BOOST_TEST(multiThreadOutput == singleThreadOutput, boost::test_tools::per_element());
+    BOOST_TEST(std::accumulate(multiThreadOutput.begin(), multiThreadOutput.end(), 0.0f) ==
+               1.0f, boost::test_tools::tolerance(0.0001f));
+
+    armnn::IRuntime::CreationOptions options;
+    options.m_BackendOptions.emplace_back(armnn::BackendOptions{ "CpuRef", { { "NumberOfThreads", 0 } } });
+    BOOST_CHECK_THROW(armnn::IRuntime::Create(options), armnn::InvalidArgumentException);
+
+    armnn::RefThreadPool::GetInstance().SetNumberOfThreads(1);
+}
+
+BOOST_AUTO_TEST_CASE(RefInPlaceWorkloadsKeepLiveInputs)
+{
+    using namespace armnn;
+
+    IRuntime::CreationOptions options;
+    IRuntimePtr runtime(IRuntime::Create(options));
+
+    // x = ReLu(input) can run in place of the input, but y = BoundedReLu(x) cannot run in place of x, which the
+    // Addition reads after it. The Addition and the final Linear activation then run in place again.
+    INetworkPtr net(INetwork::Create());
+    IConnectableLayer* input = net->AddInputLayer(0);
+    IConnectableLayer* relu = net->AddActivationLayer(ActivationDescriptor(ActivationFunction::ReLu));
+    IConnectableLayer* boundedRelu =
+        net->AddActivationLayer(ActivationDescriptor(ActivationFunction::BoundedReLu, 1.0f, 0.0f));
+    IConnectableLayer* add = net->AddAdditionLayer();
+    IConnectableLayer* linear = net->AddActivationLayer(ActivationDescriptor(ActivationFunction::Linear, -2.0f, 1.0f));
+    IConnectableLayer* output = net->AddOutputLayer(0);
+
+    input->GetOutputSlot(0).Connect(relu->GetInputSlot(0));
+    relu->GetOutputSlot(0).Connect(boundedRelu->GetInputSlot(0));
+    relu->GetOutputSlot(0).Connect(add->GetInputSlot(0));
+    boundedRelu->GetOutputSlot(0).Connect(add->GetInputSlot(1));
+    add->GetOutputSlot(0).Connect(linear->GetInputSlot(0));
+    linear->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+
+    TensorInfo info({ 2, 3, 4, 5 }, DataType::Float32);
+    for (IConnectableLayer* layer : { input, relu, boundedRelu, add, linear })
+    {
+        layer->GetOutputSlot(0).SetTensorInfo(info);
+    }
+
+    std::vector<BackendId> backends = { Compute::CpuRef };
+    NetworkId netId;
+    BOOST_TEST(runtime->LoadNetwork(netId, Optimize(*net, backends, runtime->GetDeviceSpec())) == Status::Success);
+
+    std::vector<float> inputData(info.GetNumElements());
+    std::vector<float> expectedOutput(info.GetNumElements());
+    for (unsigned int i = 0; i < inputData.size(); ++i)
+    {
+        inputData[i] = 0.1f * static_cast<float>(static_cast<int>(i % 31) - 15);
+        const float x = std::max(inputData[i], 0.0f);
+        expectedOutput[i] = -2.0f * (x + std::min(x, 1.0f)) + 1.0f;
+    }
+
+    // The network input is copied into memory the workloads overwrite, so running again gives the same results
+    for (int run = 0; run < 2; ++run)
+    {
+        std::vector<float> outputData(info.GetNumElements());
+        InputTensors inputTensors
+        {
+            { 0, ConstTensor(runtime->GetInputTensorInfo(netId, 0), inputData.data()) }
+        };
+        OutputTensors outputTensors
+        {
+            { 0, Tensor(runtime->GetOutputTensorInfo(netId, 0), outputData.data()) }
+        };
+        BOOST_TEST(runtime->EnqueueWorkload(netId, inputTensors, outputTensors) == Status::Success);
+        BOOST_TEST(outputData == expectedOutput, boost::test_tools::per_element());
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
\ No newline at end of file
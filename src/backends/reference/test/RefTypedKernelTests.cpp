@@ -0,0 +1,123 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include <reference/workloads/Decoders.hpp>
+#include <reference/workloads/ElementwiseFunction.hpp>
+#include <reference/workloads/Encoders.hpp>
+#include <reference/workloads/TypedConversion.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <utility>
+#include <vector>
+
+namespace
+{
+
+std::vector<float> MakeValues(unsigned int numElements)
+{
+    std::vector<float> values(numElements);
+    for (unsigned int i = 0; i < numElements; ++i)
+    {
+        values[i] = static_cast<float>(static_cast<int>(i * 37u % 101u) - 50) * 0.173f;
+    }
+    return values;
+}
+
+/// Checks that ConvertFromFloat() and ConvertToFloat() give the same results as the Encoder and Decoder of the
+/// data type, for values in and out of its range.
+void CheckConversionMatchesIterators(const armnn::TensorInfo& info, unsigned int elementSize)
+{
+    const std::vector<float> values = MakeValues(info.GetNumElements());
+
+    std::vector<uint8_t> converted(info.GetNumElements() * elementSize);
+    std::vector<uint8_t> encoded(converted.size());
+    armnn::ConvertFromFloat(info, values.data(), converted.data());
+    std::unique_ptr<armnn::Encoder<float>> encoder = armnn::MakeEncoder<float>(info, encoded.data());
+    for (unsigned int i = 0; i < values.size(); ++i)
+    {
+        (*encoder)[i];
+        encoder->Set(values[i]);
+    }
+    BOOST_CHECK_EQUAL_COLLECTIONS(converted.begin(), converted.end(), encoded.begin(), encoded.end());
+
+    std::vector<float> result(values.size());
+    armnn::ConvertToFloat(info, converted.data(), result.data());
+    const std::vector<float> decoded = armnn::MakeDecoder<float>(info, converted.data())->DecodeTensor(info.GetShape());
+    BOOST_CHECK_EQUAL_COLLECTIONS(result.begin(), result.end(), decoded.begin(), decoded.end());
+}
+
+} // anonymous namespace
+
+BOOST_AUTO_TEST_SUITE(RefTypedKernels)
+
+BOOST_AUTO_TEST_CASE(TypedConversionMatchesDecodersAndEncoders)
+{
+    const armnn::TensorShape shape({ 2, 3, 17 });
+
+    CheckConversionMatchesIterators(armnn::TensorInfo(shape, armnn::DataType::Float32), 4);
+    CheckConversionMatchesIterators(armnn::TensorInfo(shape, armnn::DataType::Float16), 2);
+    CheckConversionMatchesIterators(armnn::TensorInfo(shape, armnn::DataType::BFloat16), 2);
+    CheckConversionMatchesIterators(armnn::TensorInfo(shape, armnn::DataType::QAsymmU8, 0.05f, 128), 1);
+    CheckConversionMatchesIterators(armnn::TensorInfo(shape, armnn::DataType::QAsymmS8, 0.07f, -3), 1);
+    CheckConversionMatchesIterators(armnn::TensorInfo(shape, armnn::DataType::QSymmS8, 0.03f, 0), 1);
+    CheckConversionMatchesIterators(armnn::TensorInfo(shape, armnn::DataType::QSymmS16, 0.001f, 0), 2);
+    CheckConversionMatchesIterators(armnn::TensorInfo(shape, armnn::DataType::Signed32), 4);
+
+    // Tensors quantized per axis go through the decoder and the encoder
+    armnn::TensorInfo perAxisInfo(shape, armnn::DataType::QSymmS8, std::vector<float>{ 0.1f, 0.2f, 0.3f }, 1);
+    CheckConversionMatchesIterators(perAxisInfo, 1);
+}
+
+BOOST_AUTO_TEST_CASE(DirectElementwiseMatchesDecoderPath)
+{
+    // Broadcasts along every kind of dimension: inner, outer and both inputs at once
+    const std::vector<std::pair<armnn::TensorShape, armnn::TensorShape>> shapes =
+    {
+        { armnn::TensorShape({ 2, 3, 4, 5 }), armnn::TensorShape({ 2, 3, 4, 5 }) },
+        { armnn::TensorShape({ 2, 3, 4, 5 }), armnn::TensorShape({ 1, 1, 1, 5 }) },
+        { armnn::TensorShape({ 1, 3, 1, 1 }), armnn::TensorShape({ 2, 3, 4, 5 }) },
+        { armnn::TensorShape({ 2, 1, 4, 1 }), armnn::TensorShape({ 1, 3, 1, 5 }) },
+    };
+
+    for (const auto& inShapes : shapes)
+    {
+        armnn::TensorShape outShape(4);
+        for (unsigned int i = 0; i < 4; ++i)
+        {
+            outShape[i] = std::max(inShapes.first[i], inShapes.second[i]);
+        }
+
+        const armnn::TensorInfo inInfo0(inShapes.first, armnn::DataType::Float32);
+        const armnn::TensorInfo inInfo1(inShapes.second, armnn::DataType::Float32);
+        const armnn::TensorInfo outInfo(outShape, armnn::DataType::Float32);
+
+        const std::vector<float> input0 = MakeValues(inInfo0.GetNumElements());
+        std::vector<float> input1 = MakeValues(inInfo1.GetNumElements());
+        std::reverse(input1.begin(), input1.end());
+
+        std::vector<float> expected(outInfo.GetNumElements());
+        armnn::ElementwiseBinaryFunction<std::minus<float>>(inShapes.first,
+                                                            inShapes.second,
+                                                            outShape,
+                                                            *armnn::MakeDecoder<float>(inInfo0, input0.data()),
+                                                            *armnn::MakeDecoder<float>(inInfo1, input1.data()),
+                                                            *armnn::MakeEncoder<float>(outInfo, expected.data()));
+
+        std::vector<float> output(outInfo.GetNumElements());
+        armnn::ElementwiseBinaryFunction<std::minus<float>>(inShapes.first,
+                                                            inShapes.second,
+                                                            outShape,
+                                                            input0.data(),
+                                                            input1.data(),
+                                                            output.data());
+
+        BOOST_CHECK_EQUAL_COLLECTIONS(output.begin(), output.end(), expected.begin(), expected.end());
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
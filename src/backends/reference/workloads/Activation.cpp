@@ -4,93 +4,162 @@
 //
 
 #include "Activation.hpp"
+#include "RefThreadPool.hpp"
 
+#include <algorithm>
 #include <cmath>
+#include <type_traits>
 
 namespace armnn
 {
 
-float Activation(float in,
-                 ActivationFunction function,
-                 float a,
-                 float b)
+namespace
+{
+
+/// Minimum number of elements for an activation to be split over the threads of the pool
+constexpr unsigned int ParallelMinElements = 16384;
+
+template <ActivationFunction Function>
+using ActivationTag = std::integral_constant<ActivationFunction, Function>;
+
+/// Computes a single activation function, known at compile time so that loops calling it can be vectorised.
+template <ActivationFunction Function>
+inline float ActivationOp(float in, float a, float b);
+
+template <>
+inline float ActivationOp<ActivationFunction::Linear>(float in, float a, float b)
+{
+    return a * in + b;
+}
+
+template <>
+inline float ActivationOp<ActivationFunction::Sigmoid>(float in, float, float)
+{
+    return 1.f / (1.f + expf(-in));
+}
+
+template <>
+inline float ActivationOp<ActivationFunction::ReLu>(float in, float, float)
+{
+    return std::max(0.f, in);
+}
+
+template <>
+inline float ActivationOp<ActivationFunction::BoundedReLu>(float in, float a, float b)
+{
+    return std::min(a, std::max(b, in));
+}
+
+template <>
+inline float ActivationOp<ActivationFunction::SoftReLu>(float in, float, float)
+{
+    return logf(1.0f + expf(in));
+}
+
+template <>
+inline float ActivationOp<ActivationFunction::LeakyReLu>(float in, float a, float)
+{
+    return in > 0.0f ? in : (in * a);
+}
+
+template <>
+inline float ActivationOp<ActivationFunction::Abs>(float in, float, float)
+{
+    return in < 0 ? -in : in;
+}
+
+template <>
+inline float ActivationOp<ActivationFunction::Sqrt>(float in, float, float)
+{
+    return sqrtf(in);
+}
+
+template <>
+inline float ActivationOp<ActivationFunction::Square>(float in, float, float)
+{
+    return in * in;
+}
+
+template <>
+inline float ActivationOp<ActivationFunction::TanH>(float in, float a, float b)
+{
+    return a * tanhf(b * in);
+}
+
+template <>
+inline float ActivationOp<ActivationFunction::Elu>(float in, float a, float)
+{
+    return (in >= 0) ? in : a * (expf(in) - 1);
+}
+
+template <>
+inline float ActivationOp<ActivationFunction::HardSwish>(float in, float, float)
 {
-    float output;
+    // hard_swish(x) = x * relu6(x+3) / 6
+    // relu6(x) = min(max(x,0),6)
+    return in * (std::min(std::max((in + 3),0.0f),6.0f)) / 6;
+}
 
-    // Compute the result of the activation function.
+/// Calls func with the ActivationTag of the given function, so that func is instantiated for each of them.
+template <typename Func>
+void DispatchActivation(ActivationFunction function, Func&& func)
+{
     switch (function)
     {
-        case ActivationFunction::Linear:
-        {
-            output = a * in + b;
-            break;
-        }
-        case ActivationFunction::Sigmoid:
-        {
-            output = 1.f / (1.f + expf(-in));
-            break;
-        }
-        case ActivationFunction::ReLu:
-        {
-            output = std::max(0.f, in);
-            break;
-        }
-        case ActivationFunction::BoundedReLu:
-        {
-            output = std::min(a, std::max(b, in));
-            break;
-        }
-        case ActivationFunction::SoftReLu:
-        {
-            output = logf(1.0f + expf(in));
-            break;
-        }
-        case ActivationFunction::LeakyReLu:
-        {
-            output = in > 0.0f ? in : (in * a);
-            break;
-        }
-        case ActivationFunction::Abs:
-        {
-            output = in < 0 ? -in : in;
-            break;
-        }
-        case ActivationFunction::Sqrt:
-        {
-            output = sqrtf(in);
-            break;
-        }
-        case ActivationFunction::Square:
-        {
-            output = in * in;
-            break;
-        }
-        case ActivationFunction::TanH:
-        {
-            output = a * tanhf(b * in);
-            break;
-        }
-        case ActivationFunction::Elu:
-        {
-            output = (in >= 0) ? in : a * (expf(in) - 1);
-            break;
-        }
-        case ActivationFunction::HardSwish:
-        {
-            // hard_swish(x) = x * relu6(x+3) / 6
-            // relu6(x) = min(max(x,0),6)
-            output = in * (std::min(std::max((in + 3),0.0f),6.0f)) / 6;
-            break;
-        }
+        case ActivationFunction::Linear:      func(ActivationTag<ActivationFunction::Linear>());      break;
+        case ActivationFunction::Sigmoid:     func(ActivationTag<ActivationFunction::Sigmoid>());     break;
+        case ActivationFunction::ReLu:        func(ActivationTag<ActivationFunction::ReLu>());        break;
+        case ActivationFunction::BoundedReLu: func(ActivationTag<ActivationFunction::BoundedReLu>()); break;
+        case ActivationFunction::SoftReLu:    func(ActivationTag<ActivationFunction::SoftReLu>());    break;
+        case ActivationFunction::LeakyReLu:   func(ActivationTag<ActivationFunction::LeakyReLu>());   break;
+        case ActivationFunction::Abs:         func(ActivationTag<ActivationFunction::Abs>());         break;
+        case ActivationFunction::Sqrt:        func(ActivationTag<ActivationFunction::Sqrt>());        break;
+        case ActivationFunction::Square:      func(ActivationTag<ActivationFunction::Square>());      break;
+        case ActivationFunction::TanH:        func(ActivationTag<ActivationFunction::TanH>());        break;
+        case ActivationFunction::Elu:         func(ActivationTag<ActivationFunction::Elu>());         break;
+        case ActivationFunction::HardSwish:   func(ActivationTag<ActivationFunction::HardSwish>());   break;
         default:
         {
             throw InvalidArgumentException("Unsupported activation function");
         }
     }
+}
+
+} // anonymous namespace
 
+float Activation(float in,
+                 ActivationFunction function,
+                 float a,
+                 float b)
+{
+    float output = 0.0f;
+    DispatchActivation(function, [&](auto tag)
+    {
+        output = ActivationOp<decltype(tag)::value>(in, a, b);
+    });
     return output;
 }
 
+void Activation(const float* in,
+                float* out,
+                unsigned int numElements,
+                ActivationFunction function,
+                float a,
+                float b)
+{
+    // The function is selected once for the whole tensor, the loops over the elements are then free of branches
+    DispatchActivation(function, [&](auto tag)
+    {
+        RefThreadPool::GetInstance().ParallelFor(0, numElements, ParallelMinElements,
+            [&](unsigned int begin, unsigned int end)
+            {
+                for (unsigned int i = begin; i < end; ++i)
+                {
+                    out[i] = ActivationOp<decltype(tag)::value>(in[i], a, b);
+                }
+            });
+    });
+}
 
 void Activation(Decoder<float>& in,
                 Encoder<float>& out,
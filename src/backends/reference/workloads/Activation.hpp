@@ -3,6 +3,8 @@
 // SPDX-License-Identifier: MIT
 //
 
+#pragma once
+
 #include "BaseIterator.hpp"
 
 #include <armnn/Tensor.hpp>
@@ -15,6 +17,14 @@ float Activation(float in,
                  float a,
                  float b);
 
+/// Applies an activation function to numElements floats. in and out may point to the same data.
+void Activation(const float* in,
+                float* out,
+                unsigned int numElements,
+                ActivationFunction function,
+                float a,
+                float b);
+
 void Activation(Decoder<float>& in,
                 Encoder<float>& out,
                 const TensorInfo& tensorInfo,
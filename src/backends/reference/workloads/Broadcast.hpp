@@ -17,7 +17,7 @@ struct BroadcastLoop
 
     BroadcastLoop(const TensorShape& inShape, const TensorShape& outShape);
 
-    unsigned int GetNumDimensions()
+    unsigned int GetNumDimensions() const
     {
         return static_cast<unsigned int>(m_DimData.size());
     }
@@ -89,6 +89,86 @@ struct BroadcastLoop
         outData -= outDataMovement;
     }
 
+    /// Returns the outermost dimension with a size greater than one, i.e. the first dimension whose iterations can be
+    /// split between threads, or GetNumDimensions() if all the dimensions have a size of one.
+    unsigned int GetSplitDimension() const
+    {
+        unsigned int dimension = 0;
+        while (dimension < m_DimData.size() && m_DimData[dimension].m_DimSize == 1)
+        {
+            ++dimension;
+        }
+        return dimension;
+    }
+
+    unsigned int GetDimensionSize(unsigned int dimension) const
+    {
+        return m_DimData[dimension].m_DimSize;
+    }
+
+    /// Distances between the elements of the first input, the second input and the output for consecutive indexes
+    /// in the given dimension. The strides of a broadcast input are zero.
+    unsigned int GetInputStride0(unsigned int dimension) const
+    {
+        return m_DimData[dimension].m_Stride1;
+    }
+
+    unsigned int GetInputStride1(unsigned int dimension) const
+    {
+        return m_DimData[dimension].m_Stride2;
+    }
+
+    unsigned int GetOutputStride(unsigned int dimension) const
+    {
+        return m_DimData[dimension].m_StrideOut;
+    }
+
+    /// Applies operationFunc to the elements whose index in the given dimension is in [begin, end).
+    /// The outer dimensions must all have a size of one, see GetSplitDimension().
+    /// The iterators are left at an unspecified position.
+    template <typename Func, typename DecoderOp, typename EncoderOp>
+    void UnrollSlice(Func operationFunc,
+                     unsigned int dimension,
+                     unsigned int begin,
+                     unsigned int end,
+                     DecoderOp& inData0,
+                     DecoderOp& inData1,
+                     EncoderOp& outData)
+    {
+        inData0 += begin * m_DimData[dimension].m_Stride1;
+        inData1 += begin * m_DimData[dimension].m_Stride2;
+        outData += begin * m_DimData[dimension].m_StrideOut;
+
+        for (unsigned int i = begin; i < end; i++)
+        {
+            Unroll(operationFunc, dimension + 1, inData0, inData1, outData);
+
+            inData0 += m_DimData[dimension].m_Stride1;
+            inData1 += m_DimData[dimension].m_Stride2;
+            outData += m_DimData[dimension].m_StrideOut;
+        }
+    }
+
+    template <typename Func, typename DecoderOp, typename EncoderOp>
+    void UnrollSlice(Func operationFunc,
+                     unsigned int dimension,
+                     unsigned int begin,
+                     unsigned int end,
+                     DecoderOp& inData,
+                     EncoderOp& outData)
+    {
+        inData += begin * m_DimData[dimension].m_Stride1;
+        outData += begin * m_DimData[dimension].m_StrideOut;
+
+        for (unsigned int i = begin; i < end; i++)
+        {
+            Unroll(operationFunc, dimension + 1, inData, outData);
+
+            inData += m_DimData[dimension].m_Stride1;
+            outData += m_DimData[dimension].m_StrideOut;
+        }
+    }
+
 private:
     // Struct to hold the dimension data.
     struct BroadcastDimensionData
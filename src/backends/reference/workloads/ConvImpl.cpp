@@ -4,9 +4,12 @@
 //
 
 #include "ConvImpl.hpp"
+#include "Activation.hpp"
+#include "RefThreadPool.hpp"
 
 #include <armnn/utility/Assert.hpp>
 
+#include <algorithm>
 #include <cmath>
 #include <limits>
 
@@ -89,6 +92,50 @@ void Convolve(const TensorShape& rInputShape,
     {
         throw InvalidArgumentException("Bias is enabled but the bias data is invalid");
     }
+    const unsigned int depthMultiplier = depthwise ? rFilterShape[0] : 1;
+    const unsigned int outputChannels  = depthwise ? rFilterShape[1] * depthMultiplier : rFilterShape[0];
+
+    const std::vector<float> inputVec = rInputDecoder.DecodeTensor(rInputShape);
+    const std::vector<float> filterVec = rFilterDecoder.DecodeTensor(rFilterShape, depthMultiplier, depthwise);
+
+    const TensorShape biasShape{outputChannels};
+    const std::vector<float> biasVec = biasEnabled ? pBiasDecoder->DecodeTensor(biasShape) : std::vector<float>();
+
+    std::vector<float> outputVec(rOutputShape.GetNumElements());
+
+    Convolve(rInputShape, inputVec.data(), rOutputShape, outputVec.data(), rFilterShape, filterVec.data(),
+             biasEnabled, biasVec.data(), dataLayout, paddingTop, paddingLeft, xStride, yStride, xDilation, yDilation,
+             depthwise);
+
+    for (unsigned int outIdx = 0; outIdx < outputVec.size(); outIdx++)
+    {
+        rOutputEncoder[outIdx];
+        rOutputEncoder.Set(outputVec[outIdx]);
+    }
+}
+
+void Convolve(const TensorShape& rInputShape,
+              const float* inputData,
+              const TensorShape& rOutputShape,
+              float* outputData,
+              const TensorShape& rFilterShape,
+              const float* filterData,
+              bool biasEnabled,
+              const float* biasData,
+              DataLayout dataLayout,
+              unsigned int paddingTop,
+              unsigned int paddingLeft,
+              unsigned int xStride,
+              unsigned int yStride,
+              unsigned int xDilation,
+              unsigned int yDilation,
+              bool depthwise,
+              const ActivationDescriptor* activation)
+{
+    if (biasEnabled && !biasData)
+    {
+        throw InvalidArgumentException("Bias is enabled but the bias data is invalid");
+    }
     const armnnUtils::DataLayoutIndexed dataLayoutIndexed(dataLayout);
 
     const unsigned int channelsIndex = dataLayoutIndexed.GetChannelsIndex();
@@ -108,18 +155,21 @@ void Convolve(const TensorShape& rInputShape,
     const unsigned int filterHeight = depthwise ? rFilterShape[2] : rFilterShape[heightIndex];
     const unsigned int filterWidth  = depthwise ? rFilterShape[3] : rFilterShape[widthIndex];
 
-    const std::vector<float> inputVec = rInputDecoder.DecodeTensor(rInputShape);
-    const std::vector<float> filterVec = rFilterDecoder.DecodeTensor(rFilterShape, depthMultiplier, depthwise);
-
-    const TensorShape biasShape{outputChannels};
-    const std::vector<float> biasVec = biasEnabled ? pBiasDecoder->DecodeTensor(biasShape) : std::vector<float>();
-
-    unsigned int depthwiseMultiplierIdx = 0;
-    for (unsigned int batchIdx = 0; batchIdx < batchSize; batchIdx++)
+    // Every output row is computed independently, so the rows of all the output channels of all the batches are
+    // split over the threads of the pool. [begin, end) indexes the rows as (batchIdx, cOutput, yOutput).
+    auto ConvolveRows = [&](unsigned int begin, unsigned int end)
     {
-        for (unsigned int cOutput = 0; cOutput < outputChannels; cOutput++)
+        for (unsigned int batchChannelIdx = begin / outputHeight; batchChannelIdx <= (end - 1) / outputHeight;
+             batchChannelIdx++)
         {
-            for (unsigned int yOutput = 0; yOutput < outputHeight; yOutput++)
+            const unsigned int batchIdx = batchChannelIdx / outputChannels;
+            const unsigned int cOutput  = batchChannelIdx % outputChannels;
+            const unsigned int firstRow = batchChannelIdx * outputHeight;
+            const unsigned int yBegin   = std::max(begin, firstRow) - firstRow;
+            const unsigned int yEnd     = std::min(end, firstRow + outputHeight) - firstRow;
+            unsigned int depthwiseMultiplierIdx = 0;
+
+            for (unsigned int yOutput = yBegin; yOutput < yEnd; yOutput++)
             {
                 for (unsigned int xOutput = 0; xOutput < outputWidth; xOutput++)
                 {
@@ -203,17 +253,17 @@ void Convolve(const TensorShape& rInputShape,
                                                      inputWidth * (yInput - paddingTop) +
                                                      xInput - paddingLeft;
                                     }
-                                    inputValue = inputVec[inputIndex];
+                                    inputValue = inputData[inputIndex];
                                 }
 
-                                sum += filterVec[filterIndex] * inputValue;
+                                sum += filterData[filterIndex] * inputValue;
                             }
                         }
                     }
 
                     if (biasEnabled)
                     {
-                        sum += biasVec[cOutput];
+                        sum += biasData[cOutput];
                     }
 
                     unsigned int outIdx;
@@ -232,12 +282,17 @@ void Convolve(const TensorShape& rInputShape,
                                  xOutput;
                     }
 
-                    rOutputEncoder[outIdx];
-                    rOutputEncoder.Set(sum);
+                    outputData[outIdx] = activation ?
+                        Activation(sum, activation->m_Function, activation->m_A, activation->m_B) : sum;
                 }
             }
         }
-    }
+    };
+    // Keep at least a few thousand multiply-accumulates per chunk, smaller ones are not worth dispatching.
+    const unsigned int macsPerRow   = outputWidth * filterHeight * filterWidth * (depthwise ? 1 : inputChannels);
+    const unsigned int minChunkSize = std::max(1u, 4096u / std::max(macsPerRow, 1u));
+    RefThreadPool::GetInstance().ParallelFor(0, batchSize * outputChannels * outputHeight, minChunkSize,
+                                             ConvolveRows);
 }
 
 } // namespace armnn
@@ -61,4 +61,25 @@ void Convolve(const TensorShape& rInputShape,
               unsigned int xDilation,
               unsigned int yDilation,
               bool depthwise = false);
+
+/// Convolve() on float data: the filter is laid out as returned by Decoder::DecodeTensor() and biasData holds the
+/// outputChannels biases, if enabled. The input and output are accessed in place. activation, if not nullptr, is
+/// applied to the outputs as they are written.
+void Convolve(const TensorShape& rInputShape,
+              const float* inputData,
+              const TensorShape& rOutputShape,
+              float* outputData,
+              const TensorShape& rFilterShape,
+              const float* filterData,
+              bool biasEnabled,
+              const float* biasData,
+              DataLayout dataLayout,
+              unsigned int paddingTop,
+              unsigned int paddingLeft,
+              unsigned int xStride,
+              unsigned int yStride,
+              unsigned int xDilation,
+              unsigned int yDilation,
+              bool depthwise = false,
+              const ActivationDescriptor* activation = nullptr);
 } //namespace armnn
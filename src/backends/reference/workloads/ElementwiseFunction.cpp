@@ -5,7 +5,11 @@
 
 #include "ElementwiseFunction.hpp"
 #include "Broadcast.hpp"
+#include "RefThreadPool.hpp"
+#include <algorithm>
 #include <functional>
+#include <memory>
+#include <utility>
 #include "Minimum.hpp"
 #include "Maximum.hpp"
 #include "Abs.hpp"
@@ -14,6 +18,314 @@
 #include "Sqrt.hpp"
 
 
+namespace
+{
+
+/// Minimum number of output elements for an elementwise operation to be split over the threads of the pool
+constexpr unsigned int ParallelMinElements = 16384;
+
+/// Iterator over a plain buffer, with the part of the decoder and encoder interface used by armnn::BroadcastLoop.
+/// Unlike decoders and encoders, copies iterate independently, so each thread can get its own.
+template <typename T>
+class BufferIterator
+{
+public:
+    explicit BufferIterator(T* data) : m_Data(data) {}
+
+    T Get() const { return *m_Data; }
+    void Set(T value) { *m_Data = value; }
+
+    BufferIterator& operator+=(unsigned int increment)
+    {
+        m_Data += increment;
+        return *this;
+    }
+
+    BufferIterator& operator-=(unsigned int decrement)
+    {
+        m_Data -= decrement;
+        return *this;
+    }
+
+private:
+    T* m_Data;
+};
+
+template <typename T>
+std::unique_ptr<T[]> DecodeAll(armnn::Decoder<T>& decoder, const armnn::TensorShape& shape)
+{
+    std::unique_ptr<T[]> values(new T[shape.GetNumElements()]);
+    for (unsigned int i = 0; i < shape.GetNumElements(); ++i)
+    {
+        decoder[i];
+        values[i] = decoder.Get();
+    }
+    return values;
+}
+
+template <typename T>
+void EncodeAll(armnn::Encoder<T>& encoder, const T* values, const armnn::TensorShape& shape)
+{
+    for (unsigned int i = 0; i < shape.GetNumElements(); ++i)
+    {
+        encoder[i];
+        encoder.Set(values[i]);
+    }
+}
+
+bool UseThreadPool(const armnn::TensorShape& outShape)
+{
+    return outShape.GetNumElements() >= ParallelMinElements &&
+           armnn::RefThreadPool::GetInstance().GetNumberOfThreads() > 1;
+}
+
+template <typename Functor, typename InType, typename OutType>
+void BinaryBroadcast(const armnn::TensorShape& inShape0,
+                     const armnn::TensorShape& inShape1,
+                     const armnn::TensorShape& outShape,
+                     armnn::Decoder<InType>& inData0,
+                     armnn::Decoder<InType>& inData1,
+                     armnn::Encoder<OutType>& outData)
+{
+    armnn::BroadcastLoop loop(inShape0, inShape1, outShape);
+    const unsigned int splitDimension = loop.GetSplitDimension();
+    if (!UseThreadPool(outShape) || splitDimension == loop.GetNumDimensions())
+    {
+        loop.Unroll(Functor(), 0, inData0, inData1, outData);
+        return;
+    }
+
+    // The decoders and encoder cannot be shared between threads, so go through plain buffers instead
+    std::unique_ptr<InType[]> inValues0 = DecodeAll(inData0, inShape0);
+    std::unique_ptr<InType[]> inValues1 = DecodeAll(inData1, inShape1);
+    std::unique_ptr<OutType[]> outValues(new OutType[outShape.GetNumElements()]);
+
+    armnn::RefThreadPool::GetInstance().ParallelFor(0, loop.GetDimensionSize(splitDimension), 1,
+        [&](unsigned int begin, unsigned int end)
+        {
+            BufferIterator<InType> in0(inValues0.get());
+            BufferIterator<InType> in1(inValues1.get());
+            BufferIterator<OutType> out(outValues.get());
+            loop.UnrollSlice(Functor(), splitDimension, begin, end, in0, in1, out);
+        });
+
+    EncodeAll(outData, outValues.get(), outShape);
+}
+
+template <typename Functor, typename InType, typename OutType>
+void UnaryBroadcast(const armnn::TensorShape& inShape,
+                    const armnn::TensorShape& outShape,
+                    armnn::Decoder<InType>& inData,
+                    armnn::Encoder<OutType>& outData)
+{
+    armnn::BroadcastLoop loop(inShape, outShape);
+    const unsigned int splitDimension = loop.GetSplitDimension();
+    if (!UseThreadPool(outShape) || splitDimension == loop.GetNumDimensions())
+    {
+        loop.Unroll(Functor(), 0, inData, outData);
+        return;
+    }
+
+    // The decoder and encoder cannot be shared between threads, so go through plain buffers instead
+    std::unique_ptr<InType[]> inValues = DecodeAll(inData, inShape);
+    std::unique_ptr<OutType[]> outValues(new OutType[outShape.GetNumElements()]);
+
+    armnn::RefThreadPool::GetInstance().ParallelFor(0, loop.GetDimensionSize(splitDimension), 1,
+        [&](unsigned int begin, unsigned int end)
+        {
+            BufferIterator<InType> in(inValues.get());
+            BufferIterator<OutType> out(outValues.get());
+            loop.UnrollSlice(Functor(), splitDimension, begin, end, in, out);
+        });
+
+    EncodeAll(outData, outValues.get(), outShape);
+}
+
+/// Computes a run of the innermost dimension of a binary operation. Contiguous and broadcast inputs get loops of
+/// their own, so that the compiler can vectorise them.
+template <typename Functor, typename InType, typename OutType>
+void BinaryRow(unsigned int size,
+               const InType* inData0,
+               unsigned int stride0,
+               const InType* inData1,
+               unsigned int stride1,
+               OutType* outData)
+{
+    Functor func;
+    if (stride0 == 1 && stride1 == 1)
+    {
+        for (unsigned int i = 0; i < size; ++i)
+        {
+            outData[i] = func(inData0[i], inData1[i]);
+        }
+    }
+    else if (stride0 == 1 && stride1 == 0)
+    {
+        const InType value1 = *inData1;
+        for (unsigned int i = 0; i < size; ++i)
+        {
+            outData[i] = func(inData0[i], value1);
+        }
+    }
+    else if (stride0 == 0 && stride1 == 1)
+    {
+        const InType value0 = *inData0;
+        for (unsigned int i = 0; i < size; ++i)
+        {
+            outData[i] = func(value0, inData1[i]);
+        }
+    }
+    else
+    {
+        for (unsigned int i = 0; i < size; ++i)
+        {
+            outData[i] = func(inData0[i * stride0], inData1[i * stride1]);
+        }
+    }
+}
+
+template <typename Functor, typename InType, typename OutType>
+void UnaryRow(unsigned int size, const InType* inData, unsigned int stride, OutType* outData)
+{
+    Functor func;
+    if (stride == 1)
+    {
+        for (unsigned int i = 0; i < size; ++i)
+        {
+            outData[i] = func(inData[i]);
+        }
+    }
+    else
+    {
+        for (unsigned int i = 0; i < size; ++i)
+        {
+            outData[i] = func(inData[i * stride]);
+        }
+    }
+}
+
+/// Applies a binary operation to the elements whose index in the given dimension is in [begin, end), one run of the
+/// innermost dimension at a time. The output is contiguous, so its stride in the innermost dimension is one.
+template <typename Functor, typename InType, typename OutType>
+void BinaryRows(const armnn::BroadcastLoop& loop,
+                unsigned int dimension,
+                unsigned int begin,
+                unsigned int end,
+                const InType* inData0,
+                const InType* inData1,
+                OutType* outData)
+{
+    const unsigned int stride0 = loop.GetInputStride0(dimension);
+    const unsigned int stride1 = loop.GetInputStride1(dimension);
+    const unsigned int strideOut = loop.GetOutputStride(dimension);
+
+    if (dimension + 1 == loop.GetNumDimensions())
+    {
+        BinaryRow<Functor>(end - begin,
+                           inData0 + begin * stride0, stride0,
+                           inData1 + begin * stride1, stride1,
+                           outData + begin * strideOut);
+        return;
+    }
+
+    for (unsigned int i = begin; i < end; ++i)
+    {
+        BinaryRows<Functor>(loop, dimension + 1, 0, loop.GetDimensionSize(dimension + 1),
+                            inData0 + i * stride0, inData1 + i * stride1, outData + i * strideOut);
+    }
+}
+
+template <typename Functor, typename InType, typename OutType>
+void UnaryRows(const armnn::BroadcastLoop& loop,
+               unsigned int dimension,
+               unsigned int begin,
+               unsigned int end,
+               const InType* inData,
+               OutType* outData)
+{
+    const unsigned int stride = loop.GetInputStride0(dimension);
+    const unsigned int strideOut = loop.GetOutputStride(dimension);
+
+    if (dimension + 1 == loop.GetNumDimensions())
+    {
+        UnaryRow<Functor>(end - begin, inData + begin * stride, stride, outData + begin * strideOut);
+        return;
+    }
+
+    for (unsigned int i = begin; i < end; ++i)
+    {
+        UnaryRows<Functor>(loop, dimension + 1, 0, loop.GetDimensionSize(dimension + 1),
+                           inData + i * stride, outData + i * strideOut);
+    }
+}
+
+/// Returns the dimension whose iterations are split over the threads of the pool and the minimum number of them
+/// processed by a thread, so that a thread computes at least ParallelMinElements outputs.
+std::pair<unsigned int, unsigned int> GetParallelDimension(const armnn::BroadcastLoop& loop)
+{
+    const unsigned int dimension = std::min(loop.GetSplitDimension(), loop.GetNumDimensions() - 1);
+    return { dimension, std::max(1u, ParallelMinElements / loop.GetOutputStride(dimension)) };
+}
+
+template <typename Functor, typename InType, typename OutType>
+void BinaryDirect(const armnn::TensorShape& inShape0,
+                  const armnn::TensorShape& inShape1,
+                  const armnn::TensorShape& outShape,
+                  const InType* inData0,
+                  const InType* inData1,
+                  OutType* outData)
+{
+    armnn::RefThreadPool& threadPool = armnn::RefThreadPool::GetInstance();
+
+    if (inShape0 == outShape && inShape1 == outShape)
+    {
+        // Without broadcasting the tensors are processed as a single row
+        threadPool.ParallelFor(0, outShape.GetNumElements(), ParallelMinElements,
+            [&](unsigned int begin, unsigned int end)
+            {
+                BinaryRow<Functor>(end - begin, inData0 + begin, 1, inData1 + begin, 1, outData + begin);
+            });
+        return;
+    }
+
+    const armnn::BroadcastLoop loop(inShape0, inShape1, outShape);
+    const std::pair<unsigned int, unsigned int> split = GetParallelDimension(loop);
+    threadPool.ParallelFor(0, loop.GetDimensionSize(split.first), split.second,
+        [&](unsigned int begin, unsigned int end)
+        {
+            BinaryRows<Functor>(loop, split.first, begin, end, inData0, inData1, outData);
+        });
+}
+
+template <typename Functor, typename InType, typename OutType>
+void UnaryDirect(const armnn::TensorShape& inShape,
+                 const armnn::TensorShape& outShape,
+                 const InType* inData,
+                 OutType* outData)
+{
+    armnn::RefThreadPool& threadPool = armnn::RefThreadPool::GetInstance();
+
+    if (inShape == outShape)
+    {
+        threadPool.ParallelFor(0, outShape.GetNumElements(), ParallelMinElements,
+            [&](unsigned int begin, unsigned int end)
+            {
+                UnaryRow<Functor>(end - begin, inData + begin, 1, outData + begin);
+            });
+        return;
+    }
+
+    const armnn::BroadcastLoop loop(inShape, outShape);
+    const std::pair<unsigned int, unsigned int> split = GetParallelDimension(loop);
+    threadPool.ParallelFor(0, loop.GetDimensionSize(split.first), split.second,
+        [&](unsigned int begin, unsigned int end)
+        {
+            UnaryRows<Functor>(loop, split.first, begin, end, inData, outData);
+        });
+}
+
+} // anonymous namespace
+
 namespace armnn
 {
 
@@ -25,7 +337,18 @@ ElementwiseBinaryFunction<Functor>::ElementwiseBinaryFunction(const TensorShape&
                                                               Decoder<InType>& inData1,
                                                               Encoder<OutType>& outData)
 {
-    BroadcastLoop(inShape0, inShape1, outShape).Unroll(Functor(), 0, inData0, inData1, outData);
+    BinaryBroadcast<Functor>(inShape0, inShape1, outShape, inData0, inData1, outData);
+}
+
+template <typename Functor>
+ElementwiseBinaryFunction<Functor>::ElementwiseBinaryFunction(const TensorShape& inShape0,
+                                                              const TensorShape& inShape1,
+                                                              const TensorShape& outShape,
+                                                              const InType* inData0,
+                                                              const InType* inData1,
+                                                              OutType* outData)
+{
+    BinaryDirect<Functor>(inShape0, inShape1, outShape, inData0, inData1, outData);
 }
 
 template <typename Functor>
@@ -34,7 +357,16 @@ ElementwiseUnaryFunction<Functor>::ElementwiseUnaryFunction(const TensorShape& i
                                                             Decoder<InType>& inData,
                                                             Encoder<OutType>& outData)
 {
-    BroadcastLoop(inShape, outShape).Unroll(Functor(), 0, inData, outData);
+    UnaryBroadcast<Functor>(inShape, outShape, inData, outData);
+}
+
+template <typename Functor>
+ElementwiseUnaryFunction<Functor>::ElementwiseUnaryFunction(const TensorShape& inShape,
+                                                            const TensorShape& outShape,
+                                                            const InType* inData,
+                                                            OutType* outData)
+{
+    UnaryDirect<Functor>(inShape, outShape, inData, outData);
 }
 
 template <typename Functor>
@@ -45,7 +377,7 @@ LogicalBinaryFunction<Functor>::LogicalBinaryFunction(const TensorShape& inShape
                                                       Decoder<InType>& inData1,
                                                       Encoder<OutType>& outData)
 {
-    BroadcastLoop(inShape0, inShape1, outShape).Unroll(Functor(), 0, inData0, inData1, outData);
+    BinaryBroadcast<Functor>(inShape0, inShape1, outShape, inData0, inData1, outData);
 }
 
 template <typename Functor>
@@ -54,7 +386,7 @@ LogicalUnaryFunction<Functor>::LogicalUnaryFunction(const TensorShape& inShape,
                                                     Decoder<InType>& inData,
                                                     Encoder<OutType>& outData)
 {
-    BroadcastLoop(inShape, outShape).Unroll(Functor(), 0, inData, outData);
+    UnaryBroadcast<Functor>(inShape, outShape, inData, outData);
 }
 
 } //namespace armnn
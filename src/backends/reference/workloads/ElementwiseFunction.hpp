@@ -23,6 +23,15 @@ struct ElementwiseBinaryFunction
                               Decoder<InType>& inData0,
                               Decoder<InType>& inData1,
                               Encoder<OutType>& outData);
+
+    /// Computes the function on values accessed directly, without going through a decoder and an encoder per
+    /// element, so that the loops over the innermost dimension can be vectorised.
+    ElementwiseBinaryFunction(const TensorShape& inShape0,
+                              const TensorShape& inShape1,
+                              const TensorShape& outShape,
+                              const InType* inData0,
+                              const InType* inData1,
+                              OutType* outData);
 };
 
 template <typename Functor>
@@ -35,6 +44,12 @@ struct ElementwiseUnaryFunction
                              const TensorShape& outShape,
                              Decoder<InType>& inData,
                              Encoder<OutType>& outData);
+
+    /// Computes the function on values accessed directly, see ElementwiseBinaryFunction.
+    ElementwiseUnaryFunction(const TensorShape& inShape,
+                             const TensorShape& outShape,
+                             const InType* inData,
+                             OutType* outData);
 };
 
 template <typename Functor>
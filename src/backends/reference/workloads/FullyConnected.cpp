@@ -5,8 +5,12 @@
 
 #include "FullyConnected.hpp"
 
+#include "Activation.hpp"
+#include "RefThreadPool.hpp"
 #include "RefWorkloadUtils.hpp"
 
+#include <algorithm>
+
 namespace armnn
 {
 
@@ -21,20 +25,51 @@ void FullyConnected(const TensorShape& rInputShape,
                     const unsigned int K,
                     const bool transposeWeights)
 {
-    // Perform FullyConnected implementation
-    unsigned int outputSize = rOutputShape[1];
-
     const std::vector<float> decodedInputs = rInputDecoder.DecodeTensor(rInputShape);
     const std::vector<float> decodedWeights = rWeightDecoder.DecodeTensor(rWeightsShape);
 
-    const TensorShape biasShape{outputSize};
+    const TensorShape biasShape{rOutputShape[1]};
     const std::vector<float> decodedBiases = biasEnabled ? rBiasDecoder.DecodeTensor(biasShape) : std::vector<float>();
 
+    std::vector<float> outputVec(rOutputShape.GetNumElements());
+
+    FullyConnected(rInputShape,
+                   decodedInputs.data(),
+                   rOutputShape,
+                   outputVec.data(),
+                   decodedWeights.data(),
+                   biasEnabled ? decodedBiases.data() : nullptr,
+                   K,
+                   transposeWeights);
+
+    for (unsigned int outputIdx = 0; outputIdx < outputVec.size(); outputIdx++)
+    {
+        rOutputEncoder[outputIdx];
+        rOutputEncoder.Set(outputVec[outputIdx]);
+    }
+}
+
+void FullyConnected(const TensorShape& rInputShape,
+                    const float* inputData,
+                    const TensorShape& rOutputShape,
+                    float* outputData,
+                    const float* weightsData,
+                    const float* biasData,
+                    const unsigned int K,
+                    const bool transposeWeights,
+                    const ActivationDescriptor* activation)
+{
+    // Perform FullyConnected implementation
+    unsigned int outputSize = rOutputShape[1];
 
-    for (unsigned int n = 0; n < rInputShape[0]; n++)
+    // Every output value is computed independently, so they are split over the threads of the pool.
+    auto ComputeOutputs = [&](unsigned int begin, unsigned int end)
     {
-        for (unsigned int channelOutput = 0; channelOutput < outputSize; channelOutput++)
+        for (unsigned int outputIdx = begin; outputIdx < end; outputIdx++)
         {
+            const unsigned int n             = outputIdx / outputSize;
+            const unsigned int channelOutput = outputIdx % outputSize;
+
             float outval = 0.f;
 
             for (unsigned int channelInput = 0; channelInput < K; channelInput++)
@@ -42,25 +77,28 @@ void FullyConnected(const TensorShape& rInputShape,
                 float weight;
                 if (transposeWeights)
                 {
-                    weight = decodedWeights[channelOutput * K + channelInput];
+                    weight = weightsData[channelOutput * K + channelInput];
                 }
                 else
                 {
-                    weight = decodedWeights[channelInput * outputSize + channelOutput];
+                    weight = weightsData[channelInput * outputSize + channelOutput];
                 }
 
-                outval += weight * decodedInputs[n * K + channelInput];
+                outval += weight * inputData[n * K + channelInput];
             }
 
-            if (biasEnabled)
+            if (biasData)
             {
-                outval += decodedBiases[channelOutput];
+                outval += biasData[channelOutput];
             }
 
-            rOutputEncoder[n * outputSize + channelOutput];
-            rOutputEncoder.Set(outval);
+            outputData[outputIdx] = activation ?
+                Activation(outval, activation->m_Function, activation->m_A, activation->m_B) : outval;
         }
-    }
+    };
+    // Keep at least a few thousand multiply-accumulates per chunk, smaller ones are not worth dispatching.
+    const unsigned int minChunkSize = std::max(1u, 4096u / std::max(K, 1u));
+    RefThreadPool::GetInstance().ParallelFor(0, rInputShape[0] * outputSize, minChunkSize, ComputeOutputs);
 }
 
 } //namespace armnn
@@ -26,4 +26,17 @@ void FullyConnected(const TensorShape& rInputShape,
                     unsigned int K,
                     bool transposeWeights);
 
+/// FullyConnected() on float data, biasData is nullptr if the bias is disabled.
+/// The input and output are accessed in place. activation, if not nullptr, is applied to the outputs as they are
+/// written.
+void FullyConnected(const TensorShape& rInputShape,
+                    const float* inputData,
+                    const TensorShape& rOutputShape,
+                    float* outputData,
+                    const float* weightsData,
+                    const float* biasData,
+                    unsigned int K,
+                    bool transposeWeights,
+                    const ActivationDescriptor* activation = nullptr);
+
 } //namespace armnn
@@ -0,0 +1,324 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "FusedElementwise.hpp"
+
+#include "Activation.hpp"
+#include "RefThreadPool.hpp"
+
+#include <armnn/Exceptions.hpp>
+#include <armnn/TypesUtils.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <string>
+
+namespace armnn
+{
+
+namespace
+{
+
+/// Number of output elements computed by each instruction in turn. The registers of a block stay in the cache
+/// while the program runs, while the loops over a block are long enough to be vectorised.
+constexpr unsigned int BlockSize = 256;
+
+/// Minimum number of blocks processed by a thread of the RefThreadPool.
+constexpr unsigned int ParallelMinBlocks = 16;
+
+/// Number of words written for each instruction of a serialized program.
+constexpr size_t SerializedInstructionWords = 7;
+
+/// Input of a program, with the distance between its elements for consecutive indexes in each dimension of the
+/// output, which is zero along the dimensions it is broadcast in.
+struct BroadcastInput
+{
+    const float* m_Data;
+    std::vector<unsigned int> m_Strides;
+    bool m_IsContiguous;
+};
+
+/// Copies the elements of a broadcast input matching the output elements in [begin, begin + size).
+void GatherBlock(const BroadcastInput& input, const TensorShape& outShape, unsigned int begin, unsigned int size,
+                 float* block)
+{
+    const unsigned int numDims = outShape.GetNumDimensions();
+
+    std::vector<unsigned int> index(numDims);
+    unsigned int offset = 0;
+    unsigned int remainder = begin;
+    for (unsigned int d = numDims; d-- > 0;)
+    {
+        index[d] = remainder % outShape[d];
+        remainder /= outShape[d];
+        offset += index[d] * input.m_Strides[d];
+    }
+
+    for (unsigned int i = 0; i < size; ++i)
+    {
+        block[i] = input.m_Data[offset];
+
+        for (unsigned int d = numDims; d-- > 0;)
+        {
+            offset += input.m_Strides[d];
+            if (++index[d] < outShape[d])
+            {
+                break;
+            }
+            offset -= input.m_Strides[d] * outShape[d];
+            index[d] = 0;
+        }
+    }
+}
+
+template <typename Function>
+void Apply(const float* in0, const float* in1, float* out, unsigned int size, Function function)
+{
+    for (unsigned int i = 0; i < size; ++i)
+    {
+        out[i] = function(in0[i], in1[i]);
+    }
+}
+
+template <typename Function>
+void Apply(const float* in, float* out, unsigned int size, Function function)
+{
+    for (unsigned int i = 0; i < size; ++i)
+    {
+        out[i] = function(in[i]);
+    }
+}
+
+void RunInstruction(const FusedElementwiseProgram::Instruction& instruction,
+                    const std::vector<const float*>& registers,
+                    float* out,
+                    unsigned int size)
+{
+    const float* in0 = registers[instruction.m_Operand0];
+    const float* in1 = registers[instruction.m_Operand1];
+
+    using OpCode = FusedElementwiseProgram::OpCode;
+    switch (instruction.m_OpCode)
+    {
+        case OpCode::Add:
+            Apply(in0, in1, out, size, [](float a, float b) { return a + b; });
+            break;
+        case OpCode::Sub:
+            Apply(in0, in1, out, size, [](float a, float b) { return a - b; });
+            break;
+        case OpCode::Mul:
+            Apply(in0, in1, out, size, [](float a, float b) { return a * b; });
+            break;
+        case OpCode::Div:
+            Apply(in0, in1, out, size, [](float a, float b) { return a / b; });
+            break;
+        case OpCode::Max:
+            Apply(in0, in1, out, size, [](float a, float b) { return std::max(a, b); });
+            break;
+        case OpCode::Min:
+            Apply(in0, in1, out, size, [](float a, float b) { return std::min(a, b); });
+            break;
+        case OpCode::Activation:
+            Activation(in0, out, size, instruction.m_Activation.m_Function,
+                       instruction.m_Activation.m_A, instruction.m_Activation.m_B);
+            break;
+        case OpCode::Unary:
+            switch (instruction.m_UnaryOperation)
+            {
+                case UnaryOperation::Abs:
+                    Apply(in0, out, size, [](float a) { return std::abs(a); });
+                    break;
+                case UnaryOperation::Exp:
+                    Apply(in0, out, size, [](float a) { return std::exp(a); });
+                    break;
+                case UnaryOperation::Neg:
+                    Apply(in0, out, size, [](float a) { return -a; });
+                    break;
+                case UnaryOperation::Rsqrt:
+                    Apply(in0, out, size, [](float a) { return 1 / std::sqrt(a); });
+                    break;
+                case UnaryOperation::Sqrt:
+                    Apply(in0, out, size, [](float a) { return std::sqrt(a); });
+                    break;
+                default:
+                    throw InvalidArgumentException(std::string("Unsupported fused unary operation ") +
+                        GetUnaryOperationAsCString(instruction.m_UnaryOperation), CHECK_LOCATION());
+            }
+            break;
+        default:
+            throw InvalidArgumentException("Unsupported fused elementwise operation", CHECK_LOCATION());
+    }
+}
+
+template <typename T>
+void AppendWord(std::vector<uint8_t>& data, T value)
+{
+    static_assert(sizeof(T) == sizeof(uint32_t), "Serialized programs are made of 32 bit words");
+    uint32_t word;
+    std::memcpy(&word, &value, sizeof(word));
+    const uint8_t* bytes = reinterpret_cast<const uint8_t*>(&word);
+    data.insert(data.end(), bytes, bytes + sizeof(word));
+}
+
+template <typename T>
+T ReadWord(const std::vector<uint8_t>& data, size_t& offset)
+{
+    static_assert(sizeof(T) == sizeof(uint32_t), "Serialized programs are made of 32 bit words");
+    T value;
+    std::memcpy(&value, data.data() + offset, sizeof(value));
+    offset += sizeof(value);
+    return value;
+}
+
+} // anonymous namespace
+
+std::vector<uint8_t> SerializeFusedElementwiseProgram(const FusedElementwiseProgram& program)
+{
+    std::vector<uint8_t> data;
+    data.reserve((2 + program.m_Instructions.size() * SerializedInstructionWords) * sizeof(uint32_t));
+
+    AppendWord(data, program.m_NumInputs);
+    AppendWord(data, static_cast<uint32_t>(program.m_Instructions.size()));
+    for (const FusedElementwiseProgram::Instruction& instruction : program.m_Instructions)
+    {
+        AppendWord(data, static_cast<uint32_t>(instruction.m_OpCode));
+        AppendWord(data, instruction.m_Operand0);
+        AppendWord(data, instruction.m_Operand1);
+        AppendWord(data, static_cast<uint32_t>(instruction.m_Activation.m_Function));
+        AppendWord(data, instruction.m_Activation.m_A);
+        AppendWord(data, instruction.m_Activation.m_B);
+        AppendWord(data, static_cast<uint32_t>(instruction.m_UnaryOperation));
+    }
+    return data;
+}
+
+FusedElementwiseProgram DeserializeFusedElementwiseProgram(const std::vector<uint8_t>& data)
+{
+    if (data.size() < 2 * sizeof(uint32_t))
+    {
+        throw InvalidArgumentException("The serialized fused elementwise program is truncated", CHECK_LOCATION());
+    }
+
+    size_t offset = 0;
+    FusedElementwiseProgram program;
+    program.m_NumInputs = ReadWord<unsigned int>(data, offset);
+    const uint32_t numInstructions = ReadWord<uint32_t>(data, offset);
+    if (numInstructions == 0 ||
+        (data.size() - offset) / sizeof(uint32_t) / SerializedInstructionWords != numInstructions ||
+        (data.size() - offset) % (sizeof(uint32_t) * SerializedInstructionWords) != 0)
+    {
+        throw InvalidArgumentException("The size of the serialized fused elementwise program doesn't match its "
+                                       "number of instructions", CHECK_LOCATION());
+    }
+
+    program.m_Instructions.resize(numInstructions);
+    for (unsigned int i = 0; i < numInstructions; ++i)
+    {
+        FusedElementwiseProgram::Instruction& instruction = program.m_Instructions[i];
+        const unsigned int resultRegister = program.m_NumInputs + i;
+
+        const uint32_t opCode = ReadWord<uint32_t>(data, offset);
+        instruction.m_Operand0 = ReadWord<unsigned int>(data, offset);
+        instruction.m_Operand1 = ReadWord<unsigned int>(data, offset);
+        instruction.m_Activation.m_Function = static_cast<ActivationFunction>(ReadWord<uint32_t>(data, offset));
+        instruction.m_Activation.m_A = ReadWord<float>(data, offset);
+        instruction.m_Activation.m_B = ReadWord<float>(data, offset);
+        instruction.m_UnaryOperation = static_cast<UnaryOperation>(ReadWord<uint32_t>(data, offset));
+
+        // Instructions may only read the inputs and the results of the instructions before them
+        if (opCode > static_cast<uint32_t>(FusedElementwiseProgram::OpCode::Unary) ||
+            instruction.m_Operand0 >= resultRegister || instruction.m_Operand1 >= resultRegister)
+        {
+            throw InvalidArgumentException("The serialized fused elementwise program holds an invalid instruction",
+                                           CHECK_LOCATION());
+        }
+        instruction.m_OpCode = static_cast<FusedElementwiseProgram::OpCode>(opCode);
+    }
+    return program;
+}
+
+void FusedElementwise(const FusedElementwiseProgram& program,
+                      const std::vector<TensorShape>& inShapes,
+                      const TensorShape& outShape,
+                      const std::vector<const float*>& inData,
+                      float* outData)
+{
+    if (inShapes.size() != program.m_NumInputs || inData.size() != program.m_NumInputs ||
+        program.m_Instructions.empty())
+    {
+        throw InvalidArgumentException("FusedElementwise: the inputs do not match the program", CHECK_LOCATION());
+    }
+
+    const unsigned int numDims = outShape.GetNumDimensions();
+    std::vector<BroadcastInput> inputs;
+    for (unsigned int i = 0; i < program.m_NumInputs; ++i)
+    {
+        if (inShapes[i].GetNumDimensions() != numDims)
+        {
+            throw InvalidArgumentException("FusedElementwise: the inputs must have the rank of the output",
+                                           CHECK_LOCATION());
+        }
+
+        BroadcastInput input{ inData[i], std::vector<unsigned int>(numDims), inShapes[i] == outShape };
+        unsigned int stride = 1;
+        for (unsigned int d = numDims; d-- > 0;)
+        {
+            input.m_Strides[d] = inShapes[i][d] > 1 ? stride : 0;
+            stride *= inShapes[i][d];
+        }
+        inputs.push_back(std::move(input));
+    }
+
+    const unsigned int numElements = outShape.GetNumElements();
+    const unsigned int numBlocks = (numElements + BlockSize - 1) / BlockSize;
+    const unsigned int numInstructions = static_cast<unsigned int>(program.m_Instructions.size());
+
+    RefThreadPool::GetInstance().ParallelFor(0, numBlocks, ParallelMinBlocks,
+        [&](unsigned int beginBlock, unsigned int endBlock)
+        {
+            // The registers of the blocks are kept by each thread from one chunk and one execution to the next, so
+            // that they are only allocated when a thread first runs a program with that many registers
+            thread_local std::vector<float> buffer;
+            thread_local std::vector<const float*> registers;
+            const size_t numRegisters = program.GetNumRegisters();
+            if (buffer.size() < numRegisters * BlockSize)
+            {
+                buffer.resize(numRegisters * BlockSize);
+                registers.resize(numRegisters);
+            }
+
+            for (unsigned int block = beginBlock; block < endBlock; ++block)
+            {
+                const unsigned int begin = block * BlockSize;
+                const unsigned int size = std::min(BlockSize, numElements - begin);
+
+                // Inputs of the shape of the output are read in place, the others are gathered into their register
+                for (unsigned int i = 0; i < program.m_NumInputs; ++i)
+                {
+                    if (inputs[i].m_IsContiguous)
+                    {
+                        registers[i] = inputs[i].m_Data + begin;
+                    }
+                    else
+                    {
+                        GatherBlock(inputs[i], outShape, begin, size, &buffer[i * BlockSize]);
+                        registers[i] = &buffer[i * BlockSize];
+                    }
+                }
+
+                // Each element of the output is only written once every input element at its index has been read
+                for (unsigned int i = 0; i < numInstructions; ++i)
+                {
+                    const unsigned int reg = program.m_NumInputs + i;
+                    float* out = i + 1 < numInstructions ? &buffer[reg * BlockSize] : outData + begin;
+                    RunInstruction(program.m_Instructions[i], registers, out, size);
+                    registers[reg] = out;
+                }
+            }
+        });
+}
+
+} // namespace armnn
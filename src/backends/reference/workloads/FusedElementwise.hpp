@@ -0,0 +1,71 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include <armnn/Descriptors.hpp>
+#include <armnn/Tensor.hpp>
+
+#include <cstdint>
+#include <vector>
+
+namespace armnn
+{
+
+/// Program computing the output of a chain of elementwise layers fused by the reference backend, with one instruction
+/// per layer of the chain. Values are held in registers: the first m_NumInputs registers hold the inputs of the chain,
+/// instruction i writes register m_NumInputs + i and the last instruction writes the output.
+struct FusedElementwiseProgram
+{
+    enum class OpCode
+    {
+        Add,
+        Sub,
+        Mul,
+        Div,
+        Max,
+        Min,
+        Activation,
+        Unary
+    };
+
+    struct Instruction
+    {
+        OpCode m_OpCode;
+        unsigned int m_Operand0;
+        /// Only read by the binary operations.
+        unsigned int m_Operand1;
+        /// Only read by OpCode::Activation.
+        ActivationDescriptor m_Activation;
+        /// Only read by OpCode::Unary, which supports Abs, Exp, Neg, Rsqrt and Sqrt.
+        UnaryOperation m_UnaryOperation;
+    };
+
+    unsigned int GetNumRegisters() const
+    {
+        return m_NumInputs + static_cast<unsigned int>(m_Instructions.size());
+    }
+
+    unsigned int m_NumInputs = 0;
+    std::vector<Instruction> m_Instructions;
+};
+
+/// Runs a program over blocks of the output, so that every input is read and the output written in a single pass
+/// over memory. The inputs have the rank of the output and are broadcast along their dimensions of size one.
+/// The output may share the memory of an input of the same shape.
+void FusedElementwise(const FusedElementwiseProgram& program,
+                      const std::vector<TensorShape>& inShapes,
+                      const TensorShape& outShape,
+                      const std::vector<const float*>& inData,
+                      float* outData);
+
+/// Returns the bytes holding a program in the optimized networks serialized on this machine.
+std::vector<uint8_t> SerializeFusedElementwiseProgram(const FusedElementwiseProgram& program);
+
+/// Reads a program from the bytes returned by SerializeFusedElementwiseProgram(). Throws InvalidArgumentException
+/// if they don't hold a program whose instructions only read the inputs and the results of previous instructions.
+FusedElementwiseProgram DeserializeFusedElementwiseProgram(const std::vector<uint8_t>& data);
+
+} // namespace armnn
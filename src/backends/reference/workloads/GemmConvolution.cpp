@@ -0,0 +1,432 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "GemmConvolution.hpp"
+
+#include "Activation.hpp"
+#include "RefThreadPool.hpp"
+
+#include <armnnUtils/DataLayoutIndexed.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+namespace armnn
+{
+
+namespace
+{
+
+/// Depth of the blocks of the shared dimension of a product, a block of b is kept in cache while it is applied to
+/// every row of a.
+constexpr unsigned int GemmBlockK = 128;
+/// Width of the blocks of columns of b and c.
+constexpr unsigned int GemmBlockN = 256;
+/// Maximum number of values of the im2col matrix built at a time by each thread.
+constexpr unsigned int Im2ColBlockSize = 64 * 1024;
+/// Minimum number of multiply-accumulates worth dispatching to a thread of the pool.
+constexpr uint64_t MinParallelMacs = 16 * 1024;
+
+unsigned int MinChunkSize(uint64_t macsPerItem)
+{
+    return static_cast<unsigned int>(std::max<uint64_t>(1, MinParallelMacs / std::max<uint64_t>(macsPerItem, 1)));
+}
+
+/// Returns the index in the input of the given output coordinate and filter tap, or -1 if it falls in the padding.
+int InputCoordinate(unsigned int outputCoordinate,
+                    unsigned int filterCoordinate,
+                    unsigned int stride,
+                    unsigned int dilation,
+                    unsigned int padding,
+                    unsigned int inputSize)
+{
+    const int coordinate = static_cast<int>(outputCoordinate * stride + filterCoordinate * dilation) -
+                           static_cast<int>(padding);
+    return (coordinate < 0 || coordinate >= static_cast<int>(inputSize)) ? -1 : coordinate;
+}
+
+/// Returns the index in the input of the pixel contributing to the given output coordinate through the given
+/// weights tap of a transpose convolution, or -1 if there is none.
+int TransposeInputCoordinate(unsigned int outputCoordinate,
+                             unsigned int weightsCoordinate,
+                             unsigned int stride,
+                             unsigned int padding,
+                             unsigned int inputSize)
+{
+    const int coordinate = static_cast<int>(outputCoordinate + padding) - static_cast<int>(weightsCoordinate);
+    if (coordinate < 0 || coordinate % static_cast<int>(stride) != 0)
+    {
+        return -1;
+    }
+    return coordinate / static_cast<int>(stride) < static_cast<int>(inputSize) ?
+           coordinate / static_cast<int>(stride) : -1;
+}
+
+} // anonymous namespace
+
+void Gemm(unsigned int m,
+          unsigned int n,
+          unsigned int k,
+          const float* a,
+          unsigned int lda,
+          const float* b,
+          unsigned int ldb,
+          float* c,
+          unsigned int ldc)
+{
+    auto MultiplyRows = [&](unsigned int rowBegin, unsigned int rowEnd)
+    {
+        for (unsigned int kBegin = 0; kBegin < k; kBegin += GemmBlockK)
+        {
+            const unsigned int kEnd = std::min(k, kBegin + GemmBlockK);
+            for (unsigned int nBegin = 0; nBegin < n; nBegin += GemmBlockN)
+            {
+                const unsigned int nEnd = std::min(n, nBegin + GemmBlockN);
+                for (unsigned int row = rowBegin; row < rowEnd; ++row)
+                {
+                    const float* aRow = a + row * lda;
+                    float* cRow = c + row * ldc;
+                    for (unsigned int kIdx = kBegin; kIdx < kEnd; ++kIdx)
+                    {
+                        const float aValue = aRow[kIdx];
+                        const float* bRow = b + kIdx * ldb;
+                        for (unsigned int col = nBegin; col < nEnd; ++col)
+                        {
+                            cRow[col] += aValue * bRow[col];
+                        }
+                    }
+                }
+            }
+        }
+    };
+    RefThreadPool::GetInstance().ParallelFor(0, m, MinChunkSize(static_cast<uint64_t>(n) * k), MultiplyRows);
+}
+
+bool IsGemmConvolutionSupported(const TensorInfo& inputInfo,
+                                const TensorInfo& weightsInfo,
+                                const TensorInfo& outputInfo)
+{
+    // Other data types keep the direct loops, which accumulate in the same order as the other backends' references
+    return inputInfo.GetDataType() == DataType::Float32 &&
+           weightsInfo.GetDataType() == DataType::Float32 &&
+           outputInfo.GetDataType() == DataType::Float32;
+}
+
+std::vector<float> PackConvolution2dWeights(const TensorShape& weightsShape,
+                                            const float* weights,
+                                            DataLayout dataLayout)
+{
+    std::vector<float> packedWeights(weights, weights + weightsShape.GetNumElements());
+    if (dataLayout == DataLayout::NHWC)
+    {
+        // [outputChannels, filterHeight * filterWidth * inputChannels] transposed
+        const unsigned int outputChannels = weightsShape[0];
+        const unsigned int patchSize = weightsShape[1] * weightsShape[2] * weightsShape[3];
+        for (unsigned int outputChannel = 0; outputChannel < outputChannels; ++outputChannel)
+        {
+            for (unsigned int patchIdx = 0; patchIdx < patchSize; ++patchIdx)
+            {
+                packedWeights[patchIdx * outputChannels + outputChannel] =
+                    weights[outputChannel * patchSize + patchIdx];
+            }
+        }
+    }
+    return packedWeights;
+}
+
+void GemmConvolve(const Convolution2dDescriptor& descriptor,
+                  const TensorShape& inputShape,
+                  const float* input,
+                  const TensorShape& outputShape,
+                  float* output,
+                  const TensorShape& weightsShape,
+                  const std::vector<float>& packedWeights,
+                  const float* biases,
+                  const ActivationDescriptor* activation)
+{
+    const armnnUtils::DataLayoutIndexed dataLayoutIndexed(descriptor.m_DataLayout);
+    const bool isNhwc = descriptor.m_DataLayout == DataLayout::NHWC;
+
+    const unsigned int batchSize      = outputShape[0];
+    const unsigned int inputChannels  = inputShape[dataLayoutIndexed.GetChannelsIndex()];
+    const unsigned int inputHeight    = inputShape[dataLayoutIndexed.GetHeightIndex()];
+    const unsigned int inputWidth     = inputShape[dataLayoutIndexed.GetWidthIndex()];
+    const unsigned int outputChannels = outputShape[dataLayoutIndexed.GetChannelsIndex()];
+    const unsigned int outputHeight   = outputShape[dataLayoutIndexed.GetHeightIndex()];
+    const unsigned int outputWidth    = outputShape[dataLayoutIndexed.GetWidthIndex()];
+    const unsigned int filterHeight   = weightsShape[dataLayoutIndexed.GetHeightIndex()];
+    const unsigned int filterWidth    = weightsShape[dataLayoutIndexed.GetWidthIndex()];
+
+    const unsigned int patchSize      = filterHeight * filterWidth * inputChannels;
+    const unsigned int outputPixels   = outputHeight * outputWidth;
+    const unsigned int inputPixels    = inputHeight * inputWidth;
+    const unsigned int blockPixels    = std::max(1u, std::min(outputPixels, Im2ColBlockSize / std::max(patchSize, 1u)));
+    const unsigned int blocksPerBatch = (outputPixels + blockPixels - 1) / blockPixels;
+
+    // Every block of output pixels is computed independently: its im2col matrix is built and multiplied with the
+    // weights, giving [pixels, outputChannels] directly for NHWC and [outputChannels, pixels] for NCHW.
+    auto ConvolveBlocks = [&](unsigned int blockBegin, unsigned int blockEnd)
+    {
+        // Kept between executions so that they do not allocate once the buffer is large enough
+        thread_local std::vector<float> im2col;
+        im2col.resize(static_cast<size_t>(blockPixels) * patchSize);
+
+        for (unsigned int blockIdx = blockBegin; blockIdx < blockEnd; ++blockIdx)
+        {
+            const unsigned int batchIdx   = blockIdx / blocksPerBatch;
+            const unsigned int pixelBegin = (blockIdx % blocksPerBatch) * blockPixels;
+            const unsigned int pixelEnd   = std::min(outputPixels, pixelBegin + blockPixels);
+            const unsigned int numPixels  = pixelEnd - pixelBegin;
+            const float* batchInput = input + static_cast<size_t>(batchIdx) * inputPixels * inputChannels;
+
+            for (unsigned int pixel = pixelBegin; pixel < pixelEnd; ++pixel)
+            {
+                const unsigned int yOutput = pixel / outputWidth;
+                const unsigned int xOutput = pixel % outputWidth;
+                const unsigned int column  = pixel - pixelBegin;
+
+                for (unsigned int yFilter = 0; yFilter < filterHeight; ++yFilter)
+                {
+                    const int yInput = InputCoordinate(yOutput, yFilter, descriptor.m_StrideY,
+                                                       descriptor.m_DilationY, descriptor.m_PadTop, inputHeight);
+                    for (unsigned int xFilter = 0; xFilter < filterWidth; ++xFilter)
+                    {
+                        const int xInput = InputCoordinate(xOutput, xFilter, descriptor.m_StrideX,
+                                                           descriptor.m_DilationX, descriptor.m_PadLeft, inputWidth);
+                        const bool inPadding = yInput < 0 || xInput < 0;
+                        const unsigned int inputPixel = inPadding ? 0u :
+                            static_cast<unsigned int>(yInput) * inputWidth + static_cast<unsigned int>(xInput);
+
+                        if (isNhwc)
+                        {
+                            // Row per output pixel, ordered as (yFilter, xFilter, inputChannel)
+                            float* patch = im2col.data() + column * patchSize +
+                                           (yFilter * filterWidth + xFilter) * inputChannels;
+                            if (inPadding)
+                            {
+                                std::fill(patch, patch + inputChannels, 0.0f);
+                            }
+                            else
+                            {
+                                std::memcpy(patch, batchInput + inputPixel * inputChannels,
+                                            inputChannels * sizeof(float));
+                            }
+                        }
+                        else
+                        {
+                            // Column per output pixel, ordered as (inputChannel, yFilter, xFilter)
+                            for (unsigned int inputChannel = 0; inputChannel < inputChannels; ++inputChannel)
+                            {
+                                const unsigned int row =
+                                    (inputChannel * filterHeight + yFilter) * filterWidth + xFilter;
+                                im2col[row * numPixels + column] =
+                                    inPadding ? 0.0f : batchInput[inputChannel * inputPixels + inputPixel];
+                            }
+                        }
+                    }
+                }
+            }
+
+            float* batchOutput = output + static_cast<size_t>(batchIdx) * outputPixels * outputChannels;
+            if (isNhwc)
+            {
+                float* blockOutput = batchOutput + pixelBegin * outputChannels;
+                std::fill(blockOutput, blockOutput + numPixels * outputChannels, 0.0f);
+                Gemm(numPixels, outputChannels, patchSize, im2col.data(), patchSize,
+                     packedWeights.data(), outputChannels, blockOutput, outputChannels);
+
+                for (unsigned int pixel = 0; biases && pixel < numPixels; ++pixel)
+                {
+                    for (unsigned int outputChannel = 0; outputChannel < outputChannels; ++outputChannel)
+                    {
+                        blockOutput[pixel * outputChannels + outputChannel] += biases[outputChannel];
+                    }
+                }
+
+                if (activation)
+                {
+                    Activation(blockOutput, blockOutput, numPixels * outputChannels,
+                               activation->m_Function, activation->m_A, activation->m_B);
+                }
+            }
+            else
+            {
+                float* blockOutput = batchOutput + pixelBegin;
+                for (unsigned int outputChannel = 0; outputChannel < outputChannels; ++outputChannel)
+                {
+                    std::fill(blockOutput + outputChannel * outputPixels,
+                              blockOutput + outputChannel * outputPixels + numPixels, 0.0f);
+                }
+                Gemm(outputChannels, numPixels, patchSize, packedWeights.data(), patchSize,
+                     im2col.data(), numPixels, blockOutput, outputPixels);
+
+                for (unsigned int outputChannel = 0; biases && outputChannel < outputChannels; ++outputChannel)
+                {
+                    for (unsigned int pixel = 0; pixel < numPixels; ++pixel)
+                    {
+                        blockOutput[outputChannel * outputPixels + pixel] += biases[outputChannel];
+                    }
+                }
+
+                for (unsigned int outputChannel = 0; activation && outputChannel < outputChannels; ++outputChannel)
+                {
+                    float* channelOutput = blockOutput + outputChannel * outputPixels;
+                    Activation(channelOutput, channelOutput, numPixels,
+                               activation->m_Function, activation->m_A, activation->m_B);
+                }
+            }
+        }
+    };
+    RefThreadPool::GetInstance().ParallelFor(0, batchSize * blocksPerBatch, 1, ConvolveBlocks);
+}
+
+std::vector<float> PackTransposeConvolution2dWeights(const TensorShape& weightsShape,
+                                                     const float* weights,
+                                                     DataLayout dataLayout)
+{
+    const armnnUtils::DataLayoutIndexed dataLayoutIndexed(dataLayout);
+    const unsigned int outputChannels = weightsShape[0];
+    const unsigned int inputChannels  = weightsShape[dataLayoutIndexed.GetChannelsIndex()];
+    const unsigned int weightsHeight  = weightsShape[dataLayoutIndexed.GetHeightIndex()];
+    const unsigned int weightsWidth   = weightsShape[dataLayoutIndexed.GetWidthIndex()];
+    const unsigned int taps           = weightsHeight * weightsWidth;
+
+    std::vector<float> packedWeights(weightsShape.GetNumElements());
+    for (unsigned int outputChannel = 0; outputChannel < outputChannels; ++outputChannel)
+    {
+        for (unsigned int tap = 0; tap < taps; ++tap)
+        {
+            for (unsigned int inputChannel = 0; inputChannel < inputChannels; ++inputChannel)
+            {
+                if (dataLayout == DataLayout::NHWC)
+                {
+                    // [outputChannels, weightsHeight, weightsWidth, inputChannels] to
+                    // [inputChannels, weightsHeight * weightsWidth * outputChannels]
+                    packedWeights[inputChannel * taps * outputChannels + tap * outputChannels + outputChannel] =
+                        weights[(outputChannel * taps + tap) * inputChannels + inputChannel];
+                }
+                else
+                {
+                    // [outputChannels, inputChannels, weightsHeight, weightsWidth] to
+                    // [outputChannels * weightsHeight * weightsWidth, inputChannels]
+                    packedWeights[(outputChannel * taps + tap) * inputChannels + inputChannel] =
+                        weights[(outputChannel * inputChannels + inputChannel) * taps + tap];
+                }
+            }
+        }
+    }
+    return packedWeights;
+}
+
+void GemmTransposeConvolve(const TransposeConvolution2dDescriptor& descriptor,
+                           const TensorShape& inputShape,
+                           const float* input,
+                           const TensorShape& outputShape,
+                           float* output,
+                           const TensorShape& weightsShape,
+                           const std::vector<float>& packedWeights,
+                           const float* biases)
+{
+    const armnnUtils::DataLayoutIndexed dataLayoutIndexed(descriptor.m_DataLayout);
+    const bool isNhwc = descriptor.m_DataLayout == DataLayout::NHWC;
+
+    const unsigned int batchSize      = inputShape[0];
+    const unsigned int inputChannels  = inputShape[dataLayoutIndexed.GetChannelsIndex()];
+    const unsigned int inputHeight    = inputShape[dataLayoutIndexed.GetHeightIndex()];
+    const unsigned int inputWidth     = inputShape[dataLayoutIndexed.GetWidthIndex()];
+    const unsigned int outputChannels = outputShape[dataLayoutIndexed.GetChannelsIndex()];
+    const unsigned int outputHeight   = outputShape[dataLayoutIndexed.GetHeightIndex()];
+    const unsigned int outputWidth    = outputShape[dataLayoutIndexed.GetWidthIndex()];
+    const unsigned int weightsHeight  = weightsShape[dataLayoutIndexed.GetHeightIndex()];
+    const unsigned int weightsWidth   = weightsShape[dataLayoutIndexed.GetWidthIndex()];
+
+    const unsigned int inputPixels  = inputHeight * inputWidth;
+    const unsigned int outputPixels = outputHeight * outputWidth;
+    const unsigned int columnsSize  = weightsHeight * weightsWidth * outputChannels;
+
+    // The contributions of every input pixel to the output pixels it overlaps:
+    // [inputPixels, weightsHeight * weightsWidth * outputChannels] for NHWC and the transpose of that for NCHW.
+    // Kept between executions so that they do not allocate once the buffer is large enough. Only accessed through
+    // columnsData from the other threads, which have their own instance of the buffer.
+    thread_local std::vector<float> columns;
+    columns.resize(static_cast<size_t>(inputPixels) * columnsSize);
+    const float* columnsData = columns.data();
+
+    for (unsigned int batchIdx = 0; batchIdx < batchSize; ++batchIdx)
+    {
+        const float* batchInput = input + static_cast<size_t>(batchIdx) * inputPixels * inputChannels;
+        float* batchOutput = output + static_cast<size_t>(batchIdx) * outputPixels * outputChannels;
+
+        std::fill(columns.begin(), columns.end(), 0.0f);
+        if (isNhwc)
+        {
+            Gemm(inputPixels, columnsSize, inputChannels, batchInput, inputChannels,
+                 packedWeights.data(), columnsSize, columns.data(), columnsSize);
+        }
+        else
+        {
+            Gemm(columnsSize, inputPixels, inputChannels, packedWeights.data(), inputChannels,
+                 batchInput, inputPixels, columns.data(), inputPixels);
+        }
+
+        // col2im written as a gather over the output rows, so that each of them is only written by one thread
+        auto AccumulateRows = [&](unsigned int rowBegin, unsigned int rowEnd)
+        {
+            for (unsigned int yOutput = rowBegin; yOutput < rowEnd; ++yOutput)
+            {
+                for (unsigned int xOutput = 0; xOutput < outputWidth; ++xOutput)
+                {
+                    const unsigned int outputPixel = yOutput * outputWidth + xOutput;
+                    for (unsigned int outputChannel = 0; outputChannel < outputChannels; ++outputChannel)
+                    {
+                        float sum = 0.0f;
+                        for (unsigned int yWeights = 0; yWeights < weightsHeight; ++yWeights)
+                        {
+                            const int yInput = TransposeInputCoordinate(yOutput, yWeights, descriptor.m_StrideY,
+                                                                        descriptor.m_PadTop, inputHeight);
+                            for (unsigned int xWeights = 0; yInput >= 0 && xWeights < weightsWidth; ++xWeights)
+                            {
+                                const int xInput = TransposeInputCoordinate(xOutput, xWeights, descriptor.m_StrideX,
+                                                                            descriptor.m_PadLeft, inputWidth);
+                                if (xInput < 0)
+                                {
+                                    continue;
+                                }
+
+                                const unsigned int inputPixel = static_cast<unsigned int>(yInput) * inputWidth +
+                                                                static_cast<unsigned int>(xInput);
+                                const unsigned int tap = yWeights * weightsWidth + xWeights;
+                                sum += isNhwc ?
+                                       columnsData[inputPixel * columnsSize + tap * outputChannels + outputChannel] :
+                                       columnsData[(outputChannel * weightsHeight * weightsWidth + tap) * inputPixels +
+                                               inputPixel];
+                            }
+                        }
+
+                        if (biases)
+                        {
+                            sum += biases[outputChannel];
+                        }
+
+                        if (isNhwc)
+                        {
+                            batchOutput[outputPixel * outputChannels + outputChannel] = sum;
+                        }
+                        else
+                        {
+                            batchOutput[outputChannel * outputPixels + outputPixel] = sum;
+                        }
+                    }
+                }
+            }
+        };
+        RefThreadPool::GetInstance().ParallelFor(0, outputHeight,
+                                                 MinChunkSize(static_cast<uint64_t>(outputWidth) * columnsSize),
+                                                 AccumulateRows);
+    }
+}
+
+} // namespace armnn
@@ -0,0 +1,73 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include <armnn/Descriptors.hpp>
+#include <armnn/Tensor.hpp>
+
+#include <vector>
+
+namespace armnn
+{
+
+/// Computes c += a * b, where a is a m x k matrix, b a k x n matrix and c a m x n matrix, all stored row-major with
+/// the given distances between the starts of consecutive rows. The product is computed in cache sized blocks and
+/// the rows of c are split over the threads of the RefThreadPool.
+void Gemm(unsigned int m,
+          unsigned int n,
+          unsigned int k,
+          const float* a,
+          unsigned int lda,
+          const float* b,
+          unsigned int ldb,
+          float* c,
+          unsigned int ldc);
+
+/// Returns whether the im2col + GEMM implementation handles a convolution with the given tensors.
+/// Convolutions it does not handle go through the direct loops of Convolve() and TransposeConvolution2dImpl().
+bool IsGemmConvolutionSupported(const TensorInfo& inputInfo,
+                                const TensorInfo& weightsInfo,
+                                const TensorInfo& outputInfo);
+
+/// Rearranges the weights of a Convolution2d into the matrix multiplied with the im2col matrix of the input:
+/// [filterHeight * filterWidth * inputChannels, outputChannels] for NHWC and
+/// [outputChannels, inputChannels * filterHeight * filterWidth] for NCHW.
+std::vector<float> PackConvolution2dWeights(const TensorShape& weightsShape,
+                                            const float* weights,
+                                            DataLayout dataLayout);
+
+/// Convolution2d computed as a product of the packed weights and the im2col matrix of the input, built for blocks
+/// of output pixels at a time to bound the memory used. biases is either nullptr or holds outputChannels values.
+/// activation, if not nullptr, is applied to every block of outputs once it is computed, while still in cache.
+void GemmConvolve(const Convolution2dDescriptor& descriptor,
+                  const TensorShape& inputShape,
+                  const float* input,
+                  const TensorShape& outputShape,
+                  float* output,
+                  const TensorShape& weightsShape,
+                  const std::vector<float>& packedWeights,
+                  const float* biases,
+                  const ActivationDescriptor* activation = nullptr);
+
+/// Rearranges the weights of a TransposeConvolution2d into the matrix the input is multiplied with:
+/// [inputChannels, weightsHeight * weightsWidth * outputChannels] for NHWC and
+/// [outputChannels * weightsHeight * weightsWidth, inputChannels] for NCHW.
+std::vector<float> PackTransposeConvolution2dWeights(const TensorShape& weightsShape,
+                                                     const float* weights,
+                                                     DataLayout dataLayout);
+
+/// TransposeConvolution2d computed as a product of the input and the packed weights, whose columns are then
+/// accumulated into the output pixels they overlap (col2im). biases is either nullptr or holds outputChannels values.
+void GemmTransposeConvolve(const TransposeConvolution2dDescriptor& descriptor,
+                           const TensorShape& inputShape,
+                           const float* input,
+                           const TensorShape& outputShape,
+                           float* output,
+                           const TensorShape& weightsShape,
+                           const std::vector<float>& packedWeights,
+                           const float* biases);
+
+} // namespace armnn
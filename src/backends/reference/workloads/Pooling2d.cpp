@@ -4,6 +4,7 @@
 //
 
 #include "Pooling2d.hpp"
+#include "RefThreadPool.hpp"
 
 #include <armnn/Exceptions.hpp>
 #include <armnn/Types.hpp>
@@ -13,99 +14,31 @@
 
 #include <limits>
 #include <algorithm>
-#include <functional>
+#include <vector>
 
 namespace
 {
-    using PoolingAlgorithm = armnn::PoolingAlgorithm;
-
-    float DefaultInitializer(PoolingAlgorithm algorithm)
+    /// The pooling algorithms, as types whose operations are inlined into the loops of PoolImpl()
+    struct MaxPool
     {
-        switch (algorithm)
-        {
-            case PoolingAlgorithm::Max:
-            {
-                return std::numeric_limits<float>::lowest();
-            }
-            case PoolingAlgorithm::Average:
-            case PoolingAlgorithm::L2:
-            {
-                return 0.0f;
-            }
-            default:
-            {
-                throw armnn::InvalidArgumentException("Unsupported pooling algorithm");
-            }
-        }
-    }
+        static float Initial() { return std::numeric_limits<float>::lowest(); }
+        static void Accumulate(float& accu, float value) { accu = std::max(accu, value); }
+        static float Finalize(float accumulated, float /*kernelSize*/) { return accumulated; }
+    };
 
-    using Accumulator = std::function<void(float & accu, float value)>;
-
-    Accumulator GetAccumulator(PoolingAlgorithm algorithm)
+    struct AveragePool
     {
-        switch (algorithm)
-        {
-            case PoolingAlgorithm::Max:
-            {
-                return [](float & accu, float value) {
-                    if (value > accu) {
-                        accu = value;
-                    }
-                };
-            }
+        static float Initial() { return 0.0f; }
+        static void Accumulate(float& accu, float value) { accu += value; }
+        static float Finalize(float accumulated, float kernelSize) { return accumulated / kernelSize; }
+    };
 
-            case PoolingAlgorithm::Average:
-            {
-                return [](float & accu, float value) {
-                    accu += value;
-                };
-            }
-
-            case PoolingAlgorithm::L2:
-            {
-                return [](float & accu, float value) {
-                    accu += (value*value);
-                };
-            }
-
-            default:
-            {
-                throw armnn::InvalidArgumentException("Unsupported pooling algorithm");
-            }
-        }
-    }
-
-    using Executor = std::function<void(float & accumulated, float kernelSize)>;
-
-    Executor GetExecutor(PoolingAlgorithm algorithm)
+    struct L2Pool
     {
-        switch (algorithm)
-        {
-            case PoolingAlgorithm::Max:
-            {
-                return [](float & /*accumulated*/, float /*kernelSize*/) {};
-            }
-
-            case PoolingAlgorithm::Average:
-            {
-                return [](float & accumulated, float kernelSize) {
-                    accumulated /= kernelSize;
-                };
-            }
-
-            case PoolingAlgorithm::L2:
-            {
-                return [](float & accumulated, float kernelSize) {
-                    accumulated = sqrtf(accumulated / kernelSize);
-                };
-            }
-
-            default:
-            {
-                throw armnn::InvalidArgumentException("Unsupported pooling algorithm");
-            }
-        }
-    }
+        static float Initial() { return 0.0f; }
+        static void Accumulate(float& accu, float value) { accu += value * value; }
+        static float Finalize(float accumulated, float kernelSize) { return sqrtf(accumulated / kernelSize); }
+    };
 
     bool OnPaddingOnly(int start, int end, int maxRange)
     {
@@ -137,13 +70,15 @@ namespace
 
 using namespace armnnUtils;
 
-namespace armnn
+namespace
 {
-void Pooling2d(Decoder<float>& rInputDecoder,
-               Encoder<float>& rOutputEncoder,
-               const TensorInfo& inputInfo,
-               const TensorInfo& outputInfo,
-               const Pooling2dDescriptor& params)
+
+template <typename Pool>
+void PoolImpl(const float* input,
+              float* output,
+              const armnn::TensorInfo& inputInfo,
+              const armnn::TensorInfo& outputInfo,
+              const armnn::Pooling2dDescriptor& params)
 {
     const DataLayoutIndexed dataLayout(params.m_DataLayout);
     auto channelsIndex = dataLayout.GetChannelsIndex();
@@ -165,26 +100,35 @@ void Pooling2d(Decoder<float>& rInputDecoder,
     const int poolHeight   = armnn::numeric_cast<int>(params.m_PoolHeight);
     const int poolWidth    = armnn::numeric_cast<int>(params.m_PoolWidth);
 
-    float defaultInitializer = DefaultInitializer(params.m_PoolType);
-
-    Accumulator accumulate = GetAccumulator(params.m_PoolType);
-    Executor execute       = GetExecutor(params.m_PoolType);
-
-    // Check supported padding methods outside the loop to simplify
-    // the inner loop.
-    if (params.m_PaddingMethod != PaddingMethod::Exclude &&
-        params.m_PaddingMethod != PaddingMethod::IgnoreValue)
+    // Distances between consecutive elements of a channel along the width and the height, which only depend on
+    // the data layout, so that the loops below index the data without checking it.
+    const bool isNhwc       = dataLayout.GetDataLayout() == armnn::DataLayout::NHWC;
+    const int inputXStride  = isNhwc ? channels : 1;
+    const int inputYStride  = widthInput * inputXStride;
+    const int outputXStride = isNhwc ? channels : 1;
+    const int outputYStride = widthOutput * outputXStride;
+
+    // Every output row is computed independently, so the rows of all the channels of all the batches are split
+    // over the threads of the pool. [begin, end) indexes the rows as (n, c, yOutput).
+    auto PoolRows = [&](unsigned int begin, unsigned int end)
     {
-        throw armnn::InvalidArgumentException("Unsupported padding type");
-    }
-
-    const std::vector<float> decodedInputVec = rInputDecoder.DecodeTensor(inputInfo.GetShape());
-
-    for (int n = 0; n < batchSize; n++)
-    {
-        for (int c = 0; c < channels; c++)
+        const int firstBatchChannel = armnn::numeric_cast<int>(begin) / heightOutput;
+        const int lastBatchChannel  = armnn::numeric_cast<int>(end - 1) / heightOutput;
+        for (int batchChannel = firstBatchChannel; batchChannel <= lastBatchChannel; batchChannel++)
         {
-            for (int yOutput = 0; yOutput < heightOutput; yOutput++)
+            const int n        = batchChannel / channels;
+            const int c        = batchChannel % channels;
+            const int firstRow = batchChannel * heightOutput;
+            const int yBegin   = std::max(armnn::numeric_cast<int>(begin), firstRow) - firstRow;
+            const int yEnd     = std::min(armnn::numeric_cast<int>(end), firstRow + heightOutput) - firstRow;
+
+            // First element of the channel c of the batch n
+            const float* inputChannel = input + (isNhwc ? n * heightInput * widthInput * channels + c
+                                                        : (n * channels + c) * heightInput * widthInput);
+            float* outputChannel = output + (isNhwc ? n * heightOutput * widthOutput * channels + c
+                                                    : (n * channels + c) * heightOutput * widthOutput);
+
+            for (int yOutput = yBegin; yOutput < yEnd; yOutput++)
             {
                 //  Calculate values independent of the x axis
                 int hstart = (yOutput * strideY) - padTop;
@@ -205,7 +149,7 @@ void Pooling2d(Decoder<float>& rInputDecoder,
                     // This is necessary because the final pooling in a row may overlap beyond the padding.
                     wend = std::min(wend, widthInput + padRight);
 
-                    float result = defaultInitializer;
+                    float& result = outputChannel[yOutput * outputYStride + xOutput * outputXStride];
                     float poolAreaSize = armnn::numeric_cast<float>(height * (wend - wstart));
 
                     // Special case: when the pooling kernel is over a padding region and the padding
@@ -217,89 +161,97 @@ void Pooling2d(Decoder<float>& rInputDecoder,
                         OnPaddingOnly(wstart, wend, widthInput))
                     {
                         result = 0.0f;
-
-                        int outputIndex;
-
-                        if(dataLayout.GetDataLayout() == DataLayout::NHWC)
-                        {
-                            outputIndex = n * heightOutput * widthOutput * channels +
-                                          yOutput * widthOutput * channels +
-                                          xOutput * channels +
-                                          c;
-                        }
-                        else
-                        {
-                            outputIndex = n * heightOutput * widthOutput * channels +
-                                          c * heightOutput * widthOutput +
-                                          yOutput * widthOutput +
-                                          xOutput;
-                        }
-
-                        rOutputEncoder[static_cast<unsigned int>(outputIndex)];
-                        rOutputEncoder.Set(result);
                         continue;
                     }
 
                     bool clamped = hclamped |= ClampRange(wstart, wend, widthInput);
 
-                    if (clamped && params.m_PaddingMethod == PaddingMethod::Exclude)
+                    if (clamped && params.m_PaddingMethod == armnn::PaddingMethod::Exclude)
                     {
                         // When we exclude the padding, it means we calculate with a smaller
                         // kernel size, so I changed the divisor here.
                         poolAreaSize = armnn::numeric_cast<float>((hend - hstart) * (wend - wstart));
                     }
 
+                    float accumulated = Pool::Initial();
                     for (auto yInput = hstart; yInput < hend; yInput++)
                     {
+                        const float* inputRow = inputChannel + yInput * inputYStride;
                         for (auto xInput = wstart; xInput < wend; xInput++)
                         {
-
-                            int inputIndex;
-                            if(dataLayout.GetDataLayout() == DataLayout::NHWC)
-                            {
-                                inputIndex = n * heightInput * widthInput * channels +
-                                             yInput * widthInput * channels +
-                                             xInput * channels +
-                                             c;
-
-                            }
-                            else
-                            {
-                                inputIndex = n * heightInput * widthInput * channels +
-                                             c * heightInput * widthInput +
-                                             yInput * widthInput +
-                                             xInput;
-                            }
-
-                            accumulate(result, decodedInputVec[static_cast<unsigned int>(inputIndex)]);
+                            Pool::Accumulate(accumulated, inputRow[xInput * inputXStride]);
                         }
                     }
 
-                    execute(result, poolAreaSize);
+                    result = Pool::Finalize(accumulated, poolAreaSize);
+                }
+            }
+        }
+    };
+    const unsigned int numRows = armnn::numeric_cast<unsigned int>(batchSize * channels * heightOutput);
+    const unsigned int minChunkSize =
+        armnn::numeric_cast<unsigned int>(std::max(1, 4096 / std::max(widthOutput * poolHeight * poolWidth, 1)));
+    armnn::RefThreadPool::GetInstance().ParallelFor(0, numRows, minChunkSize, PoolRows);
+}
 
-                    int outputIndex;
+} // anonymous namespace
 
-                    if(dataLayout.GetDataLayout() == DataLayout::NHWC)
-                    {
-                        outputIndex = n * heightOutput * widthOutput * channels +
-                                      yOutput * widthOutput * channels +
-                                      xOutput * channels +
-                                      c;
-                    }
-                    else
-                    {
-                        outputIndex = n * heightOutput * widthOutput * channels +
-                                      c * heightOutput * widthOutput +
-                                      yOutput * widthOutput +
-                                      xOutput;
-                    }
+namespace armnn
+{
+void Pooling2d(const float* input,
+               float* output,
+               const TensorInfo& inputInfo,
+               const TensorInfo& outputInfo,
+               const Pooling2dDescriptor& params)
+{
+    // Check supported padding methods outside the loop to simplify
+    // the inner loop.
+    if (params.m_PaddingMethod != PaddingMethod::Exclude &&
+        params.m_PaddingMethod != PaddingMethod::IgnoreValue)
+    {
+        throw armnn::InvalidArgumentException("Unsupported padding type");
+    }
 
-                    rOutputEncoder[static_cast<unsigned int>(outputIndex)];
-                    rOutputEncoder.Set(result);
-                }
-            }
+    switch (params.m_PoolType)
+    {
+        case PoolingAlgorithm::Max:
+        {
+            PoolImpl<MaxPool>(input, output, inputInfo, outputInfo, params);
+            break;
+        }
+        case PoolingAlgorithm::Average:
+        {
+            PoolImpl<AveragePool>(input, output, inputInfo, outputInfo, params);
+            break;
+        }
+        case PoolingAlgorithm::L2:
+        {
+            PoolImpl<L2Pool>(input, output, inputInfo, outputInfo, params);
+            break;
+        }
+        default:
+        {
+            throw armnn::InvalidArgumentException("Unsupported pooling algorithm");
         }
     }
 }
 
+void Pooling2d(Decoder<float>& rInputDecoder,
+               Encoder<float>& rOutputEncoder,
+               const TensorInfo& inputInfo,
+               const TensorInfo& outputInfo,
+               const Pooling2dDescriptor& params)
+{
+    const std::vector<float> decodedInputVec = rInputDecoder.DecodeTensor(inputInfo.GetShape());
+    std::vector<float> outputVec(outputInfo.GetNumElements());
+
+    Pooling2d(decodedInputVec.data(), outputVec.data(), inputInfo, outputInfo, params);
+
+    for (unsigned int outputIndex = 0; outputIndex < outputVec.size(); outputIndex++)
+    {
+        rOutputEncoder[outputIndex];
+        rOutputEncoder.Set(outputVec[outputIndex]);
+    }
+}
+
 } //namespace armnn
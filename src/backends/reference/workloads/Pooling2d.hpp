@@ -12,6 +12,13 @@
 
 namespace armnn
 {
+/// Computes the Pooling2d operation on float data.
+void Pooling2d(const float* input,
+               float* output,
+               const TensorInfo& inputInfo,
+               const TensorInfo& outputInfo,
+               const Pooling2dDescriptor& params);
+
 /// Computes the Pooling2d operation.
 void Pooling2d(Decoder<float>& rInputDecoder,
                Encoder<float>& rOutputEncoder,
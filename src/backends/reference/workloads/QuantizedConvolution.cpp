@@ -0,0 +1,392 @@
+//
+// Copyright © 2020 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "QuantizedConvolution.hpp"
+
+#include "RefThreadPool.hpp"
+
+#include <armnnUtils/DataLayoutIndexed.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace armnn
+{
+
+namespace
+{
+
+bool IsQuantizedAsymmetric8(const TensorInfo& info)
+{
+    return (info.GetDataType() == DataType::QAsymmU8 || info.GetDataType() == DataType::QAsymmS8) &&
+           !info.HasPerAxisQuantization();
+}
+
+int32_t GetLowest(DataType dataType)
+{
+    return dataType == DataType::QAsymmU8 ? std::numeric_limits<uint8_t>::lowest()
+                                          : std::numeric_limits<int8_t>::lowest();
+}
+
+int32_t GetMax(DataType dataType)
+{
+    return dataType == DataType::QAsymmU8 ? std::numeric_limits<uint8_t>::max() : std::numeric_limits<int8_t>::max();
+}
+
+/// Returns the scale of the given channel of a tensor quantized per-tensor or along the output channels
+float GetChannelScale(const TensorInfo& info, unsigned int channel)
+{
+    return info.HasPerAxisQuantization() ? info.GetQuantizationScales()[channel] : info.GetQuantizationScale();
+}
+
+int32_t QuantizeOutput(float value, const TensorInfo& outputInfo)
+{
+    const float quantized = std::round(value / outputInfo.GetQuantizationScale()) +
+                            static_cast<float>(outputInfo.GetQuantizationOffset());
+    const float lowest = static_cast<float>(GetLowest(outputInfo.GetDataType()));
+    const float max    = static_cast<float>(GetMax(outputInfo.GetDataType()));
+    return static_cast<int32_t>(std::min(max, std::max(lowest, quantized)));
+}
+
+/// Dispatches on the input type, so that the kernels read the input in place and remove its zero point as they go
+template <typename Func>
+void WithInput(const QuantizedKernelParameters& params, const void* inputData, Func func)
+{
+    if (params.m_InputType == DataType::QAsymmU8)
+    {
+        func(static_cast<const uint8_t*>(inputData));
+    }
+    else
+    {
+        func(static_cast<const int8_t*>(inputData));
+    }
+}
+
+/// Brings an accumulator of the given output channel to the output scale and writes it
+inline void StoreOutput(const QuantizedKernelParameters& params,
+                        int32_t accumulator,
+                        unsigned int channel,
+                        void* outputData,
+                        unsigned int index)
+{
+    const int32_t value = std::min(params.m_OutputMax, std::max(params.m_OutputMin,
+                                   (params.m_Multipliers[channel] * accumulator) + params.m_OutputOffset));
+    if (params.m_OutputType == DataType::QAsymmU8)
+    {
+        static_cast<uint8_t*>(outputData)[index] = static_cast<uint8_t>(value);
+    }
+    else
+    {
+        static_cast<int8_t*>(outputData)[index] = static_cast<int8_t>(value);
+    }
+}
+
+} // anonymous namespace
+
+std::unique_ptr<QuantizedKernelParameters> CreateQuantizedKernelParameters(const TensorInfo& inputInfo,
+                                                                           const ConstCpuTensorHandle& weights,
+                                                                           const ConstCpuTensorHandle* biases,
+                                                                           const TensorInfo& outputInfo,
+                                                                           const ActivationDescriptor* activation,
+                                                                           unsigned int numOutputChannels)
+{
+    const TensorInfo& weightsInfo = weights.GetTensorInfo();
+    const void* weightsData = weights.GetConstTensor<void>();
+    if (!IsQuantizedAsymmetric8(inputInfo) || !IsQuantizedAsymmetric8(outputInfo) || weightsData == nullptr ||
+        numOutputChannels == 0)
+    {
+        return nullptr;
+    }
+
+    const DataType weightsType = weightsInfo.GetDataType();
+    if (weightsType != DataType::QAsymmU8 && weightsType != DataType::QAsymmS8 && weightsType != DataType::QSymmS8)
+    {
+        return nullptr;
+    }
+    if (weightsInfo.HasPerAxisQuantization() && weightsInfo.GetQuantizationScales().size() != numOutputChannels)
+    {
+        return nullptr;
+    }
+
+    if (biases != nullptr)
+    {
+        const TensorInfo& biasesInfo = biases->GetTensorInfo();
+        if (biasesInfo.GetDataType() != DataType::Signed32 || biasesInfo.GetNumElements() != numOutputChannels ||
+            biases->GetConstTensor<void>() == nullptr ||
+            (biasesInfo.HasPerAxisQuantization() &&
+             biasesInfo.GetQuantizationScales().size() != numOutputChannels))
+        {
+            return nullptr;
+        }
+    }
+
+    auto params = std::make_unique<QuantizedKernelParameters>();
+    params->m_InputType    = inputInfo.GetDataType();
+    params->m_OutputType   = outputInfo.GetDataType();
+    params->m_InputOffset  = inputInfo.GetQuantizationOffset();
+    params->m_OutputOffset = outputInfo.GetQuantizationOffset();
+    params->m_OutputMin    = GetLowest(outputInfo.GetDataType());
+    params->m_OutputMax    = GetMax(outputInfo.GetDataType());
+
+    if (activation != nullptr)
+    {
+        switch (activation->m_Function)
+        {
+            case ActivationFunction::ReLu:
+                params->m_OutputMin = std::max(params->m_OutputMin, QuantizeOutput(0.0f, outputInfo));
+                break;
+            case ActivationFunction::BoundedReLu:
+                params->m_OutputMin = std::max(params->m_OutputMin, QuantizeOutput(activation->m_B, outputInfo));
+                params->m_OutputMax = std::min(params->m_OutputMax, QuantizeOutput(activation->m_A, outputInfo));
+                break;
+            default:
+                return nullptr;
+        }
+    }
+
+    const float inputScale  = inputInfo.GetQuantizationScale();
+    const float outputScale = outputInfo.GetQuantizationScale();
+    params->m_Multipliers.reserve(numOutputChannels);
+    params->m_Biases.resize(numOutputChannels, 0);
+    for (unsigned int channel = 0; channel < numOutputChannels; ++channel)
+    {
+        const float accumulatorScale = inputScale * GetChannelScale(weightsInfo, channel);
+        const float multiplier = accumulatorScale / outputScale;
+        if (!(multiplier >= 1.0f / static_cast<float>(1u << 30) && multiplier < 1.0f))
+        {
+            return nullptr;
+        }
+        params->m_Multipliers.emplace_back(multiplier);
+
+        if (biases != nullptr)
+        {
+            // Biases are normally quantized with the scale of the accumulators already, other scales are rescaled
+            const int32_t bias = biases->GetConstTensor<int32_t>()[channel];
+            const double biasScale = GetChannelScale(biases->GetTensorInfo(), channel);
+            const double rescaled = std::round(static_cast<double>(bias) * biasScale / accumulatorScale);
+            if (std::abs(rescaled) > static_cast<double>(std::numeric_limits<int32_t>::max()))
+            {
+                return nullptr;
+            }
+            params->m_Biases[channel] = static_cast<int32_t>(rescaled);
+        }
+    }
+
+    const unsigned int numWeights = weightsInfo.GetNumElements();
+    const int64_t weightsOffset = weightsInfo.HasPerAxisQuantization() ? 0 : weightsInfo.GetQuantizationOffset();
+    int64_t maxWeight = 0;
+    params->m_Weights.resize(numWeights);
+    for (unsigned int i = 0; i < numWeights; ++i)
+    {
+        const int64_t value = weightsType == DataType::QAsymmU8 ? static_cast<const uint8_t*>(weightsData)[i]
+                                                                : static_cast<const int8_t*>(weightsData)[i];
+        const int64_t centered = value - weightsOffset;
+        maxWeight = std::max(maxWeight, std::abs(centered));
+        params->m_Weights[i] = static_cast<int16_t>(centered);
+    }
+
+    // The centered inputs and weights are kept as int16, and each int32 accumulator starts from the bias of its
+    // channel and sums up macsPerOutput products of a centered input by a centered weight. The accumulators cannot
+    // overflow as long as the largest products and bias add up below 2^31.
+    const int64_t inputOffset = params->m_InputOffset;
+    const int64_t maxInput = std::max(std::abs(GetLowest(params->m_InputType) - inputOffset),
+                                      std::abs(GetMax(params->m_InputType) - inputOffset));
+    int64_t maxBias = 0;
+    for (int32_t bias : params->m_Biases)
+    {
+        maxBias = std::max(maxBias, std::abs(static_cast<int64_t>(bias)));
+    }
+    const int64_t macsPerOutput = numWeights / numOutputChannels;
+    if (maxInput > std::numeric_limits<int16_t>::max() || maxWeight > std::numeric_limits<int16_t>::max() ||
+        macsPerOutput * maxInput * maxWeight + maxBias > std::numeric_limits<int32_t>::max())
+    {
+        return nullptr;
+    }
+
+    return params;
+}
+
+void QuantizedConvolve(const QuantizedKernelParameters& params,
+                       const TensorShape& inputShape,
+                       const void* inputData,
+                       const TensorShape& outputShape,
+                       void* outputData,
+                       const TensorShape& filterShape,
+                       DataLayout dataLayout,
+                       unsigned int paddingTop,
+                       unsigned int paddingLeft,
+                       unsigned int xStride,
+                       unsigned int yStride,
+                       unsigned int xDilation,
+                       unsigned int yDilation,
+                       bool depthwise)
+{
+    const armnnUtils::DataLayoutIndexed dataLayoutIndexed(dataLayout);
+    const unsigned int channelsIndex = dataLayoutIndexed.GetChannelsIndex();
+    const unsigned int heightIndex   = dataLayoutIndexed.GetHeightIndex();
+    const unsigned int widthIndex    = dataLayoutIndexed.GetWidthIndex();
+
+    const unsigned int depthMultiplier = depthwise ? filterShape[0] : 1;
+    const unsigned int inputChannels   = depthwise ? filterShape[1] : filterShape[channelsIndex];
+    const unsigned int outputChannels  = depthwise ? inputChannels * depthMultiplier : filterShape[0];
+
+    const unsigned int batchSize    = outputShape[0];
+    const unsigned int outputHeight = outputShape[heightIndex];
+    const unsigned int outputWidth  = outputShape[widthIndex];
+    const unsigned int inputHeight  = inputShape[heightIndex];
+    const unsigned int inputWidth   = inputShape[widthIndex];
+
+    const unsigned int filterHeight = depthwise ? filterShape[2] : filterShape[heightIndex];
+    const unsigned int filterWidth  = depthwise ? filterShape[3] : filterShape[widthIndex];
+
+    // Distances between consecutive rows, columns and channels of the input, filter and output, so that the loops
+    // below do not depend on the data layout. Depthwise filters are [M, I, H, W] whatever the layout.
+    const bool nhwc = dataLayout == DataLayout::NHWC;
+    const unsigned int inputBatchStride   = inputHeight * inputWidth * inputChannels;
+    const unsigned int inputRowStride     = nhwc ? inputWidth * inputChannels : inputWidth;
+    const unsigned int inputColumnStride  = nhwc ? inputChannels : 1;
+    const unsigned int inputChannelStride = nhwc ? 1 : inputHeight * inputWidth;
+
+    const bool filterChannelsLast = nhwc && !depthwise;
+    const unsigned int filterRowStride     = filterChannelsLast ? filterWidth * inputChannels : filterWidth;
+    const unsigned int filterColumnStride  = filterChannelsLast ? inputChannels : 1;
+    const unsigned int filterChannelStride = filterChannelsLast ? 1 : filterHeight * filterWidth;
+
+    const unsigned int outputBatchStride   = outputHeight * outputWidth * outputChannels;
+    const unsigned int outputRowStride     = nhwc ? outputWidth * outputChannels : outputWidth;
+    const unsigned int outputColumnStride  = nhwc ? outputChannels : 1;
+    const unsigned int outputChannelStride = nhwc ? 1 : outputHeight * outputWidth;
+
+    const int32_t inputOffset = params.m_InputOffset;
+    const int16_t* weights = params.m_Weights.data();
+
+    // Same split as Convolve(): every output row of every channel of every batch is computed independently. The
+    // padding is skipped, which counts it as the zero point of the input.
+    auto ConvolveRows = [&](const auto* input, unsigned int begin, unsigned int end)
+    {
+        for (unsigned int batchChannelIdx = begin / outputHeight; batchChannelIdx * outputHeight < end;
+             ++batchChannelIdx)
+        {
+            const unsigned int batchIdx = batchChannelIdx / outputChannels;
+            const unsigned int cOutput  = batchChannelIdx % outputChannels;
+            const unsigned int firstRow = batchChannelIdx * outputHeight;
+            const unsigned int yBegin   = std::max(begin, firstRow) - firstRow;
+            const unsigned int yEnd     = std::min(end, firstRow + outputHeight) - firstRow;
+
+            // A depthwise output channel reads a single input channel, a regular one all of them
+            const unsigned int cInputBegin = depthwise ? cOutput / depthMultiplier : 0;
+            const unsigned int cInputEnd   = depthwise ? cInputBegin + 1 : inputChannels;
+            const unsigned int filterBase  = depthwise ?
+                (cOutput % depthMultiplier) * filterHeight * filterWidth * inputChannels :
+                cOutput * filterHeight * filterWidth * inputChannels;
+
+            const auto* batchInput = input + batchIdx * inputBatchStride;
+
+            for (unsigned int yOutput = yBegin; yOutput < yEnd; ++yOutput)
+            {
+                for (unsigned int xOutput = 0; xOutput < outputWidth; ++xOutput)
+                {
+                    int32_t accumulator = params.m_Biases[cOutput];
+
+                    for (unsigned int yFilter = 0; yFilter < filterHeight; ++yFilter)
+                    {
+                        const unsigned int yInput = yOutput * yStride + yFilter * yDilation;
+                        if (yInput < paddingTop || yInput >= inputHeight + paddingTop)
+                        {
+                            continue;
+                        }
+                        for (unsigned int xFilter = 0; xFilter < filterWidth; ++xFilter)
+                        {
+                            const unsigned int xInput = xOutput * xStride + xFilter * xDilation;
+                            if (xInput < paddingLeft || xInput >= inputWidth + paddingLeft)
+                            {
+                                continue;
+                            }
+
+                            const auto* inputValues = batchInput + (yInput - paddingTop) * inputRowStride +
+                                                      (xInput - paddingLeft) * inputColumnStride;
+                            const int16_t* filterValues = weights + filterBase + yFilter * filterRowStride +
+                                                          xFilter * filterColumnStride;
+                            for (unsigned int cInput = cInputBegin; cInput < cInputEnd; ++cInput)
+                            {
+                                accumulator += (inputValues[cInput * inputChannelStride] - inputOffset) *
+                                               filterValues[cInput * filterChannelStride];
+                            }
+                        }
+                    }
+
+                    StoreOutput(params, accumulator, cOutput, outputData,
+                                batchIdx * outputBatchStride + yOutput * outputRowStride +
+                                xOutput * outputColumnStride + cOutput * outputChannelStride);
+                }
+            }
+        }
+    };
+    const unsigned int macsPerRow   = outputWidth * filterHeight * filterWidth * (depthwise ? 1 : inputChannels);
+    const unsigned int minChunkSize = std::max(1u, 4096u / std::max(macsPerRow, 1u));
+    WithInput(params, inputData, [&](const auto* input)
+    {
+        RefThreadPool::GetInstance().ParallelFor(0, batchSize * outputChannels * outputHeight, minChunkSize,
+                                                 [&](unsigned int begin, unsigned int end)
+                                                 {
+                                                     ConvolveRows(input, begin, end);
+                                                 });
+    });
+}
+
+void QuantizedFullyConnected(const QuantizedKernelParameters& params,
+                             const TensorShape& inputShape,
+                             const void* inputData,
+                             const TensorShape& outputShape,
+                             void* outputData,
+                             unsigned int K,
+                             bool transposeWeights)
+{
+    const unsigned int outputSize = outputShape[1];
+    const int32_t inputOffset = params.m_InputOffset;
+    const int16_t* weights = params.m_Weights.data();
+
+    auto ComputeOutputs = [&](const auto* input, unsigned int begin, unsigned int end)
+    {
+        for (unsigned int outputIdx = begin; outputIdx < end; outputIdx++)
+        {
+            const unsigned int n             = outputIdx / outputSize;
+            const unsigned int channelOutput = outputIdx % outputSize;
+            const auto* inputValues          = input + n * K;
+
+            int32_t accumulator = params.m_Biases[channelOutput];
+            if (transposeWeights)
+            {
+                const int16_t* weightValues = weights + channelOutput * K;
+                for (unsigned int channelInput = 0; channelInput < K; channelInput++)
+                {
+                    accumulator += weightValues[channelInput] * (inputValues[channelInput] - inputOffset);
+                }
+            }
+            else
+            {
+                for (unsigned int channelInput = 0; channelInput < K; channelInput++)
+                {
+                    accumulator += weights[channelInput * outputSize + channelOutput] *
+                                   (inputValues[channelInput] - inputOffset);
+                }
+            }
+
+            StoreOutput(params, accumulator, channelOutput, outputData, outputIdx);
+        }
+    };
+    const unsigned int minChunkSize = std::max(1u, 4096u / std::max(K, 1u));
+    WithInput(params, inputData, [&](const auto* input)
+    {
+        RefThreadPool::GetInstance().ParallelFor(0, inputShape[0] * outputSize, minChunkSize,
+                                                 [&](unsigned int begin, unsigned int end)
+                                                 {
+                                                     ComputeOutputs(input, begin, end);
+                                                 });
+    });
+}
+
+} // namespace armnn
@@ -0,0 +1,85 @@
+//
+// Copyright © 2020 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include "ConvImpl.hpp"
+
+#include <armnn/Descriptors.hpp>
+#include <armnn/Tensor.hpp>
+#include <backendsCommon/CpuTensorHandle.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace armnn
+{
+
+/// Constants of a convolution or fully connected layer whose input, weights and output are all quantized, prepared
+/// so that QuantizedConvolve() and QuantizedFullyConnected() compute it with integer arithmetic only: the products
+/// of the inputs and weights, zero points removed, are accumulated in int32 and brought to the output scale with a
+/// fixed point multiplier per output channel.
+struct QuantizedKernelParameters
+{
+    /// Weights minus their zero point, in the layout of the weights tensor
+    std::vector<int16_t> m_Weights;
+
+    /// Biases per output channel, in the scale of the accumulators (input scale * weight scale of the channel)
+    std::vector<int32_t> m_Biases;
+
+    /// Input scale * weight scale of the channel / output scale, per output channel
+    std::vector<QuantizedMultiplierSmallerThanOne> m_Multipliers;
+
+    int32_t m_InputOffset  = 0;
+    int32_t m_OutputOffset = 0;
+
+    /// Range the outputs are clamped to, which is the range of the output type narrowed by a fused ReLu
+    int32_t m_OutputMin = 0;
+    int32_t m_OutputMax = 0;
+
+    DataType m_InputType  = DataType::QAsymmU8;
+    DataType m_OutputType = DataType::QAsymmU8;
+};
+
+/// Prepares the integer kernel of a layer with numOutputChannels output channels, whose weight scales are either
+/// per-tensor or given per output channel. Returns nullptr for the layers it does not handle, which are computed
+/// in float instead: inputs and outputs other than QAsymmU8 and QAsymmS8, weights without data, biases other than
+/// Signed32, fused activations other than ReLu and BoundedReLu, scales giving a multiplier outside [2^-30, 1), and
+/// ranges of inputs, weights and biases which could overflow the int32 accumulators.
+std::unique_ptr<QuantizedKernelParameters> CreateQuantizedKernelParameters(const TensorInfo& inputInfo,
+                                                                           const ConstCpuTensorHandle& weights,
+                                                                           const ConstCpuTensorHandle* biases,
+                                                                           const TensorInfo& outputInfo,
+                                                                           const ActivationDescriptor* activation,
+                                                                           unsigned int numOutputChannels);
+
+/// Integer counterpart of Convolve(), taking the same shapes and parameters with the constants prepared by
+/// CreateQuantizedKernelParameters() and the input and output in their quantized types.
+void QuantizedConvolve(const QuantizedKernelParameters& params,
+                       const TensorShape& inputShape,
+                       const void* inputData,
+                       const TensorShape& outputShape,
+                       void* outputData,
+                       const TensorShape& filterShape,
+                       DataLayout dataLayout,
+                       unsigned int paddingTop,
+                       unsigned int paddingLeft,
+                       unsigned int xStride,
+                       unsigned int yStride,
+                       unsigned int xDilation,
+                       unsigned int yDilation,
+                       bool depthwise);
+
+/// Integer counterpart of FullyConnected(), taking the same shapes and parameters with the constants prepared by
+/// CreateQuantizedKernelParameters() and the input and output in their quantized types.
+void QuantizedFullyConnected(const QuantizedKernelParameters& params,
+                             const TensorShape& inputShape,
+                             const void* inputData,
+                             const TensorShape& outputShape,
+                             void* outputData,
+                             unsigned int K,
+                             bool transposeWeights);
+
+} // namespace armnn
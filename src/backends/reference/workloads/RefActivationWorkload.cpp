@@ -6,28 +6,46 @@
 #include "RefActivationWorkload.hpp"
 
 #include "Activation.hpp"
-#include "Decoders.hpp"
-#include "Encoders.hpp"
 #include "RefWorkloadUtils.hpp"
 
 #include "Profiling.hpp"
 
+#include <vector>
+
 namespace armnn
 {
 
 void RefActivationWorkload::Execute() const
+{
+    Execute(m_Data.m_Inputs, m_Data.m_Outputs);
+}
+
+void RefActivationWorkload::ExecuteAsync(experimental::WorkingMemDescriptor& workingMemDescriptor)
+{
+    Execute(workingMemDescriptor.m_Inputs, workingMemDescriptor.m_Outputs);
+}
+
+void RefActivationWorkload::Execute(const std::vector<ITensorHandle*>& inputs,
+                                    const std::vector<ITensorHandle*>& outputs) const
 {
     ARMNN_SCOPED_PROFILING_EVENT(Compute::CpuRef, "RefActivationWorkload_Execute");
 
-    const TensorInfo& inputInfo = GetTensorInfo(m_Data.m_Inputs[0]);
-    const TensorInfo& outputInfo = GetTensorInfo(m_Data.m_Outputs[0]);
+    const TensorInfo& inputInfo = GetTensorInfo(inputs[0]);
+    const TensorInfo& outputInfo = GetTensorInfo(outputs[0]);
 
-    Activation(*MakeDecoder<float>(inputInfo, m_Data.m_Inputs[0]->Map()),
-               *MakeEncoder<float>(outputInfo, m_Data.m_Outputs[0]->Map()),
-               inputInfo,
+    std::vector<float> decodedInput;
+    std::vector<float> outputBuffer;
+    const float* inputData = GetFloatInputData(inputInfo, inputs[0]->Map(), decodedInput);
+    float* outputData = GetFloatOutputData(outputInfo, outputs[0]->Map(), outputBuffer);
+
+    Activation(inputData,
+               outputData,
+               inputInfo.GetNumElements(),
                m_Data.m_Parameters.m_Function,
                m_Data.m_Parameters.m_A,
                m_Data.m_Parameters.m_B);
+
+    EncodeFloatOutputData(outputInfo, outputs[0]->Map(), outputBuffer);
 }
 
 } //namespace armnn
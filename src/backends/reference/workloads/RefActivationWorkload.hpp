@@ -15,7 +15,11 @@ class RefActivationWorkload : public BaseWorkload<ActivationQueueDescriptor>
 {
 public:
     using BaseWorkload<ActivationQueueDescriptor>::BaseWorkload;
-    virtual void Execute() const override;
+    void Execute() const override;
+    void ExecuteAsync(experimental::WorkingMemDescriptor& workingMemDescriptor) override;
+
+private:
+    void Execute(const std::vector<ITensorHandle*>& inputs, const std::vector<ITensorHandle*>& outputs) const;
 };
 
 } //namespace armnn
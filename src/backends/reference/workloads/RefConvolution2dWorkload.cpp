@@ -6,7 +6,9 @@
 #include "RefConvolution2dWorkload.hpp"
 
 #include "ConvImpl.hpp"
+#include "GemmConvolution.hpp"
 #include "RefWorkloadUtils.hpp"
+#include "WinogradConvolution.hpp"
 
 #include "Profiling.hpp"
 
@@ -17,41 +19,125 @@ RefConvolution2dWorkload::RefConvolution2dWorkload(
         : BaseWorkload<Convolution2dQueueDescriptor>(descriptor, info)
 {
     m_Weight = std::make_unique<ScopedCpuTensorHandle>(*(descriptor.m_Weight));
-    const TensorInfo& rFilterInfo = m_Weight->GetTensorInfo();
-
-    m_FilterShape = rFilterInfo.GetShape();
-    m_FilterDecoder = MakeDecoder<float>(rFilterInfo, m_Weight.get()->Map(true));
+    m_FilterShape = m_Weight->GetTensorInfo().GetShape();
 
     if (descriptor.m_Parameters.m_BiasEnabled)
     {
         m_Bias = std::make_unique<ScopedCpuTensorHandle>(*(descriptor.m_Bias));
-        const TensorInfo& biasInfo = m_Bias->GetTensorInfo();
-        m_BiasDecoder = MakeDecoder<float>(biasInfo, m_Bias->Map(true));
+    }
+
+    m_FusedActivation = GetFusedActivation(descriptor);
+
+    m_QuantizedKernel = CreateQuantizedKernelParameters(info.m_InputTensorInfos[0], *m_Weight, m_Bias.get(),
+                                                        info.m_OutputTensorInfos[0], m_FusedActivation.get(),
+                                                        m_FilterShape[0]);
+    if (m_QuantizedKernel)
+    {
+        return;
+    }
+
+    if (descriptor.m_Parameters.m_BiasEnabled)
+    {
+        m_DecodedBiases = DecodeConstantTensor(*m_Bias);
+    }
+
+    // Weights without data are only seen on workloads which are never executed
+    const TensorInfo& weightsInfo = m_Weight->GetTensorInfo();
+    m_UseGemm = IsGemmConvolutionSupported(info.m_InputTensorInfos[0], weightsInfo, info.m_OutputTensorInfos[0]) &&
+                m_Weight->GetConstTensor<float>() != nullptr;
+    if (m_UseGemm)
+    {
+        m_WinogradTileSize = GetWinogradOutputTileSize(descriptor.m_Parameters, m_FilterShape,
+                                                       info.m_OutputTensorInfos[0].GetShape());
+        if (m_WinogradTileSize != 0)
+        {
+            m_PackedWeights = TransformWinogradWeights(m_WinogradTileSize, m_FilterShape,
+                                                       m_Weight->GetConstTensor<float>(),
+                                                       descriptor.m_Parameters.m_DataLayout);
+        }
+        else
+        {
+            m_PackedWeights = PackConvolution2dWeights(m_FilterShape, m_Weight->GetConstTensor<float>(),
+                                                       descriptor.m_Parameters.m_DataLayout);
+        }
+    }
+    else
+    {
+        m_PackedWeights = DecodeConstantTensor(*m_Weight);
     }
 }
 
-void RefConvolution2dWorkload::PostAllocationConfigure()
+void RefConvolution2dWorkload::Execute() const
 {
-    const TensorInfo& inputInfo = GetTensorInfo(m_Data.m_Inputs[0]);
-    m_InputShape = inputInfo.GetShape();
-    m_InputDecoder = MakeDecoder<float>(inputInfo);
+    Execute(m_Data.m_Inputs, m_Data.m_Outputs);
+}
 
-    const TensorInfo& outputInfo = GetTensorInfo(m_Data.m_Outputs[0]);
-    m_OutputShape = outputInfo.GetShape();
-    m_OutputEncoder = MakeEncoder<float>(outputInfo);
+void RefConvolution2dWorkload::ExecuteAsync(experimental::WorkingMemDescriptor& workingMemDescriptor)
+{
+    Execute(workingMemDescriptor.m_Inputs, workingMemDescriptor.m_Outputs);
 }
 
-void RefConvolution2dWorkload::Execute() const {
+void RefConvolution2dWorkload::Execute(const std::vector<ITensorHandle*>& inputs,
+                                       const std::vector<ITensorHandle*>& outputs) const
+{
     ARMNN_SCOPED_PROFILING_EVENT(Compute::CpuRef, "RefConvolution2dWorkload_Execute");
 
-    m_InputDecoder->Reset(m_Data.m_Inputs[0]->Map());
-    m_OutputEncoder->Reset(m_Data.m_Outputs[0]->Map());
+    const TensorInfo& inputInfo = GetTensorInfo(inputs[0]);
+    const TensorInfo& outputInfo = GetTensorInfo(outputs[0]);
+
+    if (m_QuantizedKernel)
+    {
+        QuantizedConvolve(*m_QuantizedKernel, inputInfo.GetShape(), inputs[0]->Map(), outputInfo.GetShape(),
+                          outputs[0]->Map(), m_FilterShape, m_Data.m_Parameters.m_DataLayout,
+                          m_Data.m_Parameters.m_PadTop, m_Data.m_Parameters.m_PadLeft,
+                          m_Data.m_Parameters.m_StrideX, m_Data.m_Parameters.m_StrideY,
+                          m_Data.m_Parameters.m_DilationX, m_Data.m_Parameters.m_DilationY, false);
+        return;
+    }
+
+    const float* biases = m_Data.m_Parameters.m_BiasEnabled ? m_DecodedBiases.data() : nullptr;
+
+    if (m_WinogradTileSize != 0)
+    {
+        WinogradConvolve(m_WinogradTileSize,
+                         m_Data.m_Parameters,
+                         inputInfo.GetShape(),
+                         reinterpret_cast<const float*>(inputs[0]->Map()),
+                         outputInfo.GetShape(),
+                         reinterpret_cast<float*>(outputs[0]->Map()),
+                         m_PackedWeights,
+                         biases,
+                         m_FusedActivation.get());
+        return;
+    }
 
-    Convolve(m_InputShape, *m_InputDecoder, m_OutputShape, *m_OutputEncoder, m_FilterShape,
-             *m_FilterDecoder, m_Data.m_Parameters.m_BiasEnabled, m_BiasDecoder.get(),
+    if (m_UseGemm)
+    {
+        GemmConvolve(m_Data.m_Parameters,
+                     inputInfo.GetShape(),
+                     reinterpret_cast<const float*>(inputs[0]->Map()),
+                     outputInfo.GetShape(),
+                     reinterpret_cast<float*>(outputs[0]->Map()),
+                     m_FilterShape,
+                     m_PackedWeights,
+                     biases,
+                     m_FusedActivation.get());
+        return;
+    }
+
+    // Locals rather than members so that concurrent executions do not share them, they stay empty for Float32 data
+    std::vector<float> decodedInput;
+    std::vector<float> outputBuffer;
+    const float* inputData = GetFloatInputData(inputInfo, inputs[0]->Map(), decodedInput);
+    float* outputData = GetFloatOutputData(outputInfo, outputs[0]->Map(), outputBuffer);
+
+    Convolve(inputInfo.GetShape(), inputData, outputInfo.GetShape(), outputData, m_FilterShape,
+             m_PackedWeights.data(), m_Data.m_Parameters.m_BiasEnabled, biases,
              m_Data.m_Parameters.m_DataLayout, m_Data.m_Parameters.m_PadTop, m_Data.m_Parameters.m_PadLeft,
              m_Data.m_Parameters.m_StrideX, m_Data.m_Parameters.m_StrideY,
-             m_Data.m_Parameters.m_DilationX, m_Data.m_Parameters.m_DilationY);
+             m_Data.m_Parameters.m_DilationX, m_Data.m_Parameters.m_DilationY, false, m_FusedActivation.get());
+
+    EncodeFloatOutputData(outputInfo, outputs[0]->Map(), outputBuffer);
 }
 
 } //namespace armnn
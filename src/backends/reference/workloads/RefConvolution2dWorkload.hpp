@@ -9,6 +9,7 @@
 #include <backendsCommon/WorkloadData.hpp>
 #include "Decoders.hpp"
 #include "Encoders.hpp"
+#include "QuantizedConvolution.hpp"
 
 namespace armnn
 {
@@ -19,22 +20,34 @@ public:
     explicit RefConvolution2dWorkload(const Convolution2dQueueDescriptor& descriptor,
                                       const WorkloadInfo& info);
 
-    void PostAllocationConfigure() override;
-
-    virtual void Execute() const override;
+    void Execute() const override;
+    void ExecuteAsync(experimental::WorkingMemDescriptor& workingMemDescriptor) override;
 
 private:
+    void Execute(const std::vector<ITensorHandle*>& inputs, const std::vector<ITensorHandle*>& outputs) const;
+
     std::unique_ptr<ScopedCpuTensorHandle> m_Weight;
     std::unique_ptr<ScopedCpuTensorHandle> m_Bias;
 
-    std::unique_ptr<Decoder<float>> m_InputDecoder;
-    std::unique_ptr<Encoder<float>> m_OutputEncoder;
-    std::unique_ptr<Decoder<float>> m_FilterDecoder;
-    std::unique_ptr<Decoder<float>> m_BiasDecoder;
-
-    TensorShape m_InputShape;
-    TensorShape m_OutputShape;
     TensorShape m_FilterShape;
+
+    /// Weights rearranged for GemmConvolve(), transformed for WinogradConvolve() if m_WinogradTileSize is not 0,
+    /// or decoded for Convolve() if m_UseGemm is false. Prepared once so executions only read them.
+    std::vector<float> m_PackedWeights;
+    std::vector<float> m_DecodedBiases;
+
+    /// Activation fused into the layer, applied by the kernel to the outputs it writes, nullptr if there is none
+    std::unique_ptr<ActivationDescriptor> m_FusedActivation;
+
+    /// Whether the convolution goes through GemmConvolve() or WinogradConvolve() rather than Convolve()
+    bool m_UseGemm = false;
+
+    /// Output tile size of the Winograd algorithm used for 3x3 stride 1 convolutions, 0 for the other ones
+    unsigned int m_WinogradTileSize = 0;
+
+    /// Integer kernel computing the layer when its input, weights and output are quantized, nullptr when it is
+    /// computed in float
+    std::unique_ptr<QuantizedKernelParameters> m_QuantizedKernel;
 };
 
 } //namespace armnn
@@ -20,43 +20,74 @@ RefDepthwiseConvolution2dWorkload::RefDepthwiseConvolution2dWorkload(
         : BaseWorkload<DepthwiseConvolution2dQueueDescriptor>(descriptor, info)
 {
     m_Weight = std::make_unique<ScopedCpuTensorHandle>(*(descriptor.m_Weight));
-    const TensorInfo& rFilterInfo = m_Weight->GetTensorInfo();
-    m_FilterShape = rFilterInfo.GetShape();
-    m_FilterDecoder = MakeDecoder<float>(rFilterInfo, m_Weight->Map(true));
+    m_FilterShape = m_Weight->GetTensorInfo().GetShape();
 
     if (descriptor.m_Parameters.m_BiasEnabled)
     {
         m_Bias = std::make_unique<ScopedCpuTensorHandle>(*(descriptor.m_Bias));
-        const TensorInfo& biasInfo = m_Bias->GetTensorInfo();
-        m_BiasDecoder = MakeDecoder<float>(biasInfo, m_Bias->Map(true));
     }
+
+    m_FusedActivation = GetFusedActivation(descriptor);
+
+    // Output channel i * M + m reads input channel i with the filter [m, i] of the [M, I, H, W] weights
+    const unsigned int depthMultiplier = m_FilterShape[0];
+    m_QuantizedKernel = CreateQuantizedKernelParameters(info.m_InputTensorInfos[0], *m_Weight, m_Bias.get(),
+                                                        info.m_OutputTensorInfos[0], m_FusedActivation.get(),
+                                                        depthMultiplier * m_FilterShape[1]);
+    if (m_QuantizedKernel)
+    {
+        return;
+    }
+
+    if (descriptor.m_Parameters.m_BiasEnabled)
+    {
+        m_DecodedBiases = DecodeConstantTensor(*m_Bias);
+    }
+    m_DecodedWeights = DecodeConstantTensor(*m_Weight, depthMultiplier, true);
 }
 
-void RefDepthwiseConvolution2dWorkload::PostAllocationConfigure()
+void RefDepthwiseConvolution2dWorkload::Execute() const
 {
-    const TensorInfo& inputInfo = GetTensorInfo(m_Data.m_Inputs[0]);
-    m_InputShape = inputInfo.GetShape();
-    m_InputDecoder = MakeDecoder<float>(inputInfo);
+    Execute(m_Data.m_Inputs, m_Data.m_Outputs);
+}
 
-    const TensorInfo& outputInfo = GetTensorInfo(m_Data.m_Outputs[0]);
-    m_OutputShape = outputInfo.GetShape();
-    m_OutputEncoder = MakeEncoder<float>(outputInfo);
+void RefDepthwiseConvolution2dWorkload::ExecuteAsync(experimental::WorkingMemDescriptor& workingMemDescriptor)
+{
+    Execute(workingMemDescriptor.m_Inputs, workingMemDescriptor.m_Outputs);
 }
 
-void RefDepthwiseConvolution2dWorkload::Execute() const
+void RefDepthwiseConvolution2dWorkload::Execute(const std::vector<ITensorHandle*>& inputs,
+                                                const std::vector<ITensorHandle*>& outputs) const
 {
     ARMNN_SCOPED_PROFILING_EVENT(Compute::CpuRef, "RefDepthwiseConvolution2dWorkload_Execute");
-    std::unique_ptr<Decoder<float>> pBiasDecoder{};
 
-    m_InputDecoder->Reset(m_Data.m_Inputs[0]->Map());
-    m_OutputEncoder->Reset(m_Data.m_Outputs[0]->Map());
+    const TensorInfo& inputInfo = GetTensorInfo(inputs[0]);
+    const TensorInfo& outputInfo = GetTensorInfo(outputs[0]);
+
+    if (m_QuantizedKernel)
+    {
+        QuantizedConvolve(*m_QuantizedKernel, inputInfo.GetShape(), inputs[0]->Map(), outputInfo.GetShape(),
+                          outputs[0]->Map(), m_FilterShape, m_Data.m_Parameters.m_DataLayout,
+                          m_Data.m_Parameters.m_PadTop, m_Data.m_Parameters.m_PadLeft,
+                          m_Data.m_Parameters.m_StrideX, m_Data.m_Parameters.m_StrideY,
+                          m_Data.m_Parameters.m_DilationX, m_Data.m_Parameters.m_DilationY, true);
+        return;
+    }
 
-    Convolve(m_InputShape, *m_InputDecoder, m_OutputShape, *m_OutputEncoder,
-             m_FilterShape, *m_FilterDecoder, m_Data.m_Parameters.m_BiasEnabled, m_BiasDecoder.get(),
+    // Locals rather than members so that concurrent executions do not share them, they stay empty for Float32 data
+    std::vector<float> decodedInput;
+    std::vector<float> outputBuffer;
+    const float* inputData = GetFloatInputData(inputInfo, inputs[0]->Map(), decodedInput);
+    float* outputData = GetFloatOutputData(outputInfo, outputs[0]->Map(), outputBuffer);
+
+    Convolve(inputInfo.GetShape(), inputData, outputInfo.GetShape(), outputData,
+             m_FilterShape, m_DecodedWeights.data(), m_Data.m_Parameters.m_BiasEnabled, m_DecodedBiases.data(),
              m_Data.m_Parameters.m_DataLayout, m_Data.m_Parameters.m_PadTop, m_Data.m_Parameters.m_PadLeft,
              m_Data.m_Parameters.m_StrideX, m_Data.m_Parameters.m_StrideY,
              m_Data.m_Parameters.m_DilationX,
-             m_Data.m_Parameters.m_DilationY, true);
+             m_Data.m_Parameters.m_DilationY, true, m_FusedActivation.get());
+
+    EncodeFloatOutputData(outputInfo, outputs[0]->Map(), outputBuffer);
 }
 
 } //namespace armnn
@@ -5,9 +5,7 @@
 
 #include "RefElementwiseUnaryWorkload.hpp"
 
-#include "Decoders.hpp"
 #include "ElementwiseFunction.hpp"
-#include "Encoders.hpp"
 #include "RefWorkloadUtils.hpp"
 #include "Abs.hpp"
 #include "Exp.hpp"
@@ -19,6 +17,7 @@
 #include <armnn/TypesUtils.hpp>
 
 #include <functional>
+#include <vector>
 
 namespace armnn
 {
@@ -28,28 +27,31 @@ RefElementwiseUnaryWorkload::RefElementwiseUnaryWorkload(const ElementwiseUnaryQ
     : BaseWorkload<ElementwiseUnaryQueueDescriptor>(desc, info)
 {}
 
-void RefElementwiseUnaryWorkload::PostAllocationConfigure()
+void RefElementwiseUnaryWorkload::Execute() const
 {
-    const TensorInfo& inputInfo = GetTensorInfo(m_Data.m_Inputs[0]);
-    const TensorInfo& outputInfo = GetTensorInfo(m_Data.m_Outputs[0]);
-
-    m_Input = MakeDecoder<InType>(inputInfo);
+    Execute(m_Data.m_Inputs, m_Data.m_Outputs);
+}
 
-    m_Output = MakeEncoder<OutType>(outputInfo);
+void RefElementwiseUnaryWorkload::ExecuteAsync(experimental::WorkingMemDescriptor& workingMemDescriptor)
+{
+    Execute(workingMemDescriptor.m_Inputs, workingMemDescriptor.m_Outputs);
 }
 
-void RefElementwiseUnaryWorkload::Execute() const
+void RefElementwiseUnaryWorkload::Execute(const std::vector<ITensorHandle*>& inputs,
+                                          const std::vector<ITensorHandle*>& outputs) const
 {
     ARMNN_SCOPED_PROFILING_EVENT(Compute::CpuRef, "RefElementwiseUnaryWorkload_Execute");
 
-    const TensorInfo& inputInfo = GetTensorInfo(m_Data.m_Inputs[0]);
-    const TensorInfo& outputInfo = GetTensorInfo(m_Data.m_Outputs[0]);
+    const TensorInfo& inputInfo = GetTensorInfo(inputs[0]);
+    const TensorInfo& outputInfo = GetTensorInfo(outputs[0]);
 
     const TensorShape& inShape = inputInfo.GetShape();
     const TensorShape& outShape = outputInfo.GetShape();
 
-    m_Input->Reset(m_Data.m_Inputs[0]->Map());
-    m_Output->Reset(m_Data.m_Outputs[0]->Map());
+    std::vector<float> decodedInput;
+    std::vector<float> outputBuffer;
+    const InType* input = GetFloatInputData(inputInfo, inputs[0]->Map(), decodedInput);
+    OutType* output = GetFloatOutputData(outputInfo, outputs[0]->Map(), outputBuffer);
 
     using AbsFunction   = ElementwiseUnaryFunction<abs<InType>>;
     using ExpFunction   = ElementwiseUnaryFunction<exp<InType>>;
@@ -61,27 +63,27 @@ void RefElementwiseUnaryWorkload::Execute() const
     {
         case UnaryOperation::Abs:
         {
-            AbsFunction(inShape, outShape, *m_Input, *m_Output);
+            AbsFunction(inShape, outShape, input, output);
             break;
         }
         case UnaryOperation::Exp:
         {
-            ExpFunction(inShape, outShape, *m_Input, *m_Output);
+            ExpFunction(inShape, outShape, input, output);
             break;
         }
         case UnaryOperation::Neg:
         {
-            NegFunction(inShape, outShape, *m_Input, *m_Output);
+            NegFunction(inShape, outShape, input, output);
             break;
         }
         case UnaryOperation::Rsqrt:
         {
-            RsqrtFunction(inShape, outShape, *m_Input, *m_Output);
+            RsqrtFunction(inShape, outShape, input, output);
             break;
         }
         case UnaryOperation::Sqrt:
         {
-            SqrtFunction(inShape, outShape, *m_Input, *m_Output);
+            SqrtFunction(inShape, outShape, input, output);
             break;
         }
         default:
@@ -90,6 +92,8 @@ void RefElementwiseUnaryWorkload::Execute() const
                 GetUnaryOperationAsCString(m_Data.m_Parameters.m_Operation), CHECK_LOCATION());
         }
     }
+
+    EncodeFloatOutputData(outputInfo, outputs[0]->Map(), outputBuffer);
 }
 
 } // namespace armnn
@@ -5,9 +5,7 @@
 
 #include "RefElementwiseWorkload.hpp"
 
-#include "Decoders.hpp"
 #include "ElementwiseFunction.hpp"
-#include "Encoders.hpp"
 #include "Profiling.hpp"
 #include "RefWorkloadUtils.hpp"
 #include "StringMapping.hpp"
@@ -17,6 +15,41 @@
 namespace armnn
 {
 
+namespace
+{
+
+// Float kernels read Float32 tensors in place and others through a float buffer, int32_t kernels are only used with
+// Signed32 tensors, which they always access in place.
+const float* GetInputData(const TensorInfo& info, const void* data, std::vector<float>& decodedData)
+{
+    return GetFloatInputData(info, data, decodedData);
+}
+
+float* GetOutputData(const TensorInfo& info, void* data, std::vector<float>& outputBuffer)
+{
+    return GetFloatOutputData(info, data, outputBuffer);
+}
+
+void EncodeOutputData(const TensorInfo& info, void* data, const std::vector<float>& outputBuffer)
+{
+    EncodeFloatOutputData(info, data, outputBuffer);
+}
+
+const int32_t* GetInputData(const TensorInfo&, const void* data, std::vector<int32_t>&)
+{
+    return static_cast<const int32_t*>(data);
+}
+
+int32_t* GetOutputData(const TensorInfo&, void* data, std::vector<int32_t>&)
+{
+    return static_cast<int32_t*>(data);
+}
+
+void EncodeOutputData(const TensorInfo&, void*, const std::vector<int32_t>&)
+{}
+
+} // anonymous namespace
+
 template <typename Functor, typename ParentDescriptor, typename armnn::StringMapping::Id DebugString>
 RefElementwiseWorkload<Functor, ParentDescriptor, DebugString>::RefElementwiseWorkload(
     const ParentDescriptor& desc,
@@ -26,39 +59,46 @@ RefElementwiseWorkload<Functor, ParentDescriptor, DebugString>::RefElementwiseWo
 }
 
 template <typename Functor, typename ParentDescriptor, typename armnn::StringMapping::Id DebugString>
-void RefElementwiseWorkload<Functor, ParentDescriptor, DebugString>::PostAllocationConfigure()
+void RefElementwiseWorkload<Functor, ParentDescriptor, DebugString>::Execute() const
 {
-    const TensorInfo& inputInfo0 = GetTensorInfo(m_Data.m_Inputs[0]);
-    const TensorInfo& inputInfo1 = GetTensorInfo(m_Data.m_Inputs[1]);
-    const TensorInfo& outputInfo = GetTensorInfo(m_Data.m_Outputs[0]);
+    Execute(m_Data.m_Inputs, m_Data.m_Outputs);
+}
 
-    m_Input0 = MakeDecoder<InType>(inputInfo0);
-    m_Input1 = MakeDecoder<InType>(inputInfo1);
-    m_Output = MakeEncoder<OutType>(outputInfo);
+template <typename Functor, typename ParentDescriptor, typename armnn::StringMapping::Id DebugString>
+void RefElementwiseWorkload<Functor, ParentDescriptor, DebugString>::ExecuteAsync(
+    experimental::WorkingMemDescriptor& workingMemDescriptor)
+{
+    Execute(workingMemDescriptor.m_Inputs, workingMemDescriptor.m_Outputs);
 }
 
 template <typename Functor, typename ParentDescriptor, typename armnn::StringMapping::Id DebugString>
-void RefElementwiseWorkload<Functor, ParentDescriptor, DebugString>::Execute() const
+void RefElementwiseWorkload<Functor, ParentDescriptor, DebugString>::Execute(
+    const std::vector<ITensorHandle*>& inputs, const std::vector<ITensorHandle*>& outputs) const
 {
     ARMNN_SCOPED_PROFILING_EVENT(Compute::CpuRef, StringMapping::Instance().Get(DebugString));
-    const TensorInfo& inputInfo0 = GetTensorInfo(m_Data.m_Inputs[0]);
-    const TensorInfo& inputInfo1 = GetTensorInfo(m_Data.m_Inputs[1]);
-    const TensorInfo& outputInfo = GetTensorInfo(m_Data.m_Outputs[0]);
+    const TensorInfo& inputInfo0 = GetTensorInfo(inputs[0]);
+    const TensorInfo& inputInfo1 = GetTensorInfo(inputs[1]);
+    const TensorInfo& outputInfo = GetTensorInfo(outputs[0]);
 
     const TensorShape& inShape0 = inputInfo0.GetShape();
     const TensorShape& inShape1 = inputInfo1.GetShape();
     const TensorShape& outShape = outputInfo.GetShape();
 
-    m_Input0->Reset(m_Data.m_Inputs[0]->Map());
-    m_Input1->Reset(m_Data.m_Inputs[1]->Map());
-    m_Output->Reset(m_Data.m_Outputs[0]->Map());
+    std::vector<InType> decodedInput0;
+    std::vector<InType> decodedInput1;
+    std::vector<OutType> outputBuffer;
+    const InType* input0 = GetInputData(inputInfo0, inputs[0]->Map(), decodedInput0);
+    const InType* input1 = GetInputData(inputInfo1, inputs[1]->Map(), decodedInput1);
+    OutType* output = GetOutputData(outputInfo, outputs[0]->Map(), outputBuffer);
 
     ElementwiseBinaryFunction<Functor>(inShape0,
                                        inShape1,
                                        outShape,
-                                       *m_Input0,
-                                       *m_Input1,
-                                       *m_Output);
+                                       input0,
+                                       input1,
+                                       output);
+
+    EncodeOutputData(outputInfo, outputs[0]->Map(), outputBuffer);
 }
 
 } //namespace armnn
@@ -17,53 +17,79 @@ RefFullyConnectedWorkload::RefFullyConnectedWorkload(
         : BaseWorkload<FullyConnectedQueueDescriptor>(descriptor, info),
           m_Weight(std::make_unique<ScopedCpuTensorHandle>(*(descriptor.m_Weight)))
 {
-    const TensorInfo& rWeightInfo = m_Weight->GetTensorInfo();
-    m_WeightShape = rWeightInfo.GetShape();
-    m_WeightDecoder = MakeDecoder<float>(rWeightInfo, m_Weight->Map(true));
+    m_WeightShape = m_Weight->GetTensorInfo().GetShape();
 
     if (descriptor.m_Parameters.m_BiasEnabled)
     {
         m_Bias = std::make_unique<ScopedCpuTensorHandle>(*(descriptor.m_Bias));
-        const TensorInfo& biasInfo = m_Bias->GetTensorInfo();
-        m_BiasDecoder = MakeDecoder<float>(biasInfo, m_Bias->Map(true));
     }
-}
 
-void RefFullyConnectedWorkload::PostAllocationConfigure()
-{
-    const TensorInfo& inputInfo = GetTensorInfo(m_Data.m_Inputs[0]);
-    ARMNN_ASSERT(inputInfo.GetNumDimensions() > 1);
-    m_InputShape = inputInfo.GetShape();
-    m_InputDecoder = MakeDecoder<float>(inputInfo);
+    m_FusedActivation = GetFusedActivation(descriptor);
 
-    const TensorInfo& outputInfo = GetTensorInfo(m_Data.m_Outputs[0]);
-    m_OutputShape = outputInfo.GetShape();
-    m_OutputEncoder = MakeEncoder<float>(outputInfo);
+    m_QuantizedKernel = CreateQuantizedKernelParameters(info.m_InputTensorInfos[0], *m_Weight, m_Bias.get(),
+                                                        info.m_OutputTensorInfos[0], m_FusedActivation.get(),
+                                                        info.m_OutputTensorInfos[0].GetShape()[1]);
+    if (m_QuantizedKernel)
+    {
+        return;
+    }
 
-    m_NumActivations = 1; // Total number of activations in the input.
-    for (unsigned int i = 1; i < inputInfo.GetNumDimensions(); i++)
+    if (descriptor.m_Parameters.m_BiasEnabled)
     {
-        m_NumActivations *= inputInfo.GetShape()[i];
+        m_DecodedBiases = DecodeConstantTensor(*m_Bias);
     }
+    m_DecodedWeights = DecodeConstantTensor(*m_Weight);
 }
 
 void RefFullyConnectedWorkload::Execute() const
+{
+    Execute(m_Data.m_Inputs, m_Data.m_Outputs);
+}
+
+void RefFullyConnectedWorkload::ExecuteAsync(experimental::WorkingMemDescriptor& workingMemDescriptor)
+{
+    Execute(workingMemDescriptor.m_Inputs, workingMemDescriptor.m_Outputs);
+}
+
+void RefFullyConnectedWorkload::Execute(const std::vector<ITensorHandle*>& inputs,
+                                        const std::vector<ITensorHandle*>& outputs) const
 {
     ARMNN_SCOPED_PROFILING_EVENT(Compute::CpuRef, "RefFullyConnectedWorkload_Execute");
 
-    m_InputDecoder->Reset(m_Data.m_Inputs[0]->Map());
-    m_OutputEncoder->Reset(m_Data.m_Outputs[0]->Map());
-
-    FullyConnected(m_InputShape,
-                   *m_InputDecoder,
-                   m_OutputShape,
-                   *m_OutputEncoder,
-                   m_WeightShape,
-                   *m_WeightDecoder,
-                   *m_BiasDecoder,
-                   m_Data.m_Parameters.m_BiasEnabled,
-                   m_NumActivations,
-                   m_Data.m_Parameters.m_TransposeWeightMatrix);
+    const TensorInfo& inputInfo = GetTensorInfo(inputs[0]);
+    ARMNN_ASSERT(inputInfo.GetNumDimensions() > 1);
+    const TensorInfo& outputInfo = GetTensorInfo(outputs[0]);
+
+    unsigned int numActivations = 1; // Total number of activations in the input.
+    for (unsigned int i = 1; i < inputInfo.GetNumDimensions(); i++)
+    {
+        numActivations *= inputInfo.GetShape()[i];
+    }
+
+    if (m_QuantizedKernel)
+    {
+        QuantizedFullyConnected(*m_QuantizedKernel, inputInfo.GetShape(), inputs[0]->Map(), outputInfo.GetShape(),
+                                outputs[0]->Map(), numActivations, m_Data.m_Parameters.m_TransposeWeightMatrix);
+        return;
+    }
+
+    // Locals rather than members so that concurrent executions do not share them, they stay empty for Float32 data
+    std::vector<float> decodedInput;
+    std::vector<float> outputBuffer;
+    const float* inputData = GetFloatInputData(inputInfo, inputs[0]->Map(), decodedInput);
+    float* outputData = GetFloatOutputData(outputInfo, outputs[0]->Map(), outputBuffer);
+
+    FullyConnected(inputInfo.GetShape(),
+                   inputData,
+                   outputInfo.GetShape(),
+                   outputData,
+                   m_DecodedWeights.data(),
+                   m_Data.m_Parameters.m_BiasEnabled ? m_DecodedBiases.data() : nullptr,
+                   numActivations,
+                   m_Data.m_Parameters.m_TransposeWeightMatrix,
+                   m_FusedActivation.get());
+
+    EncodeFloatOutputData(outputInfo, outputs[0]->Map(), outputBuffer);
 }
 
 } //namespace armnn
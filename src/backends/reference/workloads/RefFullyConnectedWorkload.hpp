@@ -10,7 +10,7 @@
 #include "BaseIterator.hpp"
 #include "Decoders.hpp"
 #include "Encoders.hpp"
-
+#include "QuantizedConvolution.hpp"
 
 namespace armnn
 {
@@ -21,23 +21,27 @@ public:
     explicit RefFullyConnectedWorkload(const FullyConnectedQueueDescriptor& descriptor,
                                        const WorkloadInfo& info);
 
-    void PostAllocationConfigure() override;
-
-    virtual void Execute() const override;
+    void Execute() const override;
+    void ExecuteAsync(experimental::WorkingMemDescriptor& workingMemDescriptor) override;
 
 private:
+    void Execute(const std::vector<ITensorHandle*>& inputs, const std::vector<ITensorHandle*>& outputs) const;
+
     std::unique_ptr<ScopedCpuTensorHandle> m_Weight;
     std::unique_ptr<ScopedCpuTensorHandle> m_Bias;
 
-    std::unique_ptr<Decoder<float>> m_InputDecoder;
-    std::unique_ptr<Encoder<float>> m_OutputEncoder;
-    std::unique_ptr<Decoder<float>> m_WeightDecoder;
-    std::unique_ptr<Decoder<float>> m_BiasDecoder;
-
-    TensorShape m_InputShape;
-    TensorShape m_OutputShape;
     TensorShape m_WeightShape;
-    unsigned int m_NumActivations;
+
+    /// Constant tensors decoded once, so executions only read them
+    std::vector<float> m_DecodedWeights;
+    std::vector<float> m_DecodedBiases;
+
+    /// Activation fused into the layer, applied by the kernel to the outputs it writes, nullptr if there is none
+    std::unique_ptr<ActivationDescriptor> m_FusedActivation;
+
+    /// Integer kernel computing the layer when its input, weights and output are quantized, nullptr when it is
+    /// computed in float
+    std::unique_ptr<QuantizedKernelParameters> m_QuantizedKernel;
 };
 
 } //namespace armnn
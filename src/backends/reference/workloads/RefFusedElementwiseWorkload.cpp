@@ -0,0 +1,62 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "RefFusedElementwiseWorkload.hpp"
+
+#include "RefWorkloadUtils.hpp"
+
+#include <Profiling.hpp>
+
+#include <vector>
+
+namespace armnn
+{
+
+RefFusedElementwiseWorkload::RefFusedElementwiseWorkload(const PreCompiledQueueDescriptor& descriptor,
+                                                         const WorkloadInfo& info)
+    : BaseWorkload<PreCompiledQueueDescriptor>(descriptor, info)
+{
+    if (descriptor.m_PreCompiledObject == nullptr)
+    {
+        throw InvalidArgumentException("RefFusedElementwiseWorkload: no program to run", CHECK_LOCATION());
+    }
+    m_Program = *static_cast<const FusedElementwiseProgram*>(descriptor.m_PreCompiledObject);
+}
+
+void RefFusedElementwiseWorkload::Execute() const
+{
+    Execute(m_Data.m_Inputs, m_Data.m_Outputs);
+}
+
+void RefFusedElementwiseWorkload::ExecuteAsync(experimental::WorkingMemDescriptor& workingMemDescriptor)
+{
+    Execute(workingMemDescriptor.m_Inputs, workingMemDescriptor.m_Outputs);
+}
+
+void RefFusedElementwiseWorkload::Execute(const std::vector<ITensorHandle*>& inputs,
+                                          const std::vector<ITensorHandle*>& outputs) const
+{
+    ARMNN_SCOPED_PROFILING_EVENT(Compute::CpuRef, "RefFusedElementwiseWorkload_Execute");
+
+    std::vector<TensorShape> inShapes;
+    std::vector<std::vector<float>> decodedInputs(inputs.size());
+    std::vector<const float*> inputData;
+    for (unsigned int i = 0; i < inputs.size(); ++i)
+    {
+        const TensorInfo& inputInfo = GetTensorInfo(inputs[i]);
+        inShapes.push_back(inputInfo.GetShape());
+        inputData.push_back(GetFloatInputData(inputInfo, inputs[i]->Map(), decodedInputs[i]));
+    }
+
+    const TensorInfo& outputInfo = GetTensorInfo(outputs[0]);
+    std::vector<float> outputBuffer;
+    float* outputData = GetFloatOutputData(outputInfo, outputs[0]->Map(), outputBuffer);
+
+    FusedElementwise(m_Program, inShapes, outputInfo.GetShape(), inputData, outputData);
+
+    EncodeFloatOutputData(outputInfo, outputs[0]->Map(), outputBuffer);
+}
+
+} // namespace armnn
@@ -0,0 +1,32 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include "FusedElementwise.hpp"
+
+#include <backendsCommon/Workload.hpp>
+#include <backendsCommon/WorkloadData.hpp>
+
+namespace armnn
+{
+
+/// Runs a chain of elementwise layers fused by RefBackend::OptimizeSubgraphView() into a PreCompiledLayer, whose
+/// pre-compiled object is the FusedElementwiseProgram of the chain.
+class RefFusedElementwiseWorkload : public BaseWorkload<PreCompiledQueueDescriptor>
+{
+public:
+    RefFusedElementwiseWorkload(const PreCompiledQueueDescriptor& descriptor, const WorkloadInfo& info);
+    void Execute() const override;
+    void ExecuteAsync(experimental::WorkingMemDescriptor& workingMemDescriptor) override;
+
+private:
+    void Execute(const std::vector<ITensorHandle*>& inputs, const std::vector<ITensorHandle*>& outputs) const;
+
+    /// Copy of the program, which the workload may outlive.
+    FusedElementwiseProgram m_Program;
+};
+
+} // namespace armnn
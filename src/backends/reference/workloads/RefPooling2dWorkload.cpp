@@ -9,24 +9,40 @@
 #include "RefWorkloadUtils.hpp"
 
 #include "Profiling.hpp"
-#include "BaseIterator.hpp"
+
+#include <vector>
 
 namespace armnn
 {
 void RefPooling2dWorkload::Execute() const
+{
+    Execute(m_Data.m_Inputs, m_Data.m_Outputs);
+}
+
+void RefPooling2dWorkload::ExecuteAsync(experimental::WorkingMemDescriptor& workingMemDescriptor)
+{
+    Execute(workingMemDescriptor.m_Inputs, workingMemDescriptor.m_Outputs);
+}
+
+void RefPooling2dWorkload::Execute(const std::vector<ITensorHandle*>& inputs,
+                                   const std::vector<ITensorHandle*>& outputs) const
 {
     ARMNN_SCOPED_PROFILING_EVENT(Compute::CpuRef, "RefPooling2dWorkload_Execute");
 
-    const TensorInfo& inputInfo  = GetTensorInfo(m_Data.m_Inputs[0]);
-    const TensorInfo& outputInfo = GetTensorInfo(m_Data.m_Outputs[0]);
+    const TensorInfo& inputInfo  = GetTensorInfo(inputs[0]);
+    const TensorInfo& outputInfo = GetTensorInfo(outputs[0]);
 
-    auto inputDecoder  = MakeDecoder<float>(inputInfo,  m_Data.m_Inputs[0] ->Map());
-    auto outputEncoder = MakeEncoder<float>(outputInfo, m_Data.m_Outputs[0]->Map());
+    std::vector<float> decodedInput;
+    std::vector<float> outputBuffer;
+    const float* inputData = GetFloatInputData(inputInfo, inputs[0]->Map(), decodedInput);
+    float* outputData = GetFloatOutputData(outputInfo, outputs[0]->Map(), outputBuffer);
 
-    Pooling2d(*inputDecoder,
-              *outputEncoder,
+    Pooling2d(inputData,
+              outputData,
               inputInfo,
               outputInfo,
               m_Data.m_Parameters);
+
+    EncodeFloatOutputData(outputInfo, outputs[0]->Map(), outputBuffer);
 }
 } //namespace armnn
@@ -18,6 +18,10 @@ class RefPooling2dWorkload : public BaseWorkload<Pooling2dQueueDescriptor>
 public:
     using BaseWorkload<Pooling2dQueueDescriptor>::BaseWorkload;
 
-    virtual void Execute() const override;
+    void Execute() const override;
+    void ExecuteAsync(experimental::WorkingMemDescriptor& workingMemDescriptor) override;
+
+private:
+    void Execute(const std::vector<ITensorHandle*>& inputs, const std::vector<ITensorHandle*>& outputs) const;
 };
 } //namespace armnn
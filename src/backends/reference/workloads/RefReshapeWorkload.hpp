@@ -15,7 +15,11 @@ class RefReshapeWorkload : public BaseWorkload<ReshapeQueueDescriptor>
 {
 public:
     using BaseWorkload<ReshapeQueueDescriptor>::BaseWorkload;
-    virtual void Execute() const override;
+    void Execute() const override;
+    void ExecuteAsync(experimental::WorkingMemDescriptor& workingMemDescriptor) override;
+
+private:
+    void Execute(const std::vector<ITensorHandle*>& inputs, const std::vector<ITensorHandle*>& outputs) const;
 };
 
 } //namespace armnn
@@ -5,8 +5,6 @@
 
 #include "RefSoftmaxWorkload.hpp"
 
-#include "Decoders.hpp"
-#include "Encoders.hpp"
 #include "RefWorkloadUtils.hpp"
 #include "Softmax.hpp"
 
@@ -19,22 +17,33 @@ namespace armnn
 
 void RefSoftmaxWorkload::Execute() const
 {
-    ARMNN_SCOPED_PROFILING_EVENT(Compute::CpuRef, "RefSoftmaxWorkload_Execute");
+    Execute(m_Data.m_Inputs, m_Data.m_Outputs);
+}
 
-    const TensorInfo &inputTensorInfo = GetTensorInfo(m_Data.m_Inputs[0]);
+void RefSoftmaxWorkload::ExecuteAsync(experimental::WorkingMemDescriptor& workingMemDescriptor)
+{
+    Execute(workingMemDescriptor.m_Inputs, workingMemDescriptor.m_Outputs);
+}
 
-    std::unique_ptr<Decoder<float>> decoderPtr = MakeDecoder<float>(inputTensorInfo, m_Data.m_Inputs[0]->Map());
-    Decoder<float> &decoder = *decoderPtr;
+void RefSoftmaxWorkload::Execute(const std::vector<ITensorHandle*>& inputs,
+                                 const std::vector<ITensorHandle*>& outputs) const
+{
+    ARMNN_SCOPED_PROFILING_EVENT(Compute::CpuRef, "RefSoftmaxWorkload_Execute");
 
-    const TensorInfo &outputTensorInfo = GetTensorInfo(m_Data.m_Outputs[0]);
+    const TensorInfo &inputTensorInfo = GetTensorInfo(inputs[0]);
+    const TensorInfo &outputTensorInfo = GetTensorInfo(outputs[0]);
 
-    std::unique_ptr<Encoder<float>> encoderPtr = MakeEncoder<float>(outputTensorInfo, m_Data.m_Outputs[0]->Map());
-    Encoder<float> &encoder = *encoderPtr;
+    std::vector<float> decodedInput;
+    std::vector<float> outputBuffer;
+    const float* inputData = GetFloatInputData(inputTensorInfo, inputs[0]->Map(), decodedInput);
+    float* outputData = GetFloatOutputData(outputTensorInfo, outputs[0]->Map(), outputBuffer);
 
-    Softmax(decoder,
-            encoder,
+    Softmax(inputData,
+            outputData,
             inputTensorInfo,
             m_Data.m_Parameters.m_Beta,
             m_Data.m_Parameters.m_Axis);
+
+    EncodeFloatOutputData(outputTensorInfo, outputs[0]->Map(), outputBuffer);
 }
 } //namespace armnn
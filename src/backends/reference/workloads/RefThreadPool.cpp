@@ -0,0 +1,223 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "RefThreadPool.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+
+namespace armnn
+{
+
+namespace
+{
+
+/// Set on the threads of the pool, so that nested calls to ParallelFor() do not wait on the pool itself
+thread_local bool t_IsPoolThread = false;
+
+/// Number of chunks per thread a range is split into, allows idle threads to take over work of busy ones
+constexpr unsigned int ChunksPerThread = 4;
+
+} // anonymous namespace
+
+struct RefThreadPool::Task
+{
+    Task(const RangeFunction& function, unsigned int begin, unsigned int end, unsigned int chunkSize)
+        : m_Function(function)
+        , m_Begin(begin)
+        , m_End(end)
+        , m_ChunkSize(chunkSize)
+        , m_NumChunks((end - begin + chunkSize - 1) / chunkSize)
+        , m_NextChunk(0)
+        , m_PendingChunks(m_NumChunks)
+    {}
+
+    bool HasUnclaimedChunks() const { return m_NextChunk.load() < m_NumChunks; }
+
+    const RangeFunction& m_Function;
+    const unsigned int m_Begin;
+    const unsigned int m_End;
+    const unsigned int m_ChunkSize;
+    const unsigned int m_NumChunks;
+
+    std::atomic<unsigned int> m_NextChunk;
+    std::atomic<unsigned int> m_PendingChunks;
+
+    std::mutex m_DoneMutex;
+    std::condition_variable m_DoneCondition;
+    std::exception_ptr m_Exception;
+};
+
+RefThreadPool& RefThreadPool::GetInstance()
+{
+    static RefThreadPool instance;
+    return instance;
+}
+
+RefThreadPool::~RefThreadPool()
+{
+    StopWorkers();
+}
+
+void RefThreadPool::SetNumberOfThreads(unsigned int numThreads)
+{
+    std::lock_guard<std::mutex> lock(m_ConfigMutex);
+
+    numThreads = std::max(numThreads, 1u);
+    if (numThreads == m_NumThreads)
+    {
+        return;
+    }
+
+    // Chunks of kernels in flight are completed by the threads calling ParallelFor()
+    StopWorkers();
+    StartWorkers(numThreads - 1);
+    m_NumThreads = numThreads;
+}
+
+unsigned int RefThreadPool::GetNumberOfThreads() const
+{
+    std::lock_guard<std::mutex> lock(m_ConfigMutex);
+    return m_NumThreads;
+}
+
+bool RefThreadPool::IsSplit(unsigned int begin, unsigned int end, unsigned int minChunkSize) const
+{
+    return !t_IsPoolThread && end > begin && end - begin > std::max(minChunkSize, 1u) && GetNumberOfThreads() > 1;
+}
+
+void RefThreadPool::Split(unsigned int begin,
+                          unsigned int end,
+                          unsigned int minChunkSize,
+                          const RangeFunction& func)
+{
+    const unsigned int numThreads = GetNumberOfThreads();
+    const unsigned int size = end - begin;
+    minChunkSize = std::max(minChunkSize, 1u);
+
+    const unsigned int maxChunks = numThreads * ChunksPerThread;
+    const unsigned int chunkSize = std::max(minChunkSize, (size + maxChunks - 1) / maxChunks);
+
+    auto task = std::make_shared<Task>(func, begin, end, chunkSize);
+    {
+        std::lock_guard<std::mutex> lock(m_TaskMutex);
+        m_Tasks.push_back(task);
+    }
+    m_TaskCondition.notify_all();
+
+    // The calling thread processes chunks as well, so the task completes even if every thread of the pool is busy
+    ProcessChunks(*task);
+    RemoveTask(task);
+
+    std::unique_lock<std::mutex> lock(task->m_DoneMutex);
+    task->m_DoneCondition.wait(lock, [&task]() { return task->m_PendingChunks.load() == 0; });
+
+    if (task->m_Exception)
+    {
+        std::rethrow_exception(task->m_Exception);
+    }
+}
+
+void RefThreadPool::StartWorkers(unsigned int numWorkers)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_TaskMutex);
+        m_Stop = false;
+    }
+    m_Workers.reserve(numWorkers);
+    for (unsigned int i = 0; i < numWorkers; ++i)
+    {
+        m_Workers.emplace_back(&RefThreadPool::ProcessTasks, this);
+    }
+}
+
+void RefThreadPool::StopWorkers()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_TaskMutex);
+        m_Stop = true;
+    }
+    m_TaskCondition.notify_all();
+
+    for (auto& worker : m_Workers)
+    {
+        worker.join();
+    }
+    m_Workers.clear();
+}
+
+void RefThreadPool::ProcessTasks()
+{
+    t_IsPoolThread = true;
+
+    while (true)
+    {
+        std::shared_ptr<Task> task;
+        {
+            std::unique_lock<std::mutex> lock(m_TaskMutex);
+            m_TaskCondition.wait(lock, [this]() { return m_Stop || !m_Tasks.empty(); });
+            if (m_Stop)
+            {
+                return;
+            }
+
+            task = m_Tasks.front();
+            if (!task->HasUnclaimedChunks())
+            {
+                m_Tasks.pop_front();
+                continue;
+            }
+        }
+
+        ProcessChunks(*task);
+        RemoveTask(task);
+    }
+}
+
+void RefThreadPool::RemoveTask(const std::shared_ptr<Task>& task)
+{
+    std::lock_guard<std::mutex> lock(m_TaskMutex);
+    auto it = std::find(m_Tasks.begin(), m_Tasks.end(), task);
+    if (it != m_Tasks.end())
+    {
+        m_Tasks.erase(it);
+    }
+}
+
+void RefThreadPool::ProcessChunks(Task& task)
+{
+    while (true)
+    {
+        const unsigned int chunk = task.m_NextChunk.fetch_add(1);
+        if (chunk >= task.m_NumChunks)
+        {
+            return;
+        }
+
+        const unsigned int chunkBegin = task.m_Begin + chunk * task.m_ChunkSize;
+        const unsigned int chunkEnd = std::min(task.m_End, chunkBegin + task.m_ChunkSize);
+        try
+        {
+            task.m_Function(chunkBegin, chunkEnd);
+        }
+        catch (...)
+        {
+            std::lock_guard<std::mutex> lock(task.m_DoneMutex);
+            if (!task.m_Exception)
+            {
+                task.m_Exception = std::current_exception();
+            }
+        }
+
+        if (task.m_PendingChunks.fetch_sub(1) == 1)
+        {
+            std::lock_guard<std::mutex> lock(task.m_DoneMutex);
+            task.m_DoneCondition.notify_all();
+        }
+    }
+}
+
+} // namespace armnn
@@ -0,0 +1,89 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace armnn
+{
+
+/// Pool of threads shared by all the workloads of the reference backend to split a kernel into independent ranges.
+/// The number of threads is set through the "NumberOfThreads" option of the CpuRef backend options passed to
+/// IRuntime::CreationOptions::m_BackendOptions and defaults to 1, i.e. kernels run on the calling thread only.
+/// The pool is process-wide rather than per runtime, so the last runtime created with the option sets its size.
+class RefThreadPool
+{
+public:
+    /// Function processing the elements in [begin, end) of a range.
+    using RangeFunction = std::function<void(unsigned int begin, unsigned int end)>;
+
+    static RefThreadPool& GetInstance();
+
+    ~RefThreadPool();
+
+    RefThreadPool(const RefThreadPool&) = delete;
+    RefThreadPool& operator=(const RefThreadPool&) = delete;
+
+    /// Sets the number of threads executing a kernel, including the thread calling ParallelFor().
+    void SetNumberOfThreads(unsigned int numThreads);
+
+    unsigned int GetNumberOfThreads() const;
+
+    /// Splits [begin, end) into chunks of at least minChunkSize elements and calls func on each of them, from the
+    /// calling thread and the threads of the pool. Chunks are claimed by whichever thread is free first, so busy
+    /// threads have their share taken over by idle ones. Blocks until every chunk has been processed and rethrows
+    /// the first exception thrown by func, if any. Calls made from func on a thread of the pool run on that thread
+    /// only, so nested calls never wait on the pool.
+    template <typename Function>
+    void ParallelFor(unsigned int begin, unsigned int end, unsigned int minChunkSize, Function&& func)
+    {
+        // Ranges processed in one go are not wrapped into a RangeFunction, which may allocate
+        if (!IsSplit(begin, end, minChunkSize))
+        {
+            if (begin < end)
+            {
+                func(begin, end);
+            }
+            return;
+        }
+        Split(begin, end, minChunkSize, RangeFunction(std::forward<Function>(func)));
+    }
+
+private:
+    struct Task;
+
+    RefThreadPool() = default;
+
+    bool IsSplit(unsigned int begin, unsigned int end, unsigned int minChunkSize) const;
+    void Split(unsigned int begin, unsigned int end, unsigned int minChunkSize, const RangeFunction& func);
+
+    void StartWorkers(unsigned int numWorkers);
+    void StopWorkers();
+    void ProcessTasks();
+    void RemoveTask(const std::shared_ptr<Task>& task);
+
+    static void ProcessChunks(Task& task);
+
+    /// Serialises changes to the number of threads
+    mutable std::mutex m_ConfigMutex;
+    unsigned int m_NumThreads = 1;
+
+    std::mutex m_TaskMutex;
+    std::condition_variable m_TaskCondition;
+    std::deque<std::shared_ptr<Task>> m_Tasks;
+    bool m_Stop = false;
+
+    std::vector<std::thread> m_Workers;
+};
+
+} // namespace armnn
@@ -5,6 +5,7 @@
 
 #include "RefTransposeConvolution2dWorkload.hpp"
 
+#include "GemmConvolution.hpp"
 #include "RefWorkloadUtils.hpp"
 #include "TransposeConvolution2d.hpp"
 
@@ -31,6 +32,14 @@ RefTransposeConvolution2dWorkload::RefTransposeConvolution2dWorkload(
         const TensorInfo& biasesInfo = m_Biases->GetTensorInfo();
         m_BiasesDecoder = MakeDecoder<float>(biasesInfo, m_Biases->Map(true));
     }
+
+    // Weights without data are only seen on workloads which are never executed
+    if (IsGemmConvolutionSupported(info.m_InputTensorInfos[0], weightsInfo, info.m_OutputTensorInfos[0]) &&
+        m_Weights->GetConstTensor<float>() != nullptr)
+    {
+        m_PackedWeights = PackTransposeConvolution2dWeights(m_WeightsShape, m_Weights->GetConstTensor<float>(),
+                                                            descriptor.m_Parameters.m_DataLayout);
+    }
 }
 
 void RefTransposeConvolution2dWorkload::PostAllocationConfigure()
@@ -54,6 +63,19 @@ void RefTransposeConvolution2dWorkload::Execute() const
 {
     ARMNN_SCOPED_PROFILING_EVENT(Compute::CpuRef, "RefTransposeConvolution2dWorkload_Execute");
 
+    if (!m_PackedWeights.empty())
+    {
+        GemmTransposeConvolve(m_Data.m_Parameters,
+                              m_InputShape,
+                              GetInputTensorDataFloat(0, m_Data),
+                              m_OutputShape,
+                              GetOutputTensorDataFloat(0, m_Data),
+                              m_WeightsShape,
+                              m_PackedWeights,
+                              m_Data.m_Parameters.m_BiasEnabled ? m_Biases->GetConstTensor<float>() : nullptr);
+        return;
+    }
+
     m_InputDecoder->Reset(m_Data.m_Inputs[0]->Map());
     m_OutputEncoder->Reset(m_Data.m_Outputs[0]->Map());
 
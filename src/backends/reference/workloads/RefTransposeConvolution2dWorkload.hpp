@@ -38,6 +38,10 @@ private:
     TensorShape m_InputShape;
     TensorShape m_OutputShape;
     TensorShape m_WeightsShape;
+
+    /// Weights rearranged for GemmTransposeConvolve(), empty if the convolution goes through
+    /// TransposeConvolution2dImpl()
+    std::vector<float> m_PackedWeights;
 };
 
 } // namespace armnn
\ No newline at end of file
@@ -5,8 +5,14 @@
 
 #pragma once
 
+#include "Decoders.hpp"
+#include "Encoders.hpp"
+#include "TypedConversion.hpp"
+
 #include <backendsCommon/CpuTensorHandle.hpp>
+#include <backendsCommon/WorkloadData.hpp>
 
+#include <armnn/Descriptors.hpp>
 #include <armnn/Tensor.hpp>
 #include <armnn/Types.hpp>
 #include <armnn/utility/PolymorphicDowncast.hpp>
@@ -81,6 +87,67 @@ BFloat16* GetOutputTensorDataBFloat16(unsigned int idx, const PayloadType& data)
     return GetOutputTensorData<BFloat16>(idx, data);
 }
 
+////////////////////////////////////////////
+/// float kernel helpers
+////////////////////////////////////////////
+
+/// Decodes a constant tensor, such as weights or biases, to float. Workloads call this once when they are created
+/// instead of decoding the same data on every execution. Returns an empty vector if the tensor has no data.
+inline std::vector<float> DecodeConstantTensor(const ConstCpuTensorHandle& tensorHandle,
+                                               unsigned int channelMultiplier = 1,
+                                               bool isDepthwise = false)
+{
+    const TensorInfo& info = tensorHandle.GetTensorInfo();
+    const void* data = tensorHandle.GetConstTensor<void>();
+    if (data == nullptr)
+    {
+        return {};
+    }
+    return MakeDecoder<float>(info, data)->DecodeTensor(info.GetShape(), channelMultiplier, isDepthwise);
+}
+
+/// Returns the values of an input tensor as floats: Float32 data is read in place, other data types are converted
+/// into decodedData.
+inline const float* GetFloatInputData(const TensorInfo& info, const void* data, std::vector<float>& decodedData)
+{
+    if (info.GetDataType() == DataType::Float32)
+    {
+        return static_cast<const float*>(data);
+    }
+    decodedData.resize(info.GetNumElements());
+    ConvertToFloat(info, data, decodedData.data());
+    return decodedData.data();
+}
+
+/// Returns where a kernel writes the float values of an output tensor: in place for Float32 data, otherwise in
+/// outputBuffer, which EncodeFloatOutputData() then encodes into the tensor.
+inline float* GetFloatOutputData(const TensorInfo& info, void* data, std::vector<float>& outputBuffer)
+{
+    if (info.GetDataType() == DataType::Float32)
+    {
+        return static_cast<float*>(data);
+    }
+    outputBuffer.resize(info.GetNumElements());
+    return outputBuffer.data();
+}
+
+inline void EncodeFloatOutputData(const TensorInfo& info, void* data, const std::vector<float>& outputBuffer)
+{
+    if (info.GetDataType() == DataType::Float32)
+    {
+        return;
+    }
+    ConvertFromFloat(info, outputBuffer.data(), data);
+}
+
+/// Returns a copy of the activation fused into a layer by RefBackend::OptimizeSubgraphView(), which the kernel of
+/// its workload applies to the values it writes, or nullptr if no activation was fused.
+inline std::unique_ptr<ActivationDescriptor> GetFusedActivation(const QueueDescriptor& descriptor)
+{
+    const ActivationDescriptor* activation = descriptor.GetAdditionalInformation<ActivationDescriptor>();
+    return activation ? std::make_unique<ActivationDescriptor>(*activation) : nullptr;
+}
+
 ////////////////////////////////////////////
 /// u8 helpers
 ////////////////////////////////////////////
@@ -12,6 +12,7 @@
 #include "Concatenate.hpp"
 #include "ElementwiseFunction.hpp"
 #include "FullyConnected.hpp"
+#include "FusedElementwise.hpp"
 #include "Gather.hpp"
 #include "Pooling2d.hpp"
 #include "RefActivationWorkload.hpp"
@@ -36,6 +37,7 @@
 #include "RefElementwiseUnaryWorkload.hpp"
 #include "RefFillWorkload.hpp"
 #include "RefFullyConnectedWorkload.hpp"
+#include "RefFusedElementwiseWorkload.hpp"
 #include "RefFloorWorkload.hpp"
 #include "RefFakeQuantizationFloat32Workload.hpp"
 #include "RefGatherWorkload.hpp"
@@ -4,17 +4,18 @@
 //
 
 #include "Softmax.hpp"
+#include "RefThreadPool.hpp"
 
 #include <armnnUtils/TensorUtils.hpp>
 
+#include <algorithm>
 #include <cmath>
 #include <vector>
 
 namespace armnn
 {
 
-/// Computes the softmax function on some inputs, into outputs, with a shape given by tensorInfo.
-void Softmax(Decoder<float>& in, Encoder<float>& out, const TensorInfo& inputTensorInfo, float beta, int axis)
+void Softmax(const float* in, float* out, const TensorInfo& inputTensorInfo, float beta, int axis)
 {
     ARMNN_ASSERT_MSG(axis < static_cast<int>(inputTensorInfo.GetNumDimensions()),
                      "Required axis index greater than number of dimensions.");
@@ -32,40 +33,57 @@ void Softmax(Decoder<float>& in, Encoder<float>& out, const TensorInfo& inputTen
                                                                       uAxis + 1,
                                                                       inputShape.GetNumDimensions());
 
-    for (unsigned int outer = 0; outer < outerSize; ++outer)
+    // Each softmax along the axis is independent of the others, so they are split over the threads of the pool.
+    // [begin, end) indexes them as (outer, inner).
+    auto ComputeSoftmax = [&](unsigned int begin, unsigned int end)
     {
-        unsigned int inputBeginIdx  = outer * axisSize * innerSize;
-        unsigned int inputEndIdx    = inputBeginIdx + axisSize * innerSize;
-        unsigned int outputBeginIdx = outer * axisSize * innerSize;
-
-        for (unsigned int inner = 0; inner < innerSize; ++inner, ++inputBeginIdx, ++inputEndIdx, ++outputBeginIdx)
+        for (unsigned int outerInner = begin; outerInner < end; ++outerInner)
         {
+            const unsigned int outer = outerInner / innerSize;
+            const unsigned int inner = outerInner % innerSize;
+
+            const float* input = in + outer * axisSize * innerSize + inner;
+            float* output = out + outer * axisSize * innerSize + inner;
+
             // Find max
             float maxValue = std::numeric_limits<float>::lowest();
-            for (unsigned int iter = inputBeginIdx; iter < inputEndIdx; iter += innerSize)
+            for (unsigned int i = 0; i < axisSize; ++i)
             {
-                in[iter];
-                maxValue = std::max(maxValue, in.Get());
+                maxValue = std::max(maxValue, input[i * innerSize]);
             }
 
-            // Compute sum
+            // Compute the exponentials into the output, which may be the input, once the max is known
             float sum = 0.0f;
-            for (unsigned int iter = inputBeginIdx; iter < inputEndIdx; iter += innerSize)
+            for (unsigned int i = 0; i < axisSize; ++i)
             {
-                in[iter];
-                sum += std::exp((in.Get() - maxValue) * beta);
+                const float value = std::exp((input[i * innerSize] - maxValue) * beta);
+                output[i * innerSize] = value;
+                sum += value;
             }
 
             // Compute result
-            unsigned int outputIter = outputBeginIdx;
-            out[outputIter];
-            for (unsigned int iter = inputBeginIdx; iter < inputEndIdx; iter += innerSize, outputIter += innerSize)
+            for (unsigned int i = 0; i < axisSize; ++i)
             {
-                out[outputIter];
-                in[iter];
-                out.Set(std::exp((in.Get() - maxValue) * beta) / sum);
+                output[i * innerSize] /= sum;
             }
         }
+    };
+    const unsigned int minChunkSize = std::max(1u, 1024u / std::max(axisSize, 1u));
+    RefThreadPool::GetInstance().ParallelFor(0, outerSize * innerSize, minChunkSize, ComputeSoftmax);
+}
+
+/// Computes the softmax function on some inputs, into outputs, with a shape given by tensorInfo.
+void Softmax(Decoder<float>& in, Encoder<float>& out, const TensorInfo& inputTensorInfo, float beta, int axis)
+{
+    const std::vector<float> inputVec = in.DecodeTensor(inputTensorInfo.GetShape());
+    std::vector<float> outputVec(inputVec.size());
+
+    Softmax(inputVec.data(), outputVec.data(), inputTensorInfo, beta, axis);
+
+    for (unsigned int i = 0; i < outputVec.size(); ++i)
+    {
+        out[i];
+        out.Set(outputVec[i]);
     }
 }
 
@@ -11,6 +11,10 @@
 namespace armnn
 {
 
+/// Computes the softmax function on float inputs, into outputs, with a shape given by inputTensorInfo.
+/// in and out may point to the same data.
+void Softmax(const float* in, float* out, const TensorInfo& inputTensorInfo, float beta, int axis = -1);
+
 /// Computes the softmax function on some inputs, into outputs, with a shape given by tensorInfo.
 void Softmax(Decoder<float>& in, Encoder<float>& out, const TensorInfo& inputTensorInfo, float beta, int axis = -1);
 
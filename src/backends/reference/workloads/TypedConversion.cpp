@@ -0,0 +1,161 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "TypedConversion.hpp"
+
+#include "Decoders.hpp"
+#include "Encoders.hpp"
+
+#include <armnnUtils/FloatingPointConverter.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+namespace armnn
+{
+
+namespace
+{
+
+/// Same as armnn::Dequantize(), but inlined into the loop converting a whole tensor
+template <typename T>
+void DequantizeElements(const T* input, unsigned int numElements, float scale, int32_t offset, float* output)
+{
+    for (unsigned int i = 0; i < numElements; ++i)
+    {
+        output[i] = static_cast<float>(static_cast<int32_t>(input[i]) - offset) * scale;
+    }
+}
+
+/// Same as armnn::Quantize(), but inlined into the loop converting a whole tensor
+template <typename T>
+void QuantizeElements(const float* input, unsigned int numElements, float scale, int32_t offset, T* output)
+{
+    constexpr float min = static_cast<float>(std::numeric_limits<T>::lowest());
+    constexpr float max = static_cast<float>(std::numeric_limits<T>::max());
+    const float offsetValue = static_cast<float>(offset);
+    for (unsigned int i = 0; i < numElements; ++i)
+    {
+        const float quantized = std::round(input[i] / scale) + offsetValue;
+        output[i] = static_cast<T>(std::min(std::max(quantized, min), max));
+    }
+}
+
+bool IsConvertedPerTensor(const TensorInfo& info)
+{
+    return !info.HasPerAxisQuantization();
+}
+
+} // anonymous namespace
+
+void ConvertToFloat(const TensorInfo& info, const void* data, float* output)
+{
+    const unsigned int numElements = info.GetNumElements();
+    const float scale = info.GetQuantizationScale();
+    const int32_t offset = info.GetQuantizationOffset();
+
+    switch (info.GetDataType())
+    {
+        case DataType::Float32:
+            std::memcpy(output, data, numElements * sizeof(float));
+            return;
+        case DataType::Float16:
+            armnnUtils::FloatingPointConverter::ConvertFloat16To32(data, numElements, output);
+            return;
+        case DataType::BFloat16:
+            armnnUtils::FloatingPointConverter::ConvertBFloat16ToFloat32(data, numElements, output);
+            return;
+        case DataType::QAsymmU8:
+            DequantizeElements(static_cast<const uint8_t*>(data), numElements, scale, offset, output);
+            return;
+        case DataType::QAsymmS8:
+            DequantizeElements(static_cast<const int8_t*>(data), numElements, scale, offset, output);
+            return;
+        case DataType::QSymmS8:
+            if (IsConvertedPerTensor(info))
+            {
+                DequantizeElements(static_cast<const int8_t*>(data), numElements, scale, offset, output);
+                return;
+            }
+            break;
+        case DataType::QSymmS16:
+            DequantizeElements(static_cast<const int16_t*>(data), numElements, scale, offset, output);
+            return;
+        case DataType::Signed32:
+            if (IsConvertedPerTensor(info))
+            {
+                // Like Int32Decoder and ScaledInt32Decoder: the values are either plain integers or scaled biases
+                DequantizeElements(static_cast<const int32_t*>(data), numElements, scale == 0.f ? 1.f : scale, 0,
+                                   output);
+                return;
+            }
+            break;
+        default:
+            break;
+    }
+
+    std::unique_ptr<Decoder<float>> decoder = MakeDecoder<float>(info, data);
+    const std::vector<float> decoded = decoder->DecodeTensor(info.GetShape());
+    std::copy(decoded.begin(), decoded.end(), output);
+}
+
+void ConvertFromFloat(const TensorInfo& info, const float* input, void* data)
+{
+    const unsigned int numElements = info.GetNumElements();
+    const float scale = info.GetQuantizationScale();
+    const int32_t offset = info.GetQuantizationOffset();
+
+    switch (info.GetDataType())
+    {
+        case DataType::Float32:
+            std::memcpy(data, input, numElements * sizeof(float));
+            return;
+        case DataType::Float16:
+            armnnUtils::FloatingPointConverter::ConvertFloat32To16(input, numElements, data);
+            return;
+        case DataType::BFloat16:
+            armnnUtils::FloatingPointConverter::ConvertFloat32ToBFloat16(input, numElements, data);
+            return;
+        case DataType::QAsymmU8:
+            QuantizeElements(input, numElements, scale, offset, static_cast<uint8_t*>(data));
+            return;
+        case DataType::QAsymmS8:
+            QuantizeElements(input, numElements, scale, offset, static_cast<int8_t*>(data));
+            return;
+        case DataType::QSymmS8:
+            if (IsConvertedPerTensor(info))
+            {
+                QuantizeElements(input, numElements, scale, offset, static_cast<int8_t*>(data));
+                return;
+            }
+            break;
+        case DataType::QSymmS16:
+            QuantizeElements(input, numElements, scale, offset, static_cast<int16_t*>(data));
+            return;
+        case DataType::Signed32:
+        {
+            // Like Int32Encoder, which truncates the values
+            int32_t* output = static_cast<int32_t*>(data);
+            for (unsigned int i = 0; i < numElements; ++i)
+            {
+                output[i] = static_cast<int32_t>(input[i]);
+            }
+            return;
+        }
+        default:
+            break;
+    }
+
+    std::unique_ptr<Encoder<float>> encoder = MakeEncoder<float>(info, data);
+    for (unsigned int i = 0; i < numElements; ++i)
+    {
+        (*encoder)[i];
+        encoder->Set(input[i]);
+    }
+}
+
+} // namespace armnn
@@ -0,0 +1,21 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include <armnn/Tensor.hpp>
+
+namespace armnn
+{
+
+/// Converts the elements of a tensor to float. The data type of the tensor selects a loop over its raw elements
+/// with the quantization parameters held in registers, rather than calling a Decoder once per element. Data types
+/// without such a loop, e.g. tensors quantized per axis, go through a Decoder.
+void ConvertToFloat(const TensorInfo& info, const void* data, float* output);
+
+/// Converts float values to the data type of a tensor and writes them into its data, see ConvertToFloat().
+void ConvertFromFloat(const TensorInfo& info, const float* input, void* data);
+
+} // namespace armnn
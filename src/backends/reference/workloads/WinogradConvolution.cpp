@@ -0,0 +1,345 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "WinogradConvolution.hpp"
+
+#include "Activation.hpp"
+#include "GemmConvolution.hpp"
+#include "RefThreadPool.hpp"
+
+#include <armnn/Exceptions.hpp>
+
+#include <armnnUtils/DataLayoutIndexed.hpp>
+
+#include <algorithm>
+#include <array>
+#include <string>
+
+namespace armnn
+{
+
+namespace
+{
+
+constexpr unsigned int FilterSize = 3;
+
+/// Number of elements of the largest input tiles, those of F(4x4, 3x3)
+constexpr unsigned int MaxTileElements = 6 * 6;
+
+/// Maximum number of values of the transformed input and output tiles held at a time by each thread.
+constexpr unsigned int WinogradBlockSize = 256 * 1024;
+
+/// The matrices of the Winograd algorithm F(m x m, 3x3), see "Fast Algorithms for Convolutional Neural Networks",
+/// Lavin & Gray: the input transform B^T (alpha x alpha), the weights transform G (alpha x 3) and the output
+/// transform A^T (m x alpha), where alpha = m + 2 is the size of the input tiles.
+struct WinogradMatrices
+{
+    unsigned int m_TileSize;
+    unsigned int m_Alpha;
+    const float* m_InputTransform;
+    const float* m_WeightsTransform;
+    const float* m_OutputTransform;
+};
+
+constexpr float F2x2InputTransform[] =
+{
+    1.0f,  0.0f, -1.0f,  0.0f,
+    0.0f,  1.0f,  1.0f,  0.0f,
+    0.0f, -1.0f,  1.0f,  0.0f,
+    0.0f,  1.0f,  0.0f, -1.0f
+};
+
+constexpr float F2x2WeightsTransform[] =
+{
+    1.0f,  0.0f, 0.0f,
+    0.5f,  0.5f, 0.5f,
+    0.5f, -0.5f, 0.5f,
+    0.0f,  0.0f, 1.0f
+};
+
+constexpr float F2x2OutputTransform[] =
+{
+    1.0f, 1.0f,  1.0f,  0.0f,
+    0.0f, 1.0f, -1.0f, -1.0f
+};
+
+constexpr float F4x4InputTransform[] =
+{
+    4.0f,  0.0f, -5.0f,  0.0f, 1.0f, 0.0f,
+    0.0f, -4.0f, -4.0f,  1.0f, 1.0f, 0.0f,
+    0.0f,  4.0f, -4.0f, -1.0f, 1.0f, 0.0f,
+    0.0f, -2.0f, -1.0f,  2.0f, 1.0f, 0.0f,
+    0.0f,  2.0f, -1.0f, -2.0f, 1.0f, 0.0f,
+    0.0f,  4.0f,  0.0f, -5.0f, 0.0f, 1.0f
+};
+
+constexpr float F4x4WeightsTransform[] =
+{
+     1.0f / 4.0f,   0.0f,          0.0f,
+    -1.0f / 6.0f,  -1.0f / 6.0f,  -1.0f / 6.0f,
+    -1.0f / 6.0f,   1.0f / 6.0f,  -1.0f / 6.0f,
+     1.0f / 24.0f,  1.0f / 12.0f,  1.0f / 6.0f,
+     1.0f / 24.0f, -1.0f / 12.0f,  1.0f / 6.0f,
+     0.0f,          0.0f,          1.0f
+};
+
+constexpr float F4x4OutputTransform[] =
+{
+    1.0f, 1.0f,  1.0f, 1.0f,  1.0f, 0.0f,
+    0.0f, 1.0f, -1.0f, 2.0f, -2.0f, 0.0f,
+    0.0f, 1.0f,  1.0f, 4.0f,  4.0f, 0.0f,
+    0.0f, 1.0f, -1.0f, 8.0f, -8.0f, 1.0f
+};
+
+const WinogradMatrices& GetWinogradMatrices(unsigned int tileSize)
+{
+    static const WinogradMatrices f2x2 = { 2, 4, F2x2InputTransform, F2x2WeightsTransform, F2x2OutputTransform };
+    static const WinogradMatrices f4x4 = { 4, 6, F4x4InputTransform, F4x4WeightsTransform, F4x4OutputTransform };
+
+    switch (tileSize)
+    {
+        case 2:
+            return f2x2;
+        case 4:
+            return f4x4;
+        default:
+            throw InvalidArgumentException("Unsupported Winograd output tile size: " + std::to_string(tileSize));
+    }
+}
+
+/// Computes output = matrix * input * matrix^T, where matrix is rows x cols and input is cols x cols.
+/// scratch must hold rows * cols values.
+void Transform(const float* matrix, unsigned int rows, unsigned int cols,
+               const float* input, float* output, float* scratch)
+{
+    for (unsigned int row = 0; row < rows; ++row)
+    {
+        for (unsigned int col = 0; col < cols; ++col)
+        {
+            float sum = 0.0f;
+            for (unsigned int i = 0; i < cols; ++i)
+            {
+                sum += matrix[row * cols + i] * input[i * cols + col];
+            }
+            scratch[row * cols + col] = sum;
+        }
+    }
+
+    for (unsigned int row = 0; row < rows; ++row)
+    {
+        for (unsigned int col = 0; col < rows; ++col)
+        {
+            float sum = 0.0f;
+            for (unsigned int i = 0; i < cols; ++i)
+            {
+                sum += scratch[row * cols + i] * matrix[col * cols + i];
+            }
+            output[row * rows + col] = sum;
+        }
+    }
+}
+
+} // anonymous namespace
+
+unsigned int GetWinogradOutputTileSize(const Convolution2dDescriptor& descriptor,
+                                       const TensorShape& weightsShape,
+                                       const TensorShape& outputShape)
+{
+    const armnnUtils::DataLayoutIndexed dataLayoutIndexed(descriptor.m_DataLayout);
+    if (weightsShape[dataLayoutIndexed.GetHeightIndex()] != FilterSize ||
+        weightsShape[dataLayoutIndexed.GetWidthIndex()] != FilterSize ||
+        descriptor.m_StrideX != 1 || descriptor.m_StrideY != 1 ||
+        descriptor.m_DilationX != 1 || descriptor.m_DilationY != 1)
+    {
+        return 0;
+    }
+
+    // The larger tiles save more multiplications but waste more of them on small outputs
+    const unsigned int outputHeight = outputShape[dataLayoutIndexed.GetHeightIndex()];
+    const unsigned int outputWidth  = outputShape[dataLayoutIndexed.GetWidthIndex()];
+    return std::min(outputHeight, outputWidth) >= 8 ? 4 : 2;
+}
+
+std::vector<float> TransformWinogradWeights(unsigned int tileSize,
+                                            const TensorShape& weightsShape,
+                                            const float* weights,
+                                            DataLayout dataLayout)
+{
+    const WinogradMatrices& matrices = GetWinogradMatrices(tileSize);
+    const unsigned int alpha = matrices.m_Alpha;
+
+    const armnnUtils::DataLayoutIndexed dataLayoutIndexed(dataLayout);
+    const unsigned int outputChannels = weightsShape[0];
+    const unsigned int inputChannels  = weightsShape[dataLayoutIndexed.GetChannelsIndex()];
+
+    std::vector<float> transformedWeights(alpha * alpha * inputChannels * outputChannels);
+    std::vector<float> filter(FilterSize * FilterSize);
+    std::vector<float> transformed(alpha * alpha);
+    std::vector<float> scratch(alpha * FilterSize);
+
+    for (unsigned int outputChannel = 0; outputChannel < outputChannels; ++outputChannel)
+    {
+        for (unsigned int inputChannel = 0; inputChannel < inputChannels; ++inputChannel)
+        {
+            for (unsigned int tap = 0; tap < FilterSize * FilterSize; ++tap)
+            {
+                filter[tap] = dataLayout == DataLayout::NHWC ?
+                              weights[(outputChannel * FilterSize * FilterSize + tap) * inputChannels + inputChannel] :
+                              weights[(outputChannel * inputChannels + inputChannel) * FilterSize * FilterSize + tap];
+            }
+
+            Transform(matrices.m_WeightsTransform, alpha, FilterSize, filter.data(), transformed.data(),
+                      scratch.data());
+
+            for (unsigned int element = 0; element < alpha * alpha; ++element)
+            {
+                transformedWeights[(element * inputChannels + inputChannel) * outputChannels + outputChannel] =
+                    transformed[element];
+            }
+        }
+    }
+    return transformedWeights;
+}
+
+void WinogradConvolve(unsigned int tileSize,
+                      const Convolution2dDescriptor& descriptor,
+                      const TensorShape& inputShape,
+                      const float* input,
+                      const TensorShape& outputShape,
+                      float* output,
+                      const std::vector<float>& transformedWeights,
+                      const float* biases,
+                      const ActivationDescriptor* activation)
+{
+    const WinogradMatrices& matrices = GetWinogradMatrices(tileSize);
+    const unsigned int alpha    = matrices.m_Alpha;
+    const unsigned int elements = alpha * alpha;
+
+    const armnnUtils::DataLayoutIndexed dataLayoutIndexed(descriptor.m_DataLayout);
+    const bool isNhwc = descriptor.m_DataLayout == DataLayout::NHWC;
+
+    const unsigned int batchSize      = outputShape[0];
+    const unsigned int inputChannels  = inputShape[dataLayoutIndexed.GetChannelsIndex()];
+    const unsigned int inputHeight    = inputShape[dataLayoutIndexed.GetHeightIndex()];
+    const unsigned int inputWidth     = inputShape[dataLayoutIndexed.GetWidthIndex()];
+    const unsigned int outputChannels = outputShape[dataLayoutIndexed.GetChannelsIndex()];
+    const unsigned int outputHeight   = outputShape[dataLayoutIndexed.GetHeightIndex()];
+    const unsigned int outputWidth    = outputShape[dataLayoutIndexed.GetWidthIndex()];
+
+    auto InputIndex = [&](unsigned int batchIdx, unsigned int channel, unsigned int y, unsigned int x)
+    {
+        return isNhwc ? ((batchIdx * inputHeight + y) * inputWidth + x) * inputChannels + channel :
+                        ((batchIdx * inputChannels + channel) * inputHeight + y) * inputWidth + x;
+    };
+    auto OutputIndex = [&](unsigned int batchIdx, unsigned int channel, unsigned int y, unsigned int x)
+    {
+        return isNhwc ? ((batchIdx * outputHeight + y) * outputWidth + x) * outputChannels + channel :
+                        ((batchIdx * outputChannels + channel) * outputHeight + y) * outputWidth + x;
+    };
+
+    const unsigned int tilesX         = (outputWidth + tileSize - 1) / tileSize;
+    const unsigned int tilesPerBatch  = ((outputHeight + tileSize - 1) / tileSize) * tilesX;
+    const unsigned int blockTiles     = std::max(1u, std::min(tilesPerBatch,
+        WinogradBlockSize / (elements * std::max(std::max(inputChannels, outputChannels), 1u))));
+    const unsigned int blocksPerBatch = (tilesPerBatch + blockTiles - 1) / blockTiles;
+
+    // Every block of output tiles is computed independently: its input tiles are transformed, multiplied with the
+    // transformed weights element by element of the tiles (as one [tiles, inputChannels] x [inputChannels,
+    // outputChannels] product per element) and the results transformed back into output tiles.
+    auto ConvolveBlocks = [&](unsigned int blockBegin, unsigned int blockEnd)
+    {
+        // Kept between executions so that they do not allocate once the buffers are large enough
+        thread_local std::vector<float> transformedInput;
+        thread_local std::vector<float> transformedOutput;
+        transformedInput.resize(static_cast<size_t>(elements) * blockTiles * inputChannels);
+        transformedOutput.resize(static_cast<size_t>(elements) * blockTiles * outputChannels);
+
+        std::array<float, MaxTileElements> tile;
+        std::array<float, MaxTileElements> transformedTile;
+        std::array<float, MaxTileElements> scratch;
+
+        for (unsigned int blockIdx = blockBegin; blockIdx < blockEnd; ++blockIdx)
+        {
+            const unsigned int batchIdx  = blockIdx / blocksPerBatch;
+            const unsigned int tileBegin = (blockIdx % blocksPerBatch) * blockTiles;
+            const unsigned int numTiles  = std::min(tilesPerBatch, tileBegin + blockTiles) - tileBegin;
+
+            for (unsigned int tileIdx = 0; tileIdx < numTiles; ++tileIdx)
+            {
+                const int yOrigin = static_cast<int>(((tileBegin + tileIdx) / tilesX) * tileSize) -
+                                    static_cast<int>(descriptor.m_PadTop);
+                const int xOrigin = static_cast<int>(((tileBegin + tileIdx) % tilesX) * tileSize) -
+                                    static_cast<int>(descriptor.m_PadLeft);
+
+                for (unsigned int inputChannel = 0; inputChannel < inputChannels; ++inputChannel)
+                {
+                    for (unsigned int y = 0; y < alpha; ++y)
+                    {
+                        for (unsigned int x = 0; x < alpha; ++x)
+                        {
+                            const int yInput = yOrigin + static_cast<int>(y);
+                            const int xInput = xOrigin + static_cast<int>(x);
+                            const bool inPadding = yInput < 0 || yInput >= static_cast<int>(inputHeight) ||
+                                                   xInput < 0 || xInput >= static_cast<int>(inputWidth);
+                            tile[y * alpha + x] = inPadding ? 0.0f :
+                                input[InputIndex(batchIdx, inputChannel, static_cast<unsigned int>(yInput),
+                                                 static_cast<unsigned int>(xInput))];
+                        }
+                    }
+
+                    Transform(matrices.m_InputTransform, alpha, alpha, tile.data(), transformedTile.data(),
+                              scratch.data());
+
+                    for (unsigned int element = 0; element < elements; ++element)
+                    {
+                        transformedInput[(element * numTiles + tileIdx) * inputChannels + inputChannel] =
+                            transformedTile[element];
+                    }
+                }
+            }
+
+            std::fill(transformedOutput.begin(), transformedOutput.end(), 0.0f);
+            for (unsigned int element = 0; element < elements; ++element)
+            {
+                Gemm(numTiles, outputChannels, inputChannels,
+                     transformedInput.data() + element * numTiles * inputChannels, inputChannels,
+                     transformedWeights.data() + element * inputChannels * outputChannels, outputChannels,
+                     transformedOutput.data() + element * numTiles * outputChannels, outputChannels);
+            }
+
+            for (unsigned int tileIdx = 0; tileIdx < numTiles; ++tileIdx)
+            {
+                const unsigned int yOrigin = ((tileBegin + tileIdx) / tilesX) * tileSize;
+                const unsigned int xOrigin = ((tileBegin + tileIdx) % tilesX) * tileSize;
+
+                for (unsigned int outputChannel = 0; outputChannel < outputChannels; ++outputChannel)
+                {
+                    for (unsigned int element = 0; element < elements; ++element)
+                    {
+                        transformedTile[element] =
+                            transformedOutput[(element * numTiles + tileIdx) * outputChannels + outputChannel];
+                    }
+
+                    Transform(matrices.m_OutputTransform, tileSize, alpha, transformedTile.data(), tile.data(),
+                              scratch.data());
+
+                    // The tiles on the bottom and right edges may extend past the output
+                    for (unsigned int y = 0; y < tileSize && yOrigin + y < outputHeight; ++y)
+                    {
+                        for (unsigned int x = 0; x < tileSize && xOrigin + x < outputWidth; ++x)
+                        {
+                            const float value = tile[y * tileSize + x] + (biases ? biases[outputChannel] : 0.0f);
+                            output[OutputIndex(batchIdx, outputChannel, yOrigin + y, xOrigin + x)] = activation ?
+                                Activation(value, activation->m_Function, activation->m_A, activation->m_B) : value;
+                        }
+                    }
+                }
+            }
+        }
+    };
+    RefThreadPool::GetInstance().ParallelFor(0, batchSize * blocksPerBatch, 1, ConvolveBlocks);
+}
+
+} // namespace armnn
@@ -0,0 +1,42 @@
+//
+// Copyright © 2020 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include <armnn/Descriptors.hpp>
+#include <armnn/Tensor.hpp>
+
+#include <vector>
+
+namespace armnn
+{
+
+/// Returns the size of the output tiles of the Winograd algorithm used for a Convolution2d, i.e. 4 for F(4x4, 3x3)
+/// or 2 for F(2x2, 3x3), or 0 if the convolution is not a 3x3 stride 1 convolution without dilation.
+unsigned int GetWinogradOutputTileSize(const Convolution2dDescriptor& descriptor,
+                                       const TensorShape& weightsShape,
+                                       const TensorShape& outputShape);
+
+/// Transforms the 3x3 weights of a Convolution2d into the Winograd domain: the result holds, for each of the
+/// (tileSize + 2)^2 elements of a transformed tile, a [inputChannels, outputChannels] matrix.
+std::vector<float> TransformWinogradWeights(unsigned int tileSize,
+                                            const TensorShape& weightsShape,
+                                            const float* weights,
+                                            DataLayout dataLayout);
+
+/// Convolution2d computed with the Winograd algorithm F(tileSize x tileSize, 3x3), using weights transformed by
+/// TransformWinogradWeights(). biases is either nullptr or holds outputChannels values. activation, if not nullptr,
+/// is applied to the outputs as they are written.
+void WinogradConvolve(unsigned int tileSize,
+                      const Convolution2dDescriptor& descriptor,
+                      const TensorShape& inputShape,
+                      const float* input,
+                      const TensorShape& outputShape,
+                      float* output,
+                      const std::vector<float>& transformedWeights,
+                      const float* biases,
+                      const ActivationDescriptor* activation = nullptr);
+
+} // namespace armnn